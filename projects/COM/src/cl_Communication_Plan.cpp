@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Communication_Plan.cpp
+ *
+ */
+
+#include "cl_Communication_Plan.hpp"    // COM/src
+
+namespace moris
+{
+    //------------------------------------------------------------------------------
+
+    Communication_Plan::Communication_Plan( const Matrix< IdMat >& aCommunicationTable )
+    {
+        Vector< moris_id > tCommunicationList( aCommunicationTable.numel() );
+
+        for ( uint k = 0; k < aCommunicationTable.numel(); k++ )
+        {
+            tCommunicationList( k ) = aCommunicationTable( k );
+        }
+
+        this->initialize( tCommunicationList );
+    }
+
+    //------------------------------------------------------------------------------
+
+    Communication_Plan::Communication_Plan( const Vector< moris_index >& aCommunicationList )
+    {
+        this->initialize( aCommunicationList );
+    }
+
+    //------------------------------------------------------------------------------
+
+    Communication_Plan::~Communication_Plan()
+    {
+        for ( MPI_Request& tRequest : mSizeRequests )
+        {
+            MPI_Request_free( &tRequest );
+        }
+
+        this->free_data_requests();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::initialize( const Vector< moris_id >& aCommunicationList )
+    {
+        mTableSize = aCommunicationList.size();
+
+        moris_id tParSize = par_size();
+        moris_id tMyRank  = par_rank();
+
+        // only communicate if proc neighbor exists and is not me
+        for ( uint k = 0; k < mTableSize; k++ )
+        {
+            if ( aCommunicationList( k ) < tParSize && aCommunicationList( k ) != tMyRank )
+            {
+                mPositions.push_back( k );
+                mRanks.push_back( aCommunicationList( k ) );
+            }
+        }
+
+        uint tNumberOfProcs = mRanks.size();
+
+        mSendSizes.resize( 2 * tNumberOfProcs, 0 );
+        mRecvSizes.resize( 2 * tNumberOfProcs, 0 );
+
+        mSendOffsets.resize( tNumberOfProcs + 1, 0 );
+        mRecvOffsets.resize( tNumberOfProcs + 1, 0 );
+
+        if ( tParSize == 1 )
+        {
+            return;
+        }
+
+        // create persistent requests for size handshake
+        mSizeRequests.resize( 2 * tNumberOfProcs );
+
+        MPI_Datatype tSizeType = get_comm_datatype( (uint)0 );
+
+        for ( uint p = 0; p < tNumberOfProcs; p++ )
+        {
+            MPI_Recv_init(
+                    mRecvSizes.memptr() + 2 * p,
+                    2,
+                    tSizeType,
+                    mRanks( p ),
+                    create_comm_tag( mRanks( p ), tMyRank ),
+                    gMorisComm.get_global_comm(),
+                    &mSizeRequests( p ) );
+
+            MPI_Send_init(
+                    mSendSizes.memptr() + 2 * p,
+                    2,
+                    tSizeType,
+                    mRanks( p ),
+                    create_comm_tag( tMyRank, mRanks( p ) ),
+                    gMorisComm.get_global_comm(),
+                    &mSizeRequests( tNumberOfProcs + p ) );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::set_send_size(
+            uint aProc,
+            uint aNumRows,
+            uint aNumCols,
+            bool aReuseSizes )
+    {
+        MORIS_ASSERT( !aReuseSizes || !mHasSizes || ( mSendSizes( 2 * aProc ) == aNumRows && mSendSizes( 2 * aProc + 1 ) == aNumCols ),
+                "Communication_Plan::set_send_size - sizes of data to be sent to processor %d have changed.",
+                mRanks( aProc ) );
+
+        mSendSizes( 2 * aProc )     = aNumRows;
+        mSendSizes( 2 * aProc + 1 ) = aNumCols;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::exchange_sizes()
+    {
+        if ( mSizeRequests.size() > 0 )
+        {
+            MPI_Startall( mSizeRequests.size(), mSizeRequests.memptr() );
+            MPI_Waitall( mSizeRequests.size(), mSizeRequests.memptr(), MPI_STATUSES_IGNORE );
+        }
+
+        mHasSizes = true;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::prepare_buffers( size_t aEntrySize )
+    {
+        for ( uint p = 0; p < mRanks.size(); p++ )
+        {
+            mSendOffsets( p + 1 ) = mSendOffsets( p ) + aEntrySize * mSendSizes( 2 * p ) * mSendSizes( 2 * p + 1 );
+            mRecvOffsets( p + 1 ) = mRecvOffsets( p ) + aEntrySize * mRecvSizes( 2 * p ) * mRecvSizes( 2 * p + 1 );
+
+            // make sure that MPI can send this data set
+            MORIS_ASSERT( mSendOffsets( p + 1 ) - mSendOffsets( p ) < INT_MAX,
+                    "Communication_Plan::prepare_buffers - matrix to be sent is too big." );
+        }
+
+        // buffers only grow to avoid reallocation in subsequent exchanges
+        if ( mSendBuffer.size() < mSendOffsets( mRanks.size() ) )
+        {
+            mSendBuffer.resize( mSendOffsets( mRanks.size() ) );
+        }
+
+        if ( mRecvBuffer.size() < mRecvOffsets( mRanks.size() ) )
+        {
+            mRecvBuffer.resize( mRecvOffsets( mRanks.size() ) );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::exchange_data()
+    {
+        uint tNumberOfProcs = mRanks.size();
+
+        if ( tNumberOfProcs == 0 )
+        {
+            return;
+        }
+
+        // recreate persistent requests if buffers or message sizes have changed
+        if ( mDataRequests.size() == 0                       //
+                || mRequestSendBuffer != mSendBuffer.memptr()    //
+                || mRequestRecvBuffer != mRecvBuffer.memptr()    //
+                || mRequestSendOffsets != mSendOffsets           //
+                || mRequestRecvOffsets != mRecvOffsets )
+        {
+            this->free_data_requests();
+
+            mDataRequests.resize( 2 * tNumberOfProcs );
+
+            moris_id tMyRank = par_rank();
+
+            for ( uint p = 0; p < tNumberOfProcs; p++ )
+            {
+                MPI_Recv_init(
+                        mRecvBuffer.memptr() + mRecvOffsets( p ),
+                        mRecvOffsets( p + 1 ) - mRecvOffsets( p ),
+                        MPI_BYTE,
+                        mRanks( p ),
+                        create_comm_tag( mRanks( p ), tMyRank ) + 1,
+                        gMorisComm.get_global_comm(),
+                        &mDataRequests( p ) );
+
+                MPI_Send_init(
+                        mSendBuffer.memptr() + mSendOffsets( p ),
+                        mSendOffsets( p + 1 ) - mSendOffsets( p ),
+                        MPI_BYTE,
+                        mRanks( p ),
+                        create_comm_tag( tMyRank, mRanks( p ) ) + 1,
+                        gMorisComm.get_global_comm(),
+                        &mDataRequests( tNumberOfProcs + p ) );
+            }
+
+            mRequestSendBuffer  = mSendBuffer.memptr();
+            mRequestRecvBuffer  = mRecvBuffer.memptr();
+            mRequestSendOffsets = mSendOffsets;
+            mRequestRecvOffsets = mRecvOffsets;
+        }
+
+        MPI_Startall( mDataRequests.size(), mDataRequests.memptr() );
+        MPI_Waitall( mDataRequests.size(), mDataRequests.memptr(), MPI_STATUSES_IGNORE );
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Communication_Plan::free_data_requests()
+    {
+        for ( MPI_Request& tRequest : mDataRequests )
+        {
+            MPI_Request_free( &tRequest );
+        }
+
+        mDataRequests.clear();
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace moris
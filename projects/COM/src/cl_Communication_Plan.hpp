@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Communication_Plan.hpp
+ *
+ */
+
+#ifndef SRC_COMM_CL_COMMUNICATION_PLAN_HPP_
+#define SRC_COMM_CL_COMMUNICATION_PLAN_HPP_
+
+#include <climits>
+#include <cstring>
+
+#include "cl_Communication_Tools.hpp"    // COM/src
+#include "cl_Matrix.hpp"
+#include "cl_Vector.hpp"
+
+namespace moris
+{
+    //------------------------------------------------------------------------------
+    /**
+     * @brief Reusable exchange of data with a fixed set of neighbor processors
+     *
+     * The plan is built once from a communication table and replaces repeated calls of communicate_mats and
+     * communicate_vectors with the same table. Its messages differ from those of these functions: two size
+     * words are sent for matrices and vectors, data is sent as bytes and a data message is posted to every
+     * partner, even if it is empty. Communication partners therefore need to use a plan as well, with the
+     * same sequence of exchanges. Data is sent from packed buffers which are kept between exchanges. The
+     * persistent requests for the size handshake are created once and the persistent requests for the data
+     * are only recreated if the message sizes change. If the message sizes of an exchange are known to be
+     * the same as in the previous exchange on all processors of the plan, the size handshake can be skipped.
+     */
+    class Communication_Plan
+    {
+      private:
+        //! number of entries of communication table
+        uint mTableSize = 0;
+
+        //! positions in communication table and ranks of communicating processors
+        Vector< uint >     mPositions;
+        Vector< moris_id > mRanks;
+
+        //! number of rows and columns of matrices to be sent and received, two entries per processor
+        Vector< uint > mSendSizes;
+        Vector< uint > mRecvSizes;
+
+        //! flag whether sizes of a previous exchange are available
+        bool mHasSizes = false;
+
+        //! persistent requests for size handshake: receives followed by sends
+        Vector< MPI_Request > mSizeRequests;
+
+        //! packed buffers and offsets of messages in bytes
+        Vector< char >   mSendBuffer;
+        Vector< char >   mRecvBuffer;
+        Vector< size_t > mSendOffsets;
+        Vector< size_t > mRecvOffsets;
+
+        //! persistent requests for data exchange: receives followed by sends
+        Vector< MPI_Request > mDataRequests;
+
+        //! buffers and offsets for which the persistent data requests were created
+        char*            mRequestSendBuffer = nullptr;
+        char*            mRequestRecvBuffer = nullptr;
+        Vector< size_t > mRequestSendOffsets;
+        Vector< size_t > mRequestRecvOffsets;
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief sets up ranks and persistent requests for size handshake
+         */
+        void initialize( const Vector< moris_id >& aCommunicationList );
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief exchanges number of rows and columns with all communicating processors
+         */
+        void exchange_sizes();
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief computes offsets of messages and grows buffers if needed
+         *
+         * @param[in] aEntrySize size of a matrix entry in bytes
+         */
+        void prepare_buffers( size_t aEntrySize );
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief exchanges packed buffers, recreating persistent requests if buffers or offsets have changed
+         */
+        void exchange_data();
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief frees persistent data requests
+         */
+        void free_data_requests();
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief sets sizes to be sent and checks them against previous exchange if handshake is skipped
+         */
+        void set_send_size(
+                uint aProc,
+                uint aNumRows,
+                uint aNumCols,
+                bool aReuseSizes );
+
+      public:
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief builds plan from communication table; entries without neighbor or with own rank are skipped
+         *
+         * @param[in] aCommunicationTable ranks of communicating processors
+         */
+        Communication_Plan( const Matrix< IdMat >& aCommunicationTable );
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief builds plan from communication list; entries without neighbor or with own rank are skipped
+         *
+         * @param[in] aCommunicationList ranks of communicating processors
+         */
+        Communication_Plan( const Vector< moris_index >& aCommunicationList );
+
+        //------------------------------------------------------------------------------
+
+        Communication_Plan( const Communication_Plan& ) = delete;
+
+        Communication_Plan& operator=( const Communication_Plan& ) = delete;
+
+        //------------------------------------------------------------------------------
+
+        ~Communication_Plan();
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief sends and receives matrices to and from each processor in communication table, see communicate_mats
+         *
+         * @param[in]  aMatsToSend     matrices to be sent to each processor
+         * @param[out] aMatsToReceive  matrices received from each processor
+         * @param[in]  aReuseSizes     skip size handshake as sizes are the same as in previous exchange
+         */
+        template< typename T >
+        void
+        communicate(
+                const Vector< Matrix< T > >& aMatsToSend,
+                Vector< Matrix< T > >&       aMatsToReceive,
+                bool                         aReuseSizes = false )
+        {
+            // only call this when we are in parallel mode
+            if ( par_size() == 1 )
+            {
+                return;
+            }
+
+            using Data_Type = typename Matrix< T >::Data_Type;
+
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                this->set_send_size( p, aMatsToSend( mPositions( p ) ).n_rows(), aMatsToSend( mPositions( p ) ).n_cols(), aReuseSizes );
+            }
+
+            if ( !aReuseSizes || !mHasSizes )
+            {
+                this->exchange_sizes();
+            }
+
+            this->prepare_buffers( sizeof( Data_Type ) );
+
+            // pack matrices
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                std::memcpy(
+                        mSendBuffer.memptr() + mSendOffsets( p ),
+                        aMatsToSend( mPositions( p ) ).data(),
+                        mSendOffsets( p + 1 ) - mSendOffsets( p ) );
+            }
+
+            this->exchange_data();
+
+            // unpack matrices
+            Matrix< T > tEmpty;
+            aMatsToReceive.clear();
+            aMatsToReceive.resize( mTableSize, tEmpty );
+
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                if ( mRecvOffsets( p + 1 ) > mRecvOffsets( p ) )
+                {
+                    Matrix< T >& tMatrix = aMatsToReceive( mPositions( p ) );
+
+                    tMatrix.set_size( mRecvSizes( 2 * p ), mRecvSizes( 2 * p + 1 ) );
+
+                    std::memcpy(
+                            tMatrix.data(),
+                            mRecvBuffer.memptr() + mRecvOffsets( p ),
+                            mRecvOffsets( p + 1 ) - mRecvOffsets( p ) );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief sends and receives vectors to and from each processor in communication table, see communicate_vectors
+         *
+         * @param[in]  aCellsToSend     vectors to be sent to each processor
+         * @param[out] aCellsToReceive  vectors received from each processor
+         * @param[in]  aReuseSizes      skip size handshake as sizes are the same as in previous exchange
+         */
+        template< typename T >
+        void
+        communicate(
+                const Vector< Vector< T > >& aCellsToSend,
+                Vector< Vector< T > >&       aCellsToReceive,
+                bool                         aReuseSizes = false )
+        {
+            // only call this when we are in parallel mode
+            if ( par_size() == 1 )
+            {
+                return;
+            }
+
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                this->set_send_size( p, aCellsToSend( mPositions( p ) ).size(), 1, aReuseSizes );
+            }
+
+            if ( !aReuseSizes || !mHasSizes )
+            {
+                this->exchange_sizes();
+            }
+
+            this->prepare_buffers( sizeof( T ) );
+
+            // pack vectors
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                std::memcpy(
+                        mSendBuffer.memptr() + mSendOffsets( p ),
+                        aCellsToSend( mPositions( p ) ).memptr(),
+                        mSendOffsets( p + 1 ) - mSendOffsets( p ) );
+            }
+
+            this->exchange_data();
+
+            // unpack vectors
+            Vector< T > tEmpty;
+            aCellsToReceive.clear();
+            aCellsToReceive.resize( mTableSize, tEmpty );
+
+            for ( uint p = 0; p < mRanks.size(); p++ )
+            {
+                if ( mRecvOffsets( p + 1 ) > mRecvOffsets( p ) )
+                {
+                    Vector< T >& tVector = aCellsToReceive( mPositions( p ) );
+
+                    tVector.resize( mRecvSizes( 2 * p ) );
+
+                    std::memcpy(
+                            tVector.memptr(),
+                            mRecvBuffer.memptr() + mRecvOffsets( p ),
+                            mRecvOffsets( p + 1 ) - mRecvOffsets( p ) );
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+    };
+}    // namespace moris
+
+#endif /* SRC_COMM_CL_COMMUNICATION_PLAN_HPP_ */
@@ -15,6 +15,7 @@
 
 #include "cl_Communication_Tools.hpp"      // COM/src
 #include "cl_Communication_Manager.hpp"    // COM/src
+#include "cl_Communication_Plan.hpp"       // COM/src
 
 #include "cl_Matrix.hpp"
 #include "linalg_typedefs.hpp"
@@ -232,4 +233,73 @@ namespace moris
         REQUIRE( norm( tMat - tReference ) < 1e-12 );
     }
 
+    //------------------------------------------------------------------------------
+
+    TEST_CASE( "moris::communication_plan",
+            "[comm],[communication_plan]" )
+    {
+        if ( par_size() > 1 )
+        {
+            // communicate with all other processors
+            Matrix< IdMat > tCommTable( par_size(), 1 );
+
+            for ( moris_id iProc = 0; iProc < par_size(); iProc++ )
+            {
+                tCommTable( iProc ) = iProc;
+            }
+
+            Communication_Plan tPlan( tCommTable );
+
+            // exchange twice with the same sizes, the second time without handshake
+            for ( uint iExchange = 0; iExchange < 2; iExchange++ )
+            {
+                Vector< Matrix< DDRMat > > tMatsToSend( par_size() );
+                Vector< Matrix< DDRMat > > tMatsToReceive;
+
+                for ( moris_id iProc = 0; iProc < par_size(); iProc++ )
+                {
+                    tMatsToSend( iProc ).set_size( 2, iProc + 1, (real)( par_rank() + iExchange ) );
+                }
+
+                tPlan.communicate( tMatsToSend, tMatsToReceive, iExchange == 1 );
+
+                REQUIRE( tMatsToReceive.size() == (uint)par_size() );
+
+                for ( moris_id iProc = 0; iProc < par_size(); iProc++ )
+                {
+                    if ( iProc == par_rank() )
+                    {
+                        REQUIRE( tMatsToReceive( iProc ).numel() == 0 );
+                    }
+                    else
+                    {
+                        Matrix< DDRMat > tReference( 2, par_rank() + 1, (real)( iProc + iExchange ) );
+
+                        REQUIRE( norm( tMatsToReceive( iProc ) - tReference ) < 1e-12 );
+                    }
+                }
+            }
+
+            // exchange vectors of different size with the same plan
+            Vector< Vector< moris_index > > tVectorsToSend( par_size() );
+            Vector< Vector< moris_index > > tVectorsToReceive;
+
+            for ( moris_id iProc = 0; iProc < par_size(); iProc++ )
+            {
+                tVectorsToSend( iProc ).resize( 3, par_rank() );
+            }
+
+            tPlan.communicate( tVectorsToSend, tVectorsToReceive );
+
+            for ( moris_id iProc = 0; iProc < par_size(); iProc++ )
+            {
+                if ( iProc != par_rank() )
+                {
+                    REQUIRE( tVectorsToReceive( iProc ).size() == 3 );
+                    REQUIRE( tVectorsToReceive( iProc )( 2 ) == iProc );
+                }
+            }
+        }
+    }
+
 }    // namespace moris
@@ -13,6 +13,7 @@
 #include <utility>
 #include "cl_FEM_Set.hpp"
 #include "cl_FEM_Field_Interpolator_Manager.hpp"
+#include "cl_Kernel_Profiler.hpp"
 
 namespace moris::fem
 {
@@ -2638,6 +2639,8 @@ namespace moris::fem
         // if the flux was not evaluated
         if ( mFluxEval )
         {
+            MORIS_PROFILE_KERNEL( "CM::flux", *this );
+
             // evaluate the flux
             this->eval_flux();
 
@@ -2863,6 +2866,8 @@ namespace moris::fem
         // if the traction was not evaluated
         if ( mTractionEval )
         {
+            MORIS_PROFILE_KERNEL( "CM::traction", *this );
+
             // evaluate the traction
             this->eval_traction( aNormal );
 
@@ -3109,6 +3114,8 @@ namespace moris::fem
         // if the derivative has not been evaluated yet
         if ( mdFluxdDofEval( tDofIndex ) )
         {
+            MORIS_PROFILE_KERNEL( "CM::dFluxdDOF", *this );
+
             // evaluate the derivative
             this->eval_dFluxdDOF( aDofType );
 
@@ -58,6 +58,7 @@
 // Logging package
 #include "cl_Logger.hpp"
 #include "cl_Tracer.hpp"
+#include "moris_openmp.hpp"
 #include "cl_FEM_Model_Initializer.hpp"
 #include "cl_FEM_Model_Initializer_Legacy.hpp"
 #include "cl_FEM_Model_Initializer_Phasebased.hpp"
@@ -543,7 +544,15 @@ namespace moris::fem
             if ( tNumClustersOnSet != 0 )
             {
                 // create new fem set
-                mFemSets( iSet ) = new fem::Set( this, tMeshSet, mSetInfo( iSet ), mIPNodes );
+                auto *tFemSet = new fem::Set( this, tMeshSet, mSetInfo( iSet ), mIPNodes );
+
+                // add the evaluation workspaces to the set
+                for ( const Vector< fem::Set_User_Info > &tWorkspaceSetInfo : mWorkspaceSetInfo )
+                {
+                    tFemSet->add_evaluation_workspace( tWorkspaceSetInfo( iSet ) );
+                }
+
+                mFemSets( iSet ) = tFemSet;
             }
             // if clusters don't exist on the set, create an empty set
             else
@@ -813,36 +822,39 @@ namespace moris::fem
          * while the new method uses phases and phase-pairs to define the applicable sets. Old input files can be detected by the number of
          * elements in the ParameterList. If it is 8, then the legacy method was used, if it is 9, the new method was used.
          */
-        std::unique_ptr< Model_Initializer > tModelInitializer;
-        switch ( mParameterList.size() )
-        {
-            case 8:
-            {
-                tModelInitializer = std::make_unique< Model_Initializer_Legacy >(
-                        mParameterList,
-                        aLibrary,
-                        tMeshPair,
-                        mSpaceDim,
-                        mUseNewGhostSets,
-                        mDofTypeToBsplineMeshIndex );
-                break;
-            }
-            case 9:
+        // creates a model initializer for the legacy or the phase based input
+        auto tCreateModelInitializer = [ & ]() -> std::unique_ptr< Model_Initializer > {
+            switch ( mParameterList.size() )
             {
-                tModelInitializer = std::make_unique< Model_Initializer_Phasebased >(
-                        mParameterList,
-                        aLibrary,
-                        tMeshPair,
-                        mSpaceDim,
-                        mUseNewGhostSets,
-                        mDofTypeToBsplineMeshIndex );
-                break;
-            }
-            default:
-            {
-                MORIS_ERROR( false, "FEM_Model::initialize - wrong size for parameter list: %u", mParameterList.size() );
+                case 8:
+                {
+                    return std::make_unique< Model_Initializer_Legacy >(
+                            mParameterList,
+                            aLibrary,
+                            tMeshPair,
+                            mSpaceDim,
+                            mUseNewGhostSets,
+                            mDofTypeToBsplineMeshIndex );
+                }
+                case 9:
+                {
+                    return std::make_unique< Model_Initializer_Phasebased >(
+                            mParameterList,
+                            aLibrary,
+                            tMeshPair,
+                            mSpaceDim,
+                            mUseNewGhostSets,
+                            mDofTypeToBsplineMeshIndex );
+                }
+                default:
+                {
+                    MORIS_ERROR( false, "FEM_Model::initialize - wrong size for parameter list: %u", mParameterList.size() );
+                    return nullptr;
+                }
             }
-        }
+        };
+
+        std::unique_ptr< Model_Initializer > tModelInitializer = tCreateModelInitializer();
 
         tModelInitializer->initialize();
 
@@ -850,6 +862,27 @@ namespace moris::fem
         mIQIs       = tModelInitializer->get_iqis();
         mFields     = tModelInitializer->get_fields();
         mFieldTypes = tModelInitializer->get_field_types();
+
+        // number of evaluation workspaces, by default one per thread
+        uint tNumWorkspaces = mParameterList( 5 )( 0 ).get< uint >( "number_of_evaluation_workspaces" );
+
+        if ( tNumWorkspaces == 0 )
+        {
+            tNumWorkspaces = omp_max_threads();
+        }
+
+        // the IWGs, IQIs and their models keep evaluation state and cannot be shared between workspaces,
+        // the input is unpacked once more for each additional workspace
+        mWorkspaceSetInfo.resize( tNumWorkspaces - 1 );
+
+        for ( Vector< fem::Set_User_Info > &tWorkspaceSetInfo : mWorkspaceSetInfo )
+        {
+            std::unique_ptr< Model_Initializer > tWorkspaceInitializer = tCreateModelInitializer();
+
+            tWorkspaceInitializer->initialize_evaluation_workspace();
+
+            tWorkspaceSetInfo = tWorkspaceInitializer->get_set_info();
+        }
     }
 
     //------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 #ifndef PROJECTS_FEM_MDL_SRC_CL_FEM_MODEL_HPP_
 #define PROJECTS_FEM_MDL_SRC_CL_FEM_MODEL_HPP_
 
+#include <atomic>
 #include <utility>
 
 #include "moris_typedefs.hpp"
@@ -112,6 +113,9 @@ namespace moris
             // unpacked fem inputs
             Vector< fem::Set_User_Info > mSetInfo;
 
+            // unpacked fem inputs with independent IWGs, IQIs and models for each additional evaluation workspace
+            Vector< Vector< fem::Set_User_Info > > mWorkspaceSetInfo;
+
             // space dimension
             uint mSpaceDim;
 
@@ -131,11 +135,11 @@ namespace moris
             bool mFEMOnly = false;
 
           public:
-            //! Gauss point information. Only used for output
-            uint mBulkGaussPoints                 = 0;
-            uint mSideSetsGaussPoints             = 0;
-            uint mDoubleSidedSideSetsGaussPoints  = 0;
-            uint mNonconformalSideSetsGaussPoints = 0;
+            //! Gauss point information. Only used for output, counted by concurrently evaluated elements
+            std::atomic< uint > mBulkGaussPoints                 = 0;
+            std::atomic< uint > mSideSetsGaussPoints             = 0;
+            std::atomic< uint > mDoubleSidedSideSetsGaussPoints  = 0;
+            std::atomic< uint > mNonconformalSideSetsGaussPoints = 0;
 
             //------------------------------------------------------------------------------
             /**
@@ -242,10 +246,10 @@ namespace moris
             inline void
             report_on_assembly() override
             {
-                uint tTotalBulkGaussPoints                 = sum_all( mBulkGaussPoints );
-                uint tTotalSideSetsGaussPoints             = sum_all( mSideSetsGaussPoints );
-                uint tTotalDoubleSidedSideSetsGaussPoints  = sum_all( mDoubleSidedSideSetsGaussPoints );
-                uint tTotalNonconformalSideSetsGaussPoints = sum_all( mNonconformalSideSetsGaussPoints );
+                uint tTotalBulkGaussPoints                 = sum_all( mBulkGaussPoints.load() );
+                uint tTotalSideSetsGaussPoints             = sum_all( mSideSetsGaussPoints.load() );
+                uint tTotalDoubleSidedSideSetsGaussPoints  = sum_all( mDoubleSidedSideSetsGaussPoints.load() );
+                uint tTotalNonconformalSideSetsGaussPoints = sum_all( mNonconformalSideSetsGaussPoints.load() );
 
                 if ( tTotalBulkGaussPoints + tTotalSideSetsGaussPoints + tTotalDoubleSidedSideSetsGaussPoints + tTotalNonconformalSideSetsGaussPoints > 0 )
                 {
@@ -15,14 +15,33 @@ namespace moris::fem
     void Model_Initializer::initialize()
     {
         this->create_properties();
-        this->create_fields();
+
+        // fields are owned by the model and are only created once
+        if ( !mIsEvaluationWorkspace )
+        {
+            this->create_fields();
+        }
+
         this->create_material_models();
         this->create_constitutive_models();
         this->create_stabilization_parameters();
         this->create_iwgs();
         this->create_iqis();
         this->create_set_info();
-        this->print_physics_model();
+
+        if ( !mIsEvaluationWorkspace )
+        {
+            this->print_physics_model();
+        }
+    }
+
+    //----------------------------------------------------------------
+
+    void Model_Initializer::initialize_evaluation_workspace()
+    {
+        mIsEvaluationWorkspace = true;
+
+        this->initialize();
     }
 
     //----------------------------------------------------------------
@@ -46,6 +46,12 @@ namespace moris::fem
 
         virtual void initialize();
 
+        /**
+         * @brief creates independent properties, models, IWGs, IQIs and set info for an evaluation workspace
+         * of the fem sets, the fields are not created and the physics model is not printed again
+         */
+        void initialize_evaluation_workspace();
+
         virtual ~Model_Initializer() = default;
 
         Vector< fem::Set_User_Info > const &get_set_info() const { return mSetInfo; }
@@ -106,6 +112,7 @@ namespace moris::fem
         bool                                             mUseNewGhostSets;
         std::unordered_map< MSI::Dof_Type, moris_index > mDofTypeToBsplineMeshIndex;
         Vector< fem::Set_User_Info >                     mSetInfo;
+        bool                                             mIsEvaluationWorkspace = false;
 
         moris::map< std::string, MSI::Dof_Type >   mMSIDofTypeMap = moris::MSI::get_msi_dof_type_map();
         moris::map< std::string, gen::PDV_Type >   mMSIDvTypeMap  = gen::get_pdv_type_map();
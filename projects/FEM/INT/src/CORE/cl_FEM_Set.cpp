@@ -36,7 +36,8 @@ namespace moris::fem
             fem::FEM_Model*             aFemModel,
             moris::mtk::Set*            aMeshSet,
             const fem::Set_User_Info&   aSetInfo,
-            const Vector< Node_Base* >& aIPNodes )
+            const Vector< Node_Base* >& aIPNodes,
+            const bool                  aIsEvaluationWorkspace )
             : mFemModel( aFemModel )
             , mMeshSet( aMeshSet )
             , mIPNodes( aIPNodes )
@@ -75,7 +76,11 @@ namespace moris::fem
             tIQI->set_set_pointer( this );
         }
 
-        this->create_fem_clusters();
+        // the equation objects are owned by the set the workspace belongs to
+        if ( !aIsEvaluationWorkspace )
+        {
+            this->create_fem_clusters();
+        }
 
         // geometry and interpolation info
 
@@ -122,12 +127,38 @@ namespace moris::fem
         }
         mEquationObjList.clear();
 
+        // delete the evaluation workspaces
+        for ( Set* tWorkspace : mEvaluationWorkspaces )
+        {
+            delete tWorkspace;
+        }
+        mEvaluationWorkspaces.clear();
+
         // delete the field interpolator pointers
         this->delete_pointers();
     }
 
     //------------------------------------------------------------------------------
 
+    void
+    Set::add_evaluation_workspace( const fem::Set_User_Info& aSetInfo )
+    {
+        // nonconformal sets are rebuilt in every iteration and are evaluated on the set itself
+        if ( mIsEmptySet || mElementType == fem::Element_Type::NONCONFORMAL_SIDESET )
+        {
+            return;
+        }
+
+        // create a set without fem clusters, the IP nodes are only needed to create the clusters
+        Set* tWorkspace = new Set( mFemModel, mMeshSet, aSetInfo, {}, true );
+
+        tWorkspace->set_equation_model( mFemModel );
+
+        mEvaluationWorkspaces.push_back( tWorkspace );
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     Set::initialize_set(
             const bool                 aIsStaggered,
@@ -155,6 +186,9 @@ namespace moris::fem
 
             this->build_requested_IQI_dof_type_list();
 
+            // keep the residual, jacobian and QI buffers if they fit the requested layout
+            this->check_workspace_layout();
+
             // set fem set pointer to IWGs FIXME still needed done in constructor?
             for ( const std::shared_ptr< IWG >& tIWG : mRequestedIWGs )
             {
@@ -166,6 +200,12 @@ namespace moris::fem
             {
                 tIQI->set_set_pointer( this );
             }
+
+            // initialize the evaluation workspaces for the same request
+            for ( Set* tWorkspace : mEvaluationWorkspaces )
+            {
+                tWorkspace->initialize_set( aIsStaggered, aTimeContinuityOnlyFlag );
+            }
         }
     }
 
@@ -196,6 +236,9 @@ namespace moris::fem
     {
         if ( !mIsEmptySet )    // FIXME this flag is a hack. find better solution
         {
+            // release the residual, jacobian and QI buffers sized for the previous model
+            this->release_matrix_memory();
+
             // delete the field interpolator pointers
             this->delete_pointers();
 
@@ -213,6 +256,14 @@ namespace moris::fem
 
             // set field interpolator managers for the IQIs
             this->set_IQI_field_interpolator_managers();
+
+            // finalize the evaluation workspaces
+            for ( Set* tWorkspace : mEvaluationWorkspaces )
+            {
+                tWorkspace->set_model_solver_interface( aModelSolverInterface );
+
+                tWorkspace->finalize( aModelSolverInterface );
+            }
         }
     }
 
@@ -225,6 +276,11 @@ namespace moris::fem
         {
             tIWG->free_memory();
         }
+
+        for ( Set* tWorkspace : mEvaluationWorkspaces )
+        {
+            tWorkspace->free_matrix_memory();
+        }
     }
 
     //------------------------------------------------------------------------------
@@ -1250,6 +1306,17 @@ namespace moris::fem
             // create the field interpolators on the leader FI manager
             mLeaderEigenFIManager->create_field_interpolators( aModelSolverInterface, mNumEigenVectors );
         }
+
+        // tabulate shape functions at the integration points, bulk elements evaluate all interpolators there
+        if ( mElementType == fem::Element_Type::BULK && mIntegPoints.numel() > 0 )
+        {
+            mLeaderFIManager->set_shape_function_tables( mIntegPoints );
+
+            if ( mLeaderEigenFIManager != nullptr )
+            {
+                mLeaderEigenFIManager->set_shape_function_tables( mIntegPoints );
+            }
+        }
     }
 
     //------------------------------------------------------------------------------
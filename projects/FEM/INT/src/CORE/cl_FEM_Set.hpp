@@ -175,6 +175,10 @@ namespace moris
             // enum for perturbation strategy used for FD (FA and SA)
             fem::Perturbation_Type mPerturbationStrategy = fem::Perturbation_Type::RELATIVE;
 
+            // copies of the set evaluation state, built from independent set user info, on which
+            // the equation objects of this set are evaluated concurrently (owned by this set)
+            Vector< Set* > mEvaluationWorkspaces;
+
             friend class MSI::Equation_Object;
             friend class Cluster;
             friend class Element_Bulk;
@@ -206,12 +210,15 @@ namespace moris
              * @param[ in ] aMeshSet  a set from the mesh
              * @param[ in ] aSetInfo  user defined info for set
              * @param[ in ] aIPNodes  cell of node pointers
+             * @param[ in ] aIsEvaluationWorkspace true if the set only holds evaluation state for another set,
+             *                                     no fem clusters are created
              */
             Set(
                     fem::FEM_Model*             aFemModel,
                     moris::mtk::Set*            aMeshSet,
                     const fem::Set_User_Info&   aSetInfo,
-                    const Vector< Node_Base* >& aIPNodes );
+                    const Vector< Node_Base* >& aIPNodes,
+                    const bool                  aIsEvaluationWorkspace = false );
 
             //------------------------------------------------------------------------------
             /**
@@ -246,6 +253,33 @@ namespace moris
 
             void update() override;
 
+            //------------------------------------------------------------------------------
+            /**
+             * add an evaluation workspace to the set, i.e. a copy of the set built from independent
+             * IWGs, IQIs and their constitutive models, stabilization parameters and properties
+             * @param[ in ] aSetInfo user defined info for set, not shared with this set or another workspace
+             */
+            void add_evaluation_workspace( const fem::Set_User_Info& aSetInfo );
+
+            //------------------------------------------------------------------------------
+
+            uint
+            get_number_of_evaluation_workspaces() override
+            {
+                return mEvaluationWorkspaces.size() + 1;
+            }
+
+            //------------------------------------------------------------------------------
+
+            MSI::Equation_Set*
+            get_evaluation_workspace( const uint aWorkspace ) override
+            {
+                MORIS_ASSERT( aWorkspace <= mEvaluationWorkspaces.size(),
+                        "Set::get_evaluation_workspace - workspace index out of bounds" );
+
+                return aWorkspace == 0 ? this : mEvaluationWorkspaces( aWorkspace - 1 );
+            }
+
             //------------------------------------------------------------------------------
 
             fem::FEM_Model*
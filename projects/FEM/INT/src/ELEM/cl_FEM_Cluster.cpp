@@ -222,6 +222,20 @@ namespace moris::fem
 
     //------------------------------------------------------------------------------
 
+    void
+    Cluster::set_set( Set *aSet )
+    {
+        mSet = aSet;
+
+        // loop over the IG elements and rebind them to the set
+        for ( fem::Element *tElement : mElements )
+        {
+            tElement->set_set( aSet );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     Matrix< IndexMat > &
     Cluster::get_side_ordinal_info(
             mtk::Leader_Follower aIsLeader )
@@ -141,6 +141,13 @@ namespace moris::fem
             return mElements;
         }
 
+        //------------------------------------------------------------------------------
+        /**
+         * set the fem set used by the cluster and its elements
+         * @param[ in ] aSet a fem set or one of its evaluation workspaces
+         */
+        void set_set( Set *aSet );
+
         //------------------------------------------------------------------------------
 
         /**
@@ -30,6 +30,7 @@
 
 #include "cl_FEM_Set.hpp"        //FEM/INT/src
 #include "cl_FEM_Cluster.hpp"    //FEM/INT/src
+#include "cl_Kernel_Profiler.hpp"
 
 namespace moris::fem
 {
@@ -183,6 +184,17 @@ namespace moris::fem
          */
         virtual ~Element(){};
 
+        //------------------------------------------------------------------------------
+        /**
+         * set the fem set used for the evaluation of the element
+         * @param[ in ] aSet a fem set or one of its evaluation workspaces
+         */
+        void
+        set_set( Set *aSet )
+        {
+            mSet = aSet;
+        }
+
         //------------------------------------------------------------------------------
         /**
          * set function pointers for analytical and FD
@@ -228,6 +240,21 @@ namespace moris::fem
             }
         }
 
+        //------------------------------------------------------------------------------
+        /**
+         * compute residual
+         */
+        void
+        select_residual(
+                const std::shared_ptr< IWG > &aReqIWG,
+                real                          aWStar )
+        {
+            MORIS_PROFILE_KERNEL( "IWG::compute_residual", *aReqIWG );
+
+            // compute residual
+            aReqIWG->compute_residual( aWStar );
+        }
+
         //------------------------------------------------------------------------------
         /**
          * select jacobian
@@ -237,6 +264,8 @@ namespace moris::fem
                 const std::shared_ptr< IWG > &aReqIWG,
                 real                          aWStar )
         {
+            MORIS_PROFILE_KERNEL( "IWG::compute_jacobian", *aReqIWG );
+
             // compute Jacobian
             aReqIWG->compute_jacobian( aWStar );
         }
@@ -246,6 +275,8 @@ namespace moris::fem
                 const std::shared_ptr< IWG > &aReqIWG,
                 real                          aWStar )
         {
+            MORIS_PROFILE_KERNEL( "IWG::compute_jacobian_FD", *aReqIWG );
+
             // compute Jacobian
             aReqIWG->compute_jacobian_FD( aWStar, mFAFDPerturbation, mFAFDScheme );
         }
@@ -183,7 +183,7 @@ namespace moris::fem
                         mCluster->mInterpolationElement->get_weak_bcs() );
 
                 // compute residual at evaluation point
-                tReqIWG->compute_residual( tWStar );
+                this->select_residual( tReqIWG, tWStar );
 
                 // compute off-diagonal Jacobian for staggered solve
                 ( this->*m_compute_jacobian )( tReqIWG, tWStar );
@@ -312,7 +312,7 @@ namespace moris::fem
                 if ( mSet->mEquationModel->is_forward_analysis() )
                 {
                     // compute residual at evaluation point
-                    tReqIWG->compute_residual( tWStar );
+                    this->select_residual( tReqIWG, tWStar );
                 }
 
                 // compute Jacobian at evaluation point
@@ -203,7 +203,7 @@ namespace moris::fem
                 tReqIWG->set_normal( tNormal );
 
                 // compute residual at integration point
-                tReqIWG->compute_residual( tWStar );
+                this->select_residual( tReqIWG, tWStar );
 
                 // compute Jacobian at integration point
                 // compute off-diagonal Jacobian for staggered solve
@@ -333,7 +333,7 @@ namespace moris::fem
                 if ( mSet->mEquationModel->is_forward_analysis() )
                 {
                     // compute residual at integration point
-                    tReqIWG->compute_residual( tWStar );
+                    this->select_residual( tReqIWG, tWStar );
                 }
 
                 // compute jacobian at integration point
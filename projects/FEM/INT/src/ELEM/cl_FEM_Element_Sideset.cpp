@@ -179,7 +179,7 @@ namespace moris::fem
                 tReqIWG->set_normal( tNormal );
 
                 // compute residual at integration point
-                tReqIWG->compute_residual( tWStar );
+                this->select_residual( tReqIWG, tWStar );
 
                 // compute Jacobian at evaluation point
                 // compute off-diagonal Jacobian for staggered solve
@@ -323,7 +323,7 @@ namespace moris::fem
                 if ( mSet->mEquationModel->is_forward_analysis() )
                 {
                     // compute residual at integration point
-                    tReqIWG->compute_residual( tWStar );
+                    this->select_residual( tReqIWG, tWStar );
                 }
 
                 // compute Jacobian at evaluation point
@@ -177,7 +177,7 @@ namespace moris::fem
                 tReqIWG->reset_eval_flags();
 
                 // compute Jacobian at evaluation point
-                tReqIWG->compute_residual( tWStar );
+                this->select_residual( tReqIWG, tWStar );
 
                 // compute Jacobian at evaluation point
                 // compute off-diagonal Jacobian for staggered solve
@@ -310,7 +310,7 @@ namespace moris::fem
                 if ( mSet->mEquationModel->is_forward_analysis() )
                 {
                     // compute Jacobian at evaluation point
-                    tReqIWG->compute_residual( tWStar );
+                    this->select_residual( tReqIWG, tWStar );
                 }
 
                 // compute Jacobian at evaluation point
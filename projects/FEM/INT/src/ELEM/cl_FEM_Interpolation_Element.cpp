@@ -128,6 +128,24 @@ namespace moris::fem
 
     //------------------------------------------------------------------------------
 
+    void
+    Interpolation_Element::set_equation_set( MSI::Equation_Set* aEquationSet )
+    {
+        // set the equation set of the underlying equation object
+        MSI::Equation_Object::set_equation_set( aEquationSet );
+
+        // set the fem set used by the interpolation element
+        mSet = static_cast< Set* >( aEquationSet );
+
+        // rebind the forward analysis cluster and its elements, visualization clusters are not evaluated on workspaces
+        if ( mFemCluster.size() > 0 )
+        {
+            mFemCluster( 0 )->set_set( mSet );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     Interpolation_Element::set_field_interpolators_coefficients()
     {
@@ -91,6 +91,13 @@ namespace moris::fem
          */
         ~Interpolation_Element() override {};
 
+        //------------------------------------------------------------------------------
+        /**
+         * rebind the interpolation element and its fem cluster to an evaluation workspace of its set
+         * @param[ in ] aEquationSet a fem set
+         */
+        void set_equation_set( MSI::Equation_Set* aEquationSet ) override;
+
         //------------------------------------------------------------------------------
         /**
          * get ip cell
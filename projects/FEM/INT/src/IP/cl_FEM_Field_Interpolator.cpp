@@ -182,16 +182,19 @@ namespace moris::fem
     Field_Interpolator::reset_eval_flags()
     {
         // reset bool for evaluation
-        mNEval           = true;
-        mNTransEval      = true;
-        mNBuildEval      = true;
-        mdNdxEval        = true;
-        md2Ndx2Eval      = true;
-        md3Ndx3Eval      = true;
-        mdNdtEval        = true;
-        md2Ndt2Eval      = true;
-        md2NdxtEval      = true;
-        mDivOperatorEval = true;
+        mNSpaceEval       = true;
+        mdNSpacedXiEval   = true;
+        md2NSpacedXi2Eval = true;
+        mNEval            = true;
+        mNTransEval       = true;
+        mNBuildEval       = true;
+        mdNdxEval         = true;
+        md2Ndx2Eval       = true;
+        md3Ndx3Eval       = true;
+        mdNdtEval         = true;
+        md2Ndt2Eval       = true;
+        md2NdxtEval       = true;
+        mDivOperatorEval  = true;
 
         mValEval      = true;
         mValTransEval = true;
@@ -237,6 +240,24 @@ namespace moris::fem
 
     //------------------------------------------------------------------------------
 
+    void
+    Field_Interpolator::set_shape_function_table( const Matrix< DDRMat >& aParamPoints )
+    {
+        // check input size aParamPoints
+        MORIS_ASSERT( aParamPoints.n_rows() >= mNSpaceParamDim,
+                "Field_Interpolator::set_shape_function_table - Wrong input size ( aParamPoints )." );
+
+        // get the shared table for the space interpolation function at these points
+        mShapeFunctionTable = mtk::Interpolation_Function_Table::get_table(
+                mGeometryInterpolator->get_space_geometry_type(),
+                mSpaceInterpolation,
+                aParamPoints( { 0, mNSpaceParamDim - 1 }, { 0, aParamPoints.n_cols() - 1 } ) );
+
+        mTablePointIndex = -1;
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     Field_Interpolator::set_space_time( const Matrix< DDRMat >& aParamPoint )
     {
@@ -283,6 +304,12 @@ namespace moris::fem
         mXi  = aParamPoint( { 0, mNSpaceParamDim - 1 }, { 0, 0 } );
         mTau = aParamPoint( mNSpaceParamDim );
 
+        // look up evaluation point in shape function table, integration points are visited in order
+        if ( mShapeFunctionTable != nullptr )
+        {
+            mTablePointIndex = mShapeFunctionTable->find_point( mXi, mTablePointIndex + 1 );
+        }
+
         // reset bool for evaluation
         this->reset_eval_flags();
         this->reset_eval_flags_coefficients();
@@ -306,6 +333,81 @@ namespace moris::fem
 
     //------------------------------------------------------------------------------
 
+    const Matrix< DDRMat >&
+    Field_Interpolator::NSpace()
+    {
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            return mShapeFunctionTable->N( mTablePointIndex );
+        }
+
+        // if space shape functions need to be evaluated
+        if ( mNSpaceEval )
+        {
+            // evaluate the space shape functions
+            mSpaceInterpolation->eval_N( mXi, mNSpace );
+
+            // set bool for evaluation
+            mNSpaceEval = false;
+        }
+
+        // return member value
+        return mNSpace;
+    }
+
+    //------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >&
+    Field_Interpolator::dNSpacedXi()
+    {
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            return mShapeFunctionTable->dNdXi( mTablePointIndex );
+        }
+
+        // if space shape function derivatives need to be evaluated
+        if ( mdNSpacedXiEval )
+        {
+            // evaluate the space shape function derivatives
+            mSpaceInterpolation->eval_dNdXi( mXi, mdNSpacedXi );
+
+            // set bool for evaluation
+            mdNSpacedXiEval = false;
+        }
+
+        // return member value
+        return mdNSpacedXi;
+    }
+
+    //------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >&
+    Field_Interpolator::d2NSpacedXi2()
+    {
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            return mShapeFunctionTable->d2NdXi2( mTablePointIndex );
+        }
+
+        // if space shape function second derivatives need to be evaluated
+        if ( md2NSpacedXi2Eval )
+        {
+            // evaluate the space shape function second derivatives
+            mSpaceInterpolation->eval_d2NdXi2( mXi, md2NSpacedXi2 );
+
+            // set bool for evaluation
+            md2NSpacedXi2Eval = false;
+        }
+
+        // return member value
+        return md2NSpacedXi2;
+    }
+
+    //------------------------------------------------------------------------------
+
     const Matrix< DDRMat >&
     Field_Interpolator::NBuild()
     {
@@ -336,10 +438,9 @@ namespace moris::fem
                 "Field_Interpolator::eval_NBuild - mTau is not set." );
 
         // evaluate space and time SF at Xi, Tau
-        Matrix< DDRMat > tNSpace;
-        Matrix< DDRMat > tNTime;
+        const Matrix< DDRMat >& tNSpace = this->NSpace();
 
-        mSpaceInterpolation->eval_N( mXi, tNSpace );
+        Matrix< DDRMat > tNTime;
         mTimeInterpolation->eval_N( mTau, tNTime );
 
         // evaluate space time SF by multiplying space and time SF and create row vector
@@ -470,8 +571,7 @@ namespace moris::fem
                 "Field_Interpolator::eval_d1Ndx1 - mTau is not set." );
 
         // evaluate dNSpacedXi for the space interpolation
-        Matrix< DDRMat > tdNSpacedXi;
-        mSpaceInterpolation->eval_dNdXi( mXi, tdNSpacedXi );
+        const Matrix< DDRMat >& tdNSpacedXi = this->dNSpacedXi();
 
         // evaluate the space Jacobian from the geometry interpolator
         const Matrix< DDRMat >& tInvJGeot = mGeometryInterpolator->inverse_space_jacobian();
@@ -517,8 +617,7 @@ namespace moris::fem
         const Matrix< DDRMat >& tdNFielddx = this->dnNdxn( 1 );
 
         // evaluate d2Ndxi2 for the field space interpolation
-        Matrix< DDRMat > td2NSpacedxi2;
-        mSpaceInterpolation->eval_d2NdXi2( mXi, td2NSpacedxi2 );
+        const Matrix< DDRMat >& td2NSpacedxi2 = this->d2NSpacedXi2();
 
         // evaluate NTime for the time interpolation
         Matrix< DDRMat > tNTime;
@@ -661,8 +760,7 @@ namespace moris::fem
         const Matrix< DDRMat > tdNTimedt = tInvJGeot * tdNTimedtau;
 
         // evaluate N for the field space interpolation
-        Matrix< DDRMat > tNSpace;
-        mSpaceInterpolation->eval_N( mXi, tNSpace );
+        const Matrix< DDRMat >& tNSpace = this->NSpace();
 
         // build the space time dNdTau row by row
         for ( moris::uint Ik = 0; Ik < mNTimeBases; Ik++ )
@@ -698,8 +796,7 @@ namespace moris::fem
         Matrix< DDRMat > tdNFielddt = this->dnNdtn( 1 );
 
         // get space SF from the space interpolation
-        Matrix< DDRMat > tNSpace;
-        mSpaceInterpolation->eval_N( mXi, tNSpace );
+        const Matrix< DDRMat >& tNSpace = this->NSpace();
 
         // get d2Ndtau2 for the time interpolation
         Matrix< DDRMat > td2NTimedtau2;
@@ -763,8 +860,7 @@ namespace moris::fem
         Matrix< DDRMat > tdNTimedT = tdNTimedTau / tJGeoTimet( 0 );
 
         // evaluate dNSpacedXi for the field space interpolation
-        Matrix< DDRMat > tdNSpacedXi;
-        mSpaceInterpolation->eval_dNdXi( mXi, tdNSpacedXi );
+        const Matrix< DDRMat >& tdNSpacedXi = this->dNSpacedXi();
 
         // evaluate the space Jacobian from the geometry interpolator
         const Matrix< DDRMat >& tInvJGeoSpacet = mGeometryInterpolator->inverse_space_jacobian();
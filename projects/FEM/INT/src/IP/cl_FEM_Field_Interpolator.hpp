@@ -19,6 +19,7 @@
 #include "linalg_typedefs.hpp"
 // FEM/INT/src
 #include "cl_MTK_Interpolation_Rule.hpp"
+#include "cl_MTK_Interpolation_Function_Table.hpp"
 #include "cl_FEM_Geometry_Interpolator.hpp"
 // FEM/MSI/src
 #include "cl_MSI_Dof_Type_Enums.hpp"
@@ -45,6 +46,10 @@ namespace moris::fem
         mtk::Interpolation_Function_Base* mSpaceInterpolation = nullptr;
         mtk::Interpolation_Function_Base* mTimeInterpolation  = nullptr;
 
+        // space shape functions tabulated at the integration points, index of the current point in the table
+        const mtk::Interpolation_Function_Table* mShapeFunctionTable = nullptr;
+        sint                                     mTablePointIndex    = -1;
+
         // space and time geometry interpolator
         Geometry_Interpolator* mGeometryInterpolator = nullptr;
 
@@ -80,16 +85,19 @@ namespace moris::fem
         Vector< mtk::Field_Type > mFieldType;
 
         // flag for evaluation
-        bool mNBuildEval      = true;
-        bool mNEval           = true;
-        bool mNTransEval      = true;
-        bool mdNdxEval        = true;
-        bool md2Ndx2Eval      = true;
-        bool md3Ndx3Eval      = true;
-        bool mdNdtEval        = true;
-        bool md2Ndt2Eval      = true;
-        bool md2NdxtEval      = true;
-        bool mDivOperatorEval = true;
+        bool mNSpaceEval       = true;
+        bool mdNSpacedXiEval   = true;
+        bool md2NSpacedXi2Eval = true;
+        bool mNBuildEval       = true;
+        bool mNEval            = true;
+        bool mNTransEval       = true;
+        bool mdNdxEval         = true;
+        bool md2Ndx2Eval       = true;
+        bool md3Ndx3Eval       = true;
+        bool mdNdtEval         = true;
+        bool md2Ndt2Eval       = true;
+        bool md2NdxtEval       = true;
+        bool mDivOperatorEval  = true;
 
         bool mValEval      = true;
         bool mValTransEval = true;
@@ -105,6 +113,9 @@ namespace moris::fem
         bool mGradxtEval = true;
 
         // storage
+        Matrix< DDRMat > mNSpace;
+        Matrix< DDRMat > mdNSpacedXi;
+        Matrix< DDRMat > md2NSpacedXi2;
         Matrix< DDRMat > mNBuild;
         Matrix< SDRMat > mN;
         Matrix< SDRMat > mNTrans;
@@ -321,6 +332,15 @@ namespace moris::fem
 
         void set_discretization_mesh_index( const moris_index aDiscretizationMeshIndex );
 
+        //------------------------------------------------------------------------------
+        /**
+         * set the points at which the space shape functions and their derivatives are tabulated,
+         * evaluation points matching one of these points use the tabulated values
+         * @param[ in ] aParamPoints points in space and time, only the space rows are used
+         *                           ( <number of space param dimensions> + 1 x <number of points> )
+         */
+        void set_shape_function_table( const Matrix< DDRMat >& aParamPoints );
+
         //------------------------------------------------------------------------------
         /**
          * set the parametric point where field is interpolated
@@ -560,6 +580,30 @@ namespace moris::fem
          */
         void eval_gradxt();
 
+        //------------------------------------------------------------------------------
+
+      private:
+        //------------------------------------------------------------------------------
+        /**
+         * space shape functions at the evaluation point, tabulated or evaluated
+         * @param[ out ] mNSpace ( 1 x <number of space bases> )
+         */
+        const Matrix< DDRMat >& NSpace();
+
+        //------------------------------------------------------------------------------
+        /**
+         * first parametric derivatives of the space shape functions at the evaluation point
+         * @param[ out ] mdNSpacedXi ( <number of space param dimensions> x <number of space bases> )
+         */
+        const Matrix< DDRMat >& dNSpacedXi();
+
+        //------------------------------------------------------------------------------
+        /**
+         * second parametric derivatives of the space shape functions at the evaluation point
+         * @param[ out ] md2NSpacedXi2 ( <1D:1, 2D:3, 3D:6> x <number of space bases> )
+         */
+        const Matrix< DDRMat >& d2NSpacedXi2();
+
         //------------------------------------------------------------------------------
     };
 
@@ -488,6 +488,52 @@ namespace moris::fem
 
     //------------------------------------------------------------------------------
 
+    void
+    Field_Interpolator_Manager::set_shape_function_tables(
+            const Matrix< DDRMat >& aIntegPoints )
+    {
+        // IG geometry interpolator is evaluated at the integration points
+        mIGGeometryInterpolator->set_shape_function_table( aIntegPoints );
+
+        // IP interpolators are evaluated at the integration points mapped into the IP param space,
+        // these only coincide with the integration points if IG and IP cells are of the same type
+        if ( reinterpret_cast< Set* >( mEquationSet )->mIGGeometryType !=    //
+                reinterpret_cast< Set* >( mEquationSet )->mIPGeometryType )
+        {
+            return;
+        }
+
+        // IP geometry interpolator
+        mIPGeometryInterpolator->set_shape_function_table( aIntegPoints );
+
+        // dof, dv and field field interpolators
+        for ( Field_Interpolator* tFI : mFI )
+        {
+            if ( tFI != nullptr )
+            {
+                tFI->set_shape_function_table( aIntegPoints );
+            }
+        }
+
+        for ( Field_Interpolator* tFI : mDvFI )
+        {
+            if ( tFI != nullptr )
+            {
+                tFI->set_shape_function_table( aIntegPoints );
+            }
+        }
+
+        for ( Field_Interpolator* tFI : mFieldFI )
+        {
+            if ( tFI != nullptr )
+            {
+                tFI->set_shape_function_table( aIntegPoints );
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     Field_Interpolator_Manager::set_coeff_for_type(
             const enum MSI::Dof_Type aDofType,
@@ -283,6 +283,14 @@ namespace moris::fem
          */
         void set_space_time_from_local_IG_point( const Matrix< DDRMat >& aLocalParamPoint );
 
+        //------------------------------------------------------------------------------
+        /**
+         * tabulate the space shape functions of the geometry and field interpolators
+         * at the integration points of the set
+         * @param[ in ] aIntegPoints integration points in the IG param space
+         */
+        void set_shape_function_tables( const Matrix< DDRMat >& aIntegPoints );
+
         //------------------------------------------------------------------------------
         /**
          * set coefficients for field interpolator with specific dof type
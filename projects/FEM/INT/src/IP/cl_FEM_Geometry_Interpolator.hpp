@@ -399,6 +399,18 @@ namespace moris::fem
             return mTauHat;
         }
 
+        //------------------------------------------------------------------------------
+        /**
+         * set the points at which the space shape functions and their derivatives are tabulated
+         * @param[ in ] aParamPoints points in space and time
+         *                           ( <number of space param dimensions> + 1 x <number of points> )
+         */
+        void
+        set_shape_function_table( const Matrix< DDRMat >& aParamPoints )
+        {
+            mSpaceInterpolator->set_shape_function_table( aParamPoints );
+        }
+
         //------------------------------------------------------------------------------
         /**
          * set the parametric point where geometry is interpolated
@@ -14,6 +14,7 @@
 #include "cl_FEM_Set.hpp"
 #include "cl_FEM_Field_Interpolator_Manager.hpp"
 #include "cl_FEM_Cluster_Measure.hpp"
+#include "cl_Kernel_Profiler.hpp"
 
 namespace moris::fem
 {
@@ -1624,6 +1625,8 @@ namespace moris::fem
         // if the penalty parameter was not evaluated
         if ( mPPEval )
         {
+            MORIS_PROFILE_KERNEL( "SP::val", *this );
+
             // evaluate the penalty parameter
             this->eval_SP();
 
@@ -16,6 +16,10 @@
 #undef protected
 #undef private
 
+#include "cl_MTK_Integrator.hpp"    //MTK/src
+#include "fn_norm.hpp"              //LINALG/src
+#include "op_minus.hpp"             //LINALG/src
+
 using namespace moris;
 using namespace fem;
 
@@ -576,3 +580,120 @@ TEST_CASE( "FI_vectorialField", "[moris],[fem],[FI_vectorialField]" )
     }
     REQUIRE( tCheckTestN );
 }
+
+// This test case checks that tabulated shape functions match evaluated ones.
+TEST_CASE( "FI_Shape_Function_Table", "[moris],[fem],[FI_Shape_Function_Table]" )
+{
+    // define an epsilon environment
+    real tEpsilon = 1E-12;
+
+    // geometry interpolator
+    //------------------------------------------------------------------------------
+
+    //create a distorted quad4 space element
+    Matrix< DDRMat > tXHat = { { 0.0, 0.0 },
+            { 2.0, 0.2 },
+            { 2.3, 1.9 },
+            { -0.1, 1.5 } };
+
+    //create a line time element
+    Matrix< DDRMat > tTHat = { { 0.0 }, { 1.0 } };
+
+    //create a space geometry interpolation rule
+    mtk::Interpolation_Rule tGeomInterpRule(
+            mtk::Geometry_Type::QUAD,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR );
+
+    //create a space and a time geometry interpolator
+    Geometry_Interpolator tGeomInterpolator( tGeomInterpRule );
+
+    //set the coefficients xHat, tHat
+    tGeomInterpolator.set_coeff( tXHat, tTHat );
+
+    // field interpolators
+    //------------------------------------------------------------------------------
+
+    //create a space time interpolation rule
+    mtk::Interpolation_Rule tInterpolationRule(
+            mtk::Geometry_Type::QUAD,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::QUADRATIC,
+            mtk::Interpolation_Type::LAGRANGE,
+            mtk::Interpolation_Order::LINEAR );
+
+    //create a field interpolator evaluating and one tabulating the shape functions
+    Field_Interpolator tFieldInterpolator( 1, tInterpolationRule, &tGeomInterpolator, { MSI::Dof_Type::TEMP } );
+    Field_Interpolator tTabulatedFieldInterpolator( 1, tInterpolationRule, &tGeomInterpolator, { MSI::Dof_Type::TEMP } );
+
+    // get integration points
+    mtk::Integration_Rule tIntegrationRule(
+            mtk::Geometry_Type::QUAD,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::QUAD_3x3,
+            mtk::Integration_Type::GAUSS,
+            mtk::Integration_Order::BAR_2 );
+
+    mtk::Integrator tIntegrator( tIntegrationRule );
+
+    Matrix< DDRMat > tIntegPoints;
+    tIntegrator.get_points( tIntegPoints );
+
+    // tabulate shape functions at the integration points
+    tTabulatedFieldInterpolator.set_shape_function_table( tIntegPoints );
+
+    // check that the table is shared and finds the integration points
+    mtk::Interpolation_Function_Base* tSpaceInterpolation = tInterpolationRule.create_space_interpolation_function();
+
+    Matrix< DDRMat > tSpaceIntegPoints = tIntegPoints( { 0, 1 }, { 0, tIntegPoints.n_cols() - 1 } );
+
+    const mtk::Interpolation_Function_Table* tTable =
+            mtk::Interpolation_Function_Table::get_table( mtk::Geometry_Type::QUAD, tSpaceInterpolation, tSpaceIntegPoints );
+
+    REQUIRE( tTable == mtk::Interpolation_Function_Table::get_table( mtk::Geometry_Type::QUAD, tSpaceInterpolation, tSpaceIntegPoints ) );
+    REQUIRE( tTable->get_number_of_points() == tIntegPoints.n_cols() );
+
+    for ( uint iPoint = 0; iPoint < tIntegPoints.n_cols(); iPoint++ )
+    {
+        CHECK( tTable->find_point( tSpaceIntegPoints.get_column( iPoint ), 0 ) == (sint)iPoint );
+    }
+
+    CHECK( tTable->find_point( { { 0.35 }, { -0.2 } }, 0 ) == -1 );
+
+    delete tSpaceInterpolation;
+
+    //set the coefficients uHat
+    uint             tNumBases = tFieldInterpolator.get_number_of_space_time_bases();
+    Matrix< DDRMat > tUHat( tNumBases, 1 );
+    for ( uint iBase = 0; iBase < tNumBases; iBase++ )
+    {
+        tUHat( iBase ) = 0.3 * iBase - 0.01 * iBase * iBase;
+    }
+
+    tFieldInterpolator.set_coeff( tUHat );
+    tTabulatedFieldInterpolator.set_coeff( tUHat );
+
+    // check evaluations at the integration points and at an arbitrary point
+    Matrix< DDRMat > tOffPoint = { { 0.35 }, { -0.2 }, { 0.7 } };
+
+    for ( uint iPoint = 0; iPoint <= tIntegPoints.n_cols(); iPoint++ )
+    {
+        bool tIsIntegPoint = iPoint < tIntegPoints.n_cols();
+
+        Matrix< DDRMat > tParamPoint = tIsIntegPoint ? Matrix< DDRMat >( tIntegPoints.get_column( iPoint ) ) : tOffPoint;
+
+        //set the evaluation point xi, tau
+        tGeomInterpolator.set_space_time( tParamPoint );
+        tFieldInterpolator.set_space_time( tParamPoint );
+        tTabulatedFieldInterpolator.set_space_time( tParamPoint );
+
+        CHECK( norm( tTabulatedFieldInterpolator.NBuild() - tFieldInterpolator.NBuild() ) < tEpsilon );
+        CHECK( norm( tTabulatedFieldInterpolator.val() - tFieldInterpolator.val() ) < tEpsilon );
+        CHECK( norm( tTabulatedFieldInterpolator.gradx( 1 ) - tFieldInterpolator.gradx( 1 ) ) < tEpsilon );
+        CHECK( norm( tTabulatedFieldInterpolator.gradx( 2 ) - tFieldInterpolator.gradx( 2 ) ) < tEpsilon );
+        CHECK( norm( tTabulatedFieldInterpolator.gradt( 1 ) - tFieldInterpolator.gradt( 1 ) ) < tEpsilon );
+        CHECK( norm( tTabulatedFieldInterpolator.gradxt() - tFieldInterpolator.gradxt() ) < tEpsilon );
+    }
+}
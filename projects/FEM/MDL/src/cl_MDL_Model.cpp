@@ -42,6 +42,7 @@
 // Logger package
 #include "cl_Logger.hpp"
 #include "cl_Tracer.hpp"
+#include "cl_Kernel_Profiler.hpp"
 
 #include "cl_Library_IO.hpp"
 
@@ -401,12 +402,20 @@ namespace moris::mdl
             Tracer tTracer( "MDL", "Model", "Perform Forward Analysis" );
 
             this->perform_forward_analysis();
+
+#ifdef MORIS_USE_KERNEL_PROFILING
+            Kernel_Profiler::report( "Forward Analysis" );
+#endif
         }
         else if ( aIndex == 1 )
         {
             Tracer tTracer( "MDL", "Model", "Perform Sensitivity Analysis" );
 
             this->perform_sensitivity_analysis();
+
+#ifdef MORIS_USE_KERNEL_PROFILING
+            Kernel_Profiler::report( "Sensitivity Analysis" );
+#endif
         }
     }
 
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * UT_MDL_Threaded_Assembly.cpp
+ *
+ */
+
+#include "catch.hpp"
+
+#include "moris_typedefs.hpp"
+#include "moris_openmp.hpp"
+
+#include "cl_MTK_Mesh_Manager.hpp"
+
+#include "cl_Matrix.hpp"    //LINALG
+#include "linalg_typedefs.hpp"
+#include "fn_norm.hpp"
+
+#include "cl_FEM_Model.hpp"    //FEM/INT/src
+
+#include "cl_MSI_Model_Solver_Interface.hpp"
+#include "cl_MSI_Solver_Interface.hpp"
+
+#include "cl_HMR_Mesh_Interpolation.hpp"
+#include "cl_HMR_Mesh_Integration.hpp"
+#include "cl_HMR.hpp"
+#include "cl_HMR_Parameters.hpp"    //HMR/src
+
+#include "cl_DLA_Solver_Factory.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+
+#include "fn_PRM_FEM_Parameters.hpp"
+#include "fn_PRM_MSI_Parameters.hpp"
+#include "cl_Module_Parameter_Lists.hpp"
+
+namespace moris
+{
+    // assembles the residual and the jacobian applied to the free solution vector
+    // with the requested number of threads
+    void
+    tAssemble_MDLThreadedAssembly(
+            MSI::MSI_Solver_Interface* aSolverInterface,
+            const int                  aNumThreads,
+            Matrix< DDRMat >&          aResidual,
+            Matrix< DDRMat >&          aJacobianTimesSolution )
+    {
+        int tNumThreads = omp_max_threads();
+        omp_set_max_threads( aNumThreads );
+
+        dla::Solver_Factory  tSolFactory;
+        dla::Linear_Problem* tLinProblem = tSolFactory.create_linear_system( aSolverInterface, sol::MapType::Epetra );
+
+        // use the same nonuniform solution for both assemblies
+        sol::Dist_Vector* tFullSolution = tLinProblem->get_full_solver_LHS();
+        real*             tFullValues   = tFullSolution->get_values_pointer();
+        for ( sint iDof = 0; iDof < tFullSolution->vec_local_length(); iDof++ )
+        {
+            tFullValues[ iDof ] = 0.1 * iDof + 1.0;
+        }
+
+        aSolverInterface->set_solution_vector( tFullSolution );
+        aSolverInterface->set_solution_vector_prev_time_step( tFullSolution );
+        aSolverInterface->set_time( { { 0.0 }, { 1.0 } } );
+
+        tLinProblem->assemble_residual_and_jacobian();
+
+        tLinProblem->get_solver_RHS()->extract_copy( aResidual );
+
+        // apply the jacobian to a nonuniform vector to compare all its entries
+        sol::Dist_Vector* tFreeVector = tLinProblem->get_free_solver_LHS();
+        real*             tFreeValues = tFreeVector->get_values_pointer();
+        for ( sint iDof = 0; iDof < tFreeVector->vec_local_length(); iDof++ )
+        {
+            tFreeValues[ iDof ] = 0.3 * iDof - 2.0;
+        }
+
+        tLinProblem->get_matrix()->mat_vec_product( *tFreeVector, *tLinProblem->get_solver_RHS(), false );
+        tLinProblem->get_solver_RHS()->extract_copy( aJacobianTimesSolution );
+
+        omp_set_max_threads( tNumThreads );
+
+        delete tLinProblem;
+    }
+
+    TEST_CASE( "MDL Threaded Assembly", "[MDL_Threaded_Assembly]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // create settings object
+            moris::hmr::Parameters tParameters;
+
+            tParameters.set_number_of_elements_per_dimension( 6, 4 );
+            tParameters.set_domain_dimensions( 3, 2 );
+            tParameters.set_domain_offset( 0.0, 0.0 );
+            tParameters.set_create_side_sets( true );
+
+            tParameters.set_bspline_truncation( true );
+            tParameters.set_lagrange_orders( { 1 } );
+            tParameters.set_lagrange_patterns( { 0 } );
+            tParameters.set_bspline_orders( { 1 } );
+            tParameters.set_bspline_patterns( { 0 } );
+
+            tParameters.set_output_meshes( { { 0 } } );
+
+            tParameters.set_staircase_buffer( 1 );
+            tParameters.set_initial_refinement( { 1 } );
+            tParameters.set_number_aura( true );
+
+            // create the HMR object by passing the settings to the constructor
+            moris::hmr::HMR tHMR( tParameters );
+
+            tHMR.perform_initial_refinement();
+
+            tHMR.finalize();
+
+            // construct a mesh manager for the fem
+            moris::hmr::Interpolation_Mesh_HMR* tIPMesh = tHMR.create_interpolation_mesh( 0 );
+            moris::hmr::Integration_Mesh_HMR*   tIGMesh = tHMR.create_integration_mesh( 1, 0, tIPMesh );
+
+            // place the pair in mesh manager
+            std::shared_ptr< mtk::Mesh_Manager > tMeshManager = std::make_shared< mtk::Mesh_Manager >();
+            tMeshManager->register_mesh_pair( tIPMesh, tIGMesh );
+
+            //------------------------------------------------------------------------------
+            // FEM parameter lists with constant properties only
+            Module_Parameter_Lists tParameterList( Module_Type::FEM );
+            tParameterList.hack_for_legacy_fem();
+
+            tParameterList( FEM_Submodule::PROPERTIES ).add_parameter_list();
+            tParameterList.set( "property_name", "PropConductivity" );
+            tParameterList.set( "function_parameters", "1.0" );
+
+            tParameterList( FEM_Submodule::PROPERTIES ).add_parameter_list();
+            tParameterList.set( "property_name", "PropLoad" );
+            tParameterList.set( "function_parameters", "2.0" );
+
+            tParameterList( FEM_Submodule::PROPERTIES ).add_parameter_list();
+            tParameterList.set( "property_name", "PropDirichlet" );
+            tParameterList.set( "function_parameters", "5.0" );
+
+            tParameterList( FEM_Submodule::PROPERTIES ).add_parameter_list();
+            tParameterList.set( "property_name", "PropFlux" );
+            tParameterList.set( "function_parameters", "20.0" );
+
+            tParameterList( FEM_Submodule::CONSTITUTIVE_MODELS ).add_parameter_list();
+            tParameterList.set( "constitutive_name", "CMDiffusion" );
+            tParameterList.set( "constitutive_type", fem::Constitutive_Type::DIFF_LIN_ISO );
+            tParameterList.set( "dof_dependencies", std::pair< std::string, std::string >( "TEMP", "Temperature" ) );
+            tParameterList.set( "properties", "PropConductivity,Conductivity" );
+
+            tParameterList( FEM_Submodule::STABILIZATION ).add_parameter_list();
+            tParameterList.set( "stabilization_name", "SPNitsche" );
+            tParameterList.set( "stabilization_type", fem::Stabilization_Type::DIRICHLET_NITSCHE );
+            tParameterList.set( "function_parameters", "100.0" );
+            tParameterList.set( "leader_properties", "PropConductivity,Material" );
+
+            tParameterList( FEM_Submodule::IWG ).add_parameter_list();
+            tParameterList.set( "IWG_name", "IWGBulk" );
+            tParameterList.set( "IWG_type", fem::IWG_Type::SPATIALDIFF_BULK );
+            tParameterList.set( "dof_residual", "TEMP" );
+            tParameterList.set( "leader_dof_dependencies", "TEMP" );
+            tParameterList.set( "leader_constitutive_models", "CMDiffusion,Diffusion" );
+            tParameterList.set( "leader_properties", "PropLoad,Load" );
+            tParameterList.set( "mesh_set_names", "HMR_dummy" );
+
+            tParameterList( FEM_Submodule::IWG ).add_parameter_list();
+            tParameterList.set( "IWG_name", "IWGDirichlet" );
+            tParameterList.set( "IWG_type", fem::IWG_Type::SPATIALDIFF_DIRICHLET_UNSYMMETRIC_NITSCHE );
+            tParameterList.set( "dof_residual", "TEMP" );
+            tParameterList.set( "leader_dof_dependencies", "TEMP" );
+            tParameterList.set( "leader_constitutive_models", "CMDiffusion,Diffusion" );
+            tParameterList.set( "leader_properties", "PropDirichlet,Dirichlet" );
+            tParameterList.set( "stabilization_parameters", "SPNitsche,DirichletNitsche" );
+            tParameterList.set( "mesh_set_names", "SideSet_4" );
+
+            tParameterList( FEM_Submodule::IWG ).add_parameter_list();
+            tParameterList.set( "IWG_name", "IWGNeumann" );
+            tParameterList.set( "IWG_type", fem::IWG_Type::SPATIALDIFF_NEUMANN );
+            tParameterList.set( "dof_residual", "TEMP" );
+            tParameterList.set( "leader_dof_dependencies", "TEMP" );
+            tParameterList.set( "leader_properties", "PropFlux,Neumann" );
+            tParameterList.set( "mesh_set_names", "SideSet_2" );
+
+            // evaluate the elements of each set on four workspaces
+            tParameterList( FEM_Submodule::COMPUTATION );
+            tParameterList.set( "number_of_evaluation_workspaces", 4u );
+
+            // create the FEM model
+            std::shared_ptr< fem::FEM_Model > tEquationModel = std::make_shared< fem::FEM_Model >(
+                    tMeshManager,
+                    0,
+                    tParameterList,
+                    std::shared_ptr< Library_IO >( nullptr ) );
+
+            // create the model solver interface
+            Parameter_List tMSIParameters = prm::create_msi_parameter_list();
+            tMSIParameters.set( "TEMP", 0 );
+
+            MSI::Model_Solver_Interface* tModelSolverInterface = new MSI::Model_Solver_Interface(
+                    tMSIParameters,
+                    tEquationModel,
+                    tIPMesh );
+
+            tModelSolverInterface->finalize();
+
+            tEquationModel->finalize_equation_sets( tModelSolverInterface );
+
+            // create the solver interface
+            MSI::MSI_Solver_Interface* tSolverInterface = new MSI::MSI_Solver_Interface( tModelSolverInterface );
+
+            tSolverInterface->set_requested_dof_types( { MSI::Dof_Type::TEMP } );
+            tSolverInterface->set_secondary_dof_types( { MSI::Dof_Type::TEMP } );
+
+            // every set of the model provides four workspaces
+            for ( uint iSet = 0; iSet < tSolverInterface->get_num_sets(); iSet++ )
+            {
+                CHECK( tSolverInterface->get_number_of_evaluation_workspaces( iSet ) == 4 );
+            }
+
+            // assemble serially and with four threads
+            Matrix< DDRMat > tSerialResidual;
+            Matrix< DDRMat > tSerialJacobian;
+            tAssemble_MDLThreadedAssembly( tSolverInterface, 1, tSerialResidual, tSerialJacobian );
+
+            Matrix< DDRMat > tThreadedResidual;
+            Matrix< DDRMat > tThreadedJacobian;
+            tAssemble_MDLThreadedAssembly( tSolverInterface, 4, tThreadedResidual, tThreadedJacobian );
+
+            // residual and jacobian do not depend on the number of threads
+            REQUIRE( tSerialResidual.numel() == tThreadedResidual.numel() );
+            REQUIRE( tSerialJacobian.numel() == tThreadedJacobian.numel() );
+
+            real tResidualScale = std::max( norm( tSerialResidual ), 1.0 );
+            real tJacobianScale = std::max( norm( tSerialJacobian ), 1.0 );
+
+            CHECK( norm( tSerialResidual ) > 0.0 );
+            CHECK( norm( tSerialResidual - tThreadedResidual ) < 1.0e-12 * tResidualScale );
+            CHECK( norm( tSerialJacobian - tThreadedJacobian ) < 1.0e-12 * tJacobianScale );
+
+            delete tSolverInterface;
+            delete tModelSolverInterface;
+            delete tIPMesh;
+            delete tIGMesh;
+        }
+    }
+}    // namespace moris
@@ -434,6 +434,18 @@ namespace moris
                 mIsForwardAnalysis = true;
             }
 
+            //------------------------------------------------------------------------------
+            /**
+             * @brief temporarily switches to forward analysis during the sensitivity analysis without resetting
+             * the equation model, e.g. to recompute forward states from checkpoints
+             * @param[ in ] aIsForwardRecomputation true to switch to forward analysis, false to switch back
+             */
+            void
+            set_forward_recomputation( bool aIsForwardRecomputation )
+            {
+                mIsForwardAnalysis = aIsForwardRecomputation;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * @brief resets member variables of the equation object
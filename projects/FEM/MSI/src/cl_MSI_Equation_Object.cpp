@@ -121,6 +121,9 @@ namespace moris::MSI
         mFreePdofs.clear();
         mFreePdofs.reserve( tNumMyFreePdofs );
 
+        // set size of list of positions of the first pdof per pdof system and type
+        mFreePdofTypeOffsets.resize( mNumPdofSystems );
+
         // loop over pdof systems. Is one except for double sided clusters
         for ( uint Ia = 0; Ia < mNumPdofSystems; Ia++ )
         {
@@ -128,8 +131,12 @@ namespace moris::MSI
 
             // loop over all pdof types. Ask the first pdof host for the number of pdof types
             uint tNumPdofTypes = ( mMyPdofHosts( Ia )( 0 )->get_pdof_hosts_pdof_list() ).size();
+            mFreePdofTypeOffsets( Ia ).resize( tNumPdofTypes );
             for ( uint Ij = 0; Ij < tNumPdofTypes; Ij++ )
             {
+                // store position of the first pdof of this type, pdofs are ordered by time level and then by pdof host
+                mFreePdofTypeOffsets( Ia )( Ij ) = mFreePdofs.size();
+
                 // loop over all time levels for this dof type
                 uint tNumTimeLevels = mMyPdofHosts( Ia )( 0 )->get_pdof_hosts_pdof_list()( Ij ).size();
                 for ( uint Ii = 0; Ii < tNumTimeLevels; Ii++ )
@@ -325,6 +332,9 @@ namespace moris::MSI
                 }
             }
         }
+
+        // T-matrices built on the previous adof map are no longer valid
+        this->reset_PADofMap_cache();
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -494,6 +504,158 @@ namespace moris::MSI
 
     //-------------------------------------------------------------------------------------------------
 
+    void
+    Equation_Object::build_sparse_PADofMap( Sparse_PADofMap& aPADofMap )
+    {
+        // Get number of unique adofs of this equation object
+        uint tNumUniqueAdofs = mUniqueAdofList.numel();
+
+        MORIS_ASSERT( tNumUniqueAdofs != 0,
+                "Equation_Object::build_sparse_PADofMap: Number adofs = 0. T-matrix can not be created. MSI probably not build yet. " );
+
+        // Get MAX number of pdofs for this equation object
+        uint tNumMyPdofs = mFreePdofs.size();
+
+        MORIS_ASSERT( tNumMyPdofs != 0,
+                "Equation_Object::build_sparse_PADofMap: Number pdof types = 0. T-matrix can not be created. MSI probably not build yet. " );
+
+        aPADofMap.clear();
+
+        // Loop over all pdofs of this equation object
+        for ( uint iPDOF = 0; iPDOF < tNumMyPdofs; iPDOF++ )
+        {
+            auto tPdof = mFreePdofs( iPDOF );
+
+            aPADofMap.add_row();
+
+            // Loop over all adof Ids of this pdof
+            for ( uint Ik = 0; Ik < tPdof->mAdofIds.numel(); Ik++ )
+            {
+                // Insert value into pdof-adof-map at the column of the corresponding adof
+                aPADofMap.set_entry( mUniqueAdofMap[ tPdof->mAdofIds( Ik, 0 ) ], tPdof->mTmatrix( Ik, 0 ) );
+            }
+        }
+
+        aPADofMap.set_num_cols( tNumUniqueAdofs );
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    void
+    Equation_Object::build_sparse_PADofMap_1(
+            const Vector< enum Dof_Type >& aRequestedDofTypes,
+            Sparse_PADofMap&               aPADofMap )
+    {
+        MORIS_ASSERT( mUniqueAdofTypeListFlag,
+                "Equation_Object::build_sparse_PADofMap_1: Number adofs = 0. T-matrix can not be created. MSI probably not build yet. " );
+
+        MORIS_ASSERT( mFreePdofListFlag,
+                "Equation_Object::build_sparse_PADofMap_1: Number pdof types = 0. T-matrix can not be created. MSI probably not build yet. " );
+
+        aPADofMap.clear();
+
+        Dof_Manager* tDofManager = mEquationSet->get_model_solver_interface()->get_dof_manager();
+
+        // assemble the T-matrices of the requested dof types as diagonal blocks, same order as build_PADofMap_1()
+        for ( uint Ii = 0; Ii < mNumPdofSystems; Ii++ )
+        {
+            for ( uint Ik = 0; Ik < aRequestedDofTypes.size(); Ik++ )
+            {
+                // get index corresponding to this dof type
+                sint tDofTypeIndex = tDofManager->get_pdof_index_for_type( aRequestedDofTypes( Ik ) );
+
+                uint tNumUniqueAdofs = mUniqueAdofTypeList( Ii )( tDofTypeIndex ).numel();
+                uint tNumMyPdofs     = mFreePdofList( Ii )( tDofTypeIndex ).size();
+
+                // skip empty blocks
+                if ( tNumUniqueAdofs * tNumMyPdofs == 0 )
+                {
+                    continue;
+                }
+
+                Sparse_PADofMap tBlock;
+
+                // Loop over all pdofs of this dof type
+                for ( uint Ij = 0; Ij < tNumMyPdofs; Ij++ )
+                {
+                    auto tPdof = mFreePdofList( Ii )( tDofTypeIndex )( Ij );
+
+                    tBlock.add_row();
+
+                    // Loop over all adof Ids of this pdof
+                    for ( uint Ib = 0; Ib < tPdof->mAdofIds.numel(); Ib++ )
+                    {
+                        // Insert value into pdof-adof-map at the column of the corresponding adof
+                        tBlock.set_entry(
+                                mUniqueAdofMapList( Ii )( tDofTypeIndex )[ tPdof->mAdofIds( Ib, 0 ) ],
+                                tPdof->mTmatrix( Ib, 0 ) );
+                    }
+                }
+
+                tBlock.set_num_cols( tNumUniqueAdofs );
+
+                aPADofMap.append_block( tBlock );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    const Sparse_PADofMap&
+    Equation_Object::get_PADofMap()
+    {
+        if ( !mPADofMapFlag )
+        {
+            this->build_sparse_PADofMap( mPADofMap );
+
+            mPADofMapFlag = true;
+        }
+
+        return mPADofMap;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    const Sparse_PADofMap&
+    Equation_Object::get_requested_PADofMap()
+    {
+        // get list of requested dof types
+        const Vector< enum MSI::Dof_Type >& tRequestedDofTypes = mEquationSet->mIsStaggered
+                                                                       ? mEquationSet->get_secondary_dof_types()
+                                                                       : mEquationSet->get_requested_dof_types();
+
+        // look for a T-matrix already built for this list of dof types
+        for ( uint iMap = 0; iMap < mRequestedPADofMapDofTypes.size(); iMap++ )
+        {
+            if ( mRequestedPADofMapDofTypes( iMap ).data() == tRequestedDofTypes.data() )
+            {
+                return mRequestedPADofMaps( iMap );
+            }
+        }
+
+        // build and store T-matrix for this list of dof types
+        mRequestedPADofMapDofTypes.push_back( tRequestedDofTypes );
+        mRequestedPADofMaps.push_back( Sparse_PADofMap() );
+
+        this->build_sparse_PADofMap_1( tRequestedDofTypes, mRequestedPADofMaps( mRequestedPADofMaps.size() - 1 ) );
+
+        return mRequestedPADofMaps( mRequestedPADofMaps.size() - 1 );
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    void
+    Equation_Object::reset_PADofMap_cache()
+    {
+        mPADofMap.clear();
+        mPADofMapFlag = false;
+
+        mRequestedPADofMapDofTypes.clear();
+        mRequestedPADofMaps.clear();
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     moris_index
     Equation_Object::get_node_index( const moris_index aElementLocalNodeIndex ) const
     {
@@ -561,12 +723,11 @@ namespace moris::MSI
         // compute jacobian
         this->compute_jacobian();
 
-        // build T-matrix
-        Matrix< DDRMat > tTMatrix;
-        this->build_PADofMap_1( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_requested_PADofMap();
 
         // project pdof residual to adof residual
-        aEqnObjMatrix = trans( tTMatrix ) * mEquationSet->get_jacobian() * tTMatrix;
+        tTMatrix.project_matrix( mEquationSet->get_jacobian(), aEqnObjMatrix );
 
         // transpose for sensitivity analysis FIXME move to solver
         if ( !mEquationSet->mEquationModel->is_forward_analysis() )
@@ -596,19 +757,15 @@ namespace moris::MSI
             // this->add_staggered_contribution_to_residual( tElementalResidual );
         }
 
-        Matrix< DDRMat > tTMatrix;
-        this->build_PADofMap_1( tTMatrix );
+        const Sparse_PADofMap& tTMatrix = this->get_requested_PADofMap();
 
         uint tNumRHS = mEquationSet->mEquationModel->get_num_rhs();
 
         aEqnObjRHS.resize( tNumRHS );
 
-        // build transpose of Tmatrix
-        Matrix< DDRMat > tTMatrixTrans = trans( tTMatrix );
-
         for ( uint Ik = 0; Ik < tNumRHS; Ik++ )
         {
-            aEqnObjRHS( Ik ) = tTMatrixTrans * tElementalResidual( Ik );
+            tTMatrix.project_vector( tElementalResidual( Ik ), aEqnObjRHS( Ik ) );
         }
     }
 
@@ -631,25 +788,21 @@ namespace moris::MSI
             this->add_staggered_contribution_to_residual( tElementalResidual );
         }
 
-        Matrix< DDRMat > tTMatrix;
-        this->build_PADofMap_1( tTMatrix );
+        const Sparse_PADofMap& tTMatrix = this->get_requested_PADofMap();
 
         uint tNumRHS = mEquationSet->mEquationModel->get_num_rhs();
 
         aEqnObjRHS.resize( tNumRHS );
 
-        // build transpose of Tmatrix
-        Matrix< DDRMat > tTMatrixTrans = trans( tTMatrix );
-
         for ( uint Ik = 0; Ik < tNumRHS; Ik++ )
         {
 
-            MORIS_ASSERT( ( tElementalResidual( Ik ).numel() != 0 ) == ( tTMatrixTrans.numel() != 0 ),
+            MORIS_ASSERT( ( tElementalResidual( Ik ).numel() != 0 ) == ( tTMatrix.n_rows() * tTMatrix.n_cols() != 0 ),
                     "Equation_Object::get_staggered_equation_obj_residual(), elemental residual vector # %-5i has 0 entries on set %s",
                     Ik,
                     mEquationSet->get_set_name().c_str() );
 
-            aEqnObjRHS( Ik ) = tTMatrixTrans * tElementalResidual( Ik );
+            tTMatrix.project_vector( tElementalResidual( Ik ), aEqnObjRHS( Ik ) );
         }
     }
 
@@ -766,20 +919,16 @@ namespace moris::MSI
         }
 
         // get the T matrix for eq obj
-        Matrix< DDRMat > tTMatrix;
-        this->build_PADofMap_1( tTMatrix );
+        const Sparse_PADofMap& tTMatrix = this->get_requested_PADofMap();
 
         // init
         aEqnObjRHS.resize( tNumRHS );
 
-        // build transpose of Tmatrix
-        Matrix< DDRMat > tTMatrixTrans = trans( tTMatrix );
-
         // loop over rhs
         for ( uint Ik = 0; Ik < tNumRHS; Ik++ )
         {
             // project
-            aEqnObjRHS( Ik ) = tTMatrixTrans * tElementalResidual( Ik );
+            tTMatrix.project_vector( tElementalResidual( Ik ), aEqnObjRHS( Ik ) );
         }
     }
 
@@ -802,15 +951,11 @@ namespace moris::MSI
             return;
         }
 
-        // build T-matrix
-        Matrix< DDRMat > tTMatrix;
-        this->build_PADofMap_1( tTMatrix );
-
-        // get the transpose of the T-matrix (compute once use twice)
-        Matrix< DDRMat > tTMatrixTrans = trans( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_requested_PADofMap();
 
         // project pdof residual to adof residual
-        aEqnObjMatrix = tTMatrixTrans * mEquationSet->get_jacobian() * tTMatrix;
+        tTMatrix.project_matrix( mEquationSet->get_jacobian(), aEqnObjMatrix );
 
         // transpose for adjoint sensitivity analysis
         if ( !mEquationSet->mEquationModel->is_forward_analysis() &&    //
@@ -837,7 +982,7 @@ namespace moris::MSI
         // multiply RHS with T-matrix
         for ( uint Ik = 0; Ik < tNumRHS; Ik++ )
         {
-            aEqnObjRHS( Ik ) = tTMatrixTrans * tElementalResidual( Ik );
+            tTMatrix.project_vector( tElementalResidual( Ik ), aEqnObjRHS( Ik ) );
         }
     }
 
@@ -1100,10 +1245,8 @@ namespace moris::MSI
     void
     Equation_Object::compute_my_pdof_values()
     {
-        Matrix< DDRMat > tTMatrix;
-
-        // build T-matrix
-        this->build_PADofMap( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_PADofMap();
 
         Vector< Matrix< DDRMat > > tMyValues;
 
@@ -1124,10 +1267,8 @@ namespace moris::MSI
         // multiply t_matrix with adof values to get pdof values
         for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
         {
-            mEquationSet->mPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+            tTMatrix.interpolate( tMyValues( Ik ), mEquationSet->mPdofValues( Ik ) );
         }
-
-        this->set_vector_entry_number_of_pdof();    // FIXME should not be in MSI. Should be in FEM
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -1135,10 +1276,8 @@ namespace moris::MSI
     void
     Equation_Object::compute_previous_pdof_values()
     {
-        Matrix< DDRMat > tTMatrix;
-
-        // build T-matrix
-        this->build_PADofMap( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_PADofMap();
 
         Vector< Matrix< DDRMat > > tMyValues;
 
@@ -1155,11 +1294,8 @@ namespace moris::MSI
         // multiply t_matrix with adof values to get pdof values
         for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
         {
-            mEquationSet->mPreviousPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+            tTMatrix.interpolate( tMyValues( Ik ), mEquationSet->mPreviousPdofValues( Ik ) );
         }
-
-        // FIXME should not be in MSI. Should be in FEM
-        this->set_vector_entry_number_of_pdof();
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -1167,10 +1303,8 @@ namespace moris::MSI
     void
     Equation_Object::compute_my_eigen_vector_values()
     {
-        Matrix< DDRMat > tTMatrix;
-
-        // build T-matrix
-        this->build_PADofMap( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_PADofMap();
 
         Vector< Matrix< DDRMat > > tMyValues;
 
@@ -1187,11 +1321,8 @@ namespace moris::MSI
         // multiply t_matrix with adof values to get pdof values
         for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
         {
-            mEquationSet->mEigenVectorPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+            tTMatrix.interpolate( tMyValues( Ik ), mEquationSet->mEigenVectorPdofValues( Ik ) );
         }
-
-        // FIXME should not be in MSI. Should be in FEM
-        this->set_vector_entry_number_of_pdof();
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -1199,10 +1330,8 @@ namespace moris::MSI
     void
     Equation_Object::compute_my_adjoint_values()
     {
-        Matrix< DDRMat > tTMatrix;
-
-        // build T-matrix
-        this->build_PADofMap( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_PADofMap();
 
         Vector< Matrix< DDRMat > > tMyValues;
 
@@ -1219,11 +1348,8 @@ namespace moris::MSI
         // multiply t_matrix with adof values to get pdof values
         for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
         {
-            mEquationSet->mAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+            tTMatrix.interpolate( tMyValues( Ik ), mEquationSet->mAdjointPdofValues( Ik ) );
         }
-
-        // FIXME should not be in MSI. Should be in FEM
-        this->set_vector_entry_number_of_pdof();
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -1231,10 +1357,8 @@ namespace moris::MSI
     void
     Equation_Object::compute_my_previous_adjoint_values()
     {
-        Matrix< DDRMat > tTMatrix;
-
-        // build T-matrix
-        this->build_PADofMap( tTMatrix );
+        // get T-matrix
+        const Sparse_PADofMap& tTMatrix = this->get_PADofMap();
 
         Vector< Matrix< DDRMat > > tMyValues;
 
@@ -1251,10 +1375,8 @@ namespace moris::MSI
         // multiply t_matrix with adof values to get pdof values
         for ( uint Ik = 0; Ik < tMyValues.size(); Ik++ )
         {
-            mEquationSet->mPreviousAdjointPdofValues( Ik ) = tTMatrix * tMyValues( Ik );
+            tTMatrix.interpolate( tMyValues( Ik ), mEquationSet->mPreviousAdjointPdofValues( Ik ) );
         }
-
-        this->set_vector_entry_number_of_pdof();    // FIXME should not be in MSI. Should be in FEM
     }
 
     //-------------------------------------------------------------------------------------------------
@@ -1439,7 +1561,10 @@ namespace moris::MSI
                         Vector< Pdof* > tPdofTimeList = mMyPdofHosts( tIsLeader )( Ik )->get_pdof_time_list( tDofTypeIndex );
 
                         // get entry number of this pdof in the elemental pdof value vector
-                        uint tElementalSolVecEntry = tPdofTimeList( Ia )->mElementalSolVecEntry;
+                        uint tElementalSolVecEntry = mFreePdofTypeOffsets( tIsLeader )( tDofTypeIndex ) + Ia * mMyPdofHosts( tIsLeader ).size() + Ik;
+
+                        MORIS_ASSERT( mFreePdofs( tElementalSolVecEntry ) == tPdofTimeList( Ia ),
+                                "Equation_Object::get_my_pdof_values - inconsistent elemental pdof entry" );
 
                         for ( uint Ib = 0; Ib < tNumVectors; Ib++ )
                         {
@@ -1497,16 +1622,4 @@ namespace moris::MSI
         }
     }
 
-    //-------------------------------------------------------------------------------------------------
-
-    void
-    Equation_Object::set_vector_entry_number_of_pdof()
-    {
-        uint tNumMyPdofs = mFreePdofs.size();
-        // Loop over all pdofs of this element
-        for ( uint Ik = 0; Ik < tNumMyPdofs; Ik++ )
-        {
-            mFreePdofs( Ik )->mElementalSolVecEntry = Ik;
-        }
-    }
 }    // namespace moris::MSI
@@ -22,6 +22,8 @@
 #include "op_times.hpp"
 
 #include "cl_MSI_Pdof_Host.hpp"
+#include "cl_MSI_Sparse_PADofMap.hpp"
+
 namespace moris
 {
     class Dist_Vector;
@@ -66,6 +68,7 @@ namespace moris
 
             Vector< Pdof* >                     mFreePdofs;       // List of the pdof pointers of this equation obj
             Vector< Vector< Vector< Pdof* > > > mFreePdofList;    // FIXME list of free pdofs ordered after their dof type . mFreePdofs or mFreePdofList should be deleted
+            Vector< Vector< uint > >            mFreePdofTypeOffsets;    // position of the first pdof per pdof system and type in mFreePdofs
 
             Matrix< DDSMat >                     mUniqueAdofList;    // Unique adof list for this equation object
             Vector< Vector< Matrix< DDSMat > > > mUniqueAdofTypeList;
@@ -76,6 +79,14 @@ namespace moris
             //! weak BCs of element FIXME
             Matrix< DDRMat > mNodalWeakBCs;
 
+            // sparse T-matrix for all free pdofs, built on first use and reset when the adof map changes
+            Sparse_PADofMap mPADofMap;
+            bool            mPADofMapFlag = false;
+
+            // sparse T-matrices for the requested dof types, one per requested dof type list seen so far
+            Vector< Vector< enum Dof_Type > > mRequestedPADofMapDofTypes;
+            Vector< Sparse_PADofMap >         mRequestedPADofMaps;
+
             uint mEqnObjInd;
 
             Equation_Set* mEquationSet = nullptr;
@@ -122,6 +133,18 @@ namespace moris
              */
             virtual ~Equation_Object() {};
 
+            //------------------------------------------------------------------------------
+            /**
+             * rebind the equation object to an equation set holding the evaluation state,
+             * used to evaluate the equation object on an evaluation workspace of its set
+             * @param[ in ] aEquationSet equation set pointer
+             */
+            virtual void
+            set_equation_set( Equation_Set* aEquationSet )
+            {
+                mEquationSet = aEquationSet;
+            }
+
             //------------------------------------------------------------------------------
             /**
              * set time for equation object
@@ -227,6 +250,42 @@ namespace moris
 
             void build_PADofMap_1( Matrix< DDRMat >& aPADofMap );
 
+            //------------------------------------------------------------------------------
+            /**
+             * @brief build the sparse counterpart of build_PADofMap(), i.e. the T-matrix for all free pdofs
+             * @param[ out ] aPADofMap sparse pdof to adof map
+             */
+            void build_sparse_PADofMap( Sparse_PADofMap& aPADofMap );
+
+            //------------------------------------------------------------------------------
+            /**
+             * @brief build the sparse counterpart of build_PADofMap_1(), i.e. the T-matrix for a list of dof types
+             * @param[ in ]  aRequestedDofTypes list of dof types
+             * @param[ out ] aPADofMap          sparse pdof to adof map
+             */
+            void build_sparse_PADofMap_1(
+                    const Vector< enum Dof_Type >& aRequestedDofTypes,
+                    Sparse_PADofMap&               aPADofMap );
+
+            //------------------------------------------------------------------------------
+            /**
+             * @brief returns the cached sparse T-matrix for all free pdofs, builds it on first use
+             */
+            const Sparse_PADofMap& get_PADofMap();
+
+            //------------------------------------------------------------------------------
+            /**
+             * @brief returns the cached sparse T-matrix for the currently requested (or secondary if staggered)
+             * dof types, builds it on first use of this dof type list
+             */
+            const Sparse_PADofMap& get_requested_PADofMap();
+
+            //------------------------------------------------------------------------------
+            /**
+             * @brief discards the cached T-matrices. Called whenever the adof map of this equation object is rebuilt.
+             */
+            void reset_PADofMap_cache();
+
             //------------------------------------------------------------------------------
             /**
              * @brief compute function for the pdof values of this particular equation object
@@ -295,12 +354,6 @@ namespace moris
                     const Vector< Matrix< DDRMat > >& aPdofValues,
                     Matrix< DDRMat >&                 aReshapedPdofValues );
 
-            //------------------------------------------------------------------------------
-            /**
-             * FIXME doc????
-             */
-            void set_vector_entry_number_of_pdof();
-
             //------------------------------------------------------------------------------
             /**
              * get jacobian for equation object
@@ -420,6 +420,19 @@ namespace moris::MSI
     //------------------------------------------------------------------------------
 
     void Equation_Set::free_matrix_memory()
+    {
+        // the residual, jacobian and QI buffers are kept for the next elements or solves,
+        // initialize_mJacobian(), initialize_mResidual() and initialize_mQI() zero them in place
+
+        mIsStaggered = false;
+
+        // free additional memory
+        this->free_memory();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void Equation_Set::release_matrix_memory()
     {
         // if the Jacobian matrix was created
         if ( mJacobianExist )
@@ -447,17 +460,24 @@ namespace moris::MSI
 
         if ( mQIExist )
         {
-            //                // resize each matrix to 0x0
-            //                for( auto & tQI : mQI )
-            //                {
-            //                    tQI.resize( 0, 0 );
-            //                }
-            //                mQI.clear();
+            // resize each matrix to 0x0
+            for ( auto &tQI : mQI )
+            {
+                tQI.set_size( 0, 0 );
+            }
+            mQI.clear();
 
             // reset the exist flag
             mQIExist = false;
         }
 
+        // clear the layout the buffers were sized for
+        mWorkspaceIsStaggered = false;
+        mWorkspaceNumRHS      = 0;
+        mWorkspaceRequestedDofTypes.clear();
+        mWorkspaceSecondaryDofTypes.clear();
+        mWorkspaceIQINames.clear();
+
         mIsStaggered = false;
 
         // free additional memory
@@ -466,6 +486,45 @@ namespace moris::MSI
 
     //------------------------------------------------------------------------------
 
+    void Equation_Set::check_workspace_layout()
+    {
+        // get the current layout
+        const Vector< enum MSI::Dof_Type > &tRequestedDofTypes = this->get_requested_dof_types();
+        const Vector< enum MSI::Dof_Type > &tSecondaryDofTypes = this->get_secondary_dof_types();
+        const Vector< std::string >        &tIQINames          = mEquationModel->get_requested_IQI_names();
+        uint                                tNumRHS            = mEquationModel->get_num_rhs();
+
+        // jacobian and residual depend on the dof types and on the staggered flag
+        bool tDofLayoutChanged =
+                mWorkspaceIsStaggered != mIsStaggered
+                || mWorkspaceNumRHS != tNumRHS
+                || mWorkspaceRequestedDofTypes.data() != tRequestedDofTypes.data()
+                || mWorkspaceSecondaryDofTypes.data() != tSecondaryDofTypes.data();
+
+        if ( tDofLayoutChanged )
+        {
+            // flag jacobian and residual for resizing, set_size() reuses the memory if the size does not change
+            mJacobianExist = false;
+            mResidualExist = false;
+
+            mWorkspaceIsStaggered       = mIsStaggered;
+            mWorkspaceNumRHS            = tNumRHS;
+            mWorkspaceRequestedDofTypes = tRequestedDofTypes;
+            mWorkspaceSecondaryDofTypes = tSecondaryDofTypes;
+        }
+
+        // QI values depend on the requested IQIs
+        if ( mWorkspaceIQINames.data() != tIQINames.data() )
+        {
+            // flag QI values for resizing
+            mQIExist = false;
+
+            mWorkspaceIQINames = tIQINames;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     const Vector< enum MSI::Dof_Type > &Equation_Set::get_requested_dof_types()
     {
         MORIS_ERROR( mModelSolverInterface != nullptr,
@@ -116,6 +116,14 @@ namespace moris
             // bool for time continuity
             bool mIsStaggered = false;
 
+            // layout the jacobian, residual and QI buffers were sized for,
+            // buffers are kept between elements and solves as long as the layout does not change
+            bool                         mWorkspaceIsStaggered = false;
+            uint                         mWorkspaceNumRHS      = 0;
+            Vector< enum MSI::Dof_Type > mWorkspaceRequestedDofTypes;
+            Vector< enum MSI::Dof_Type > mWorkspaceSecondaryDofTypes;
+            Vector< std::string >        mWorkspaceIQINames;
+
             // flag whether the set needs to be updated in every newton iteration
             bool mIsUpdateRequired = false;
 
@@ -177,7 +185,8 @@ namespace moris
 
             //------------------------------------------------------------------------------
             /**
-             * trivial destructor
+             * trivial destructor,
+             * the residual, jacobian and QI buffers are members and are freed with the set
              */
             virtual ~Equation_Set() {};
 
@@ -317,11 +326,28 @@ namespace moris
 
             //-------------------------------------------------------------------------------------------------
             /**
-             * free matrix memory,
-             * i.e. free residual and jacobian matrices
+             * free matrix memory after a set has been treated,
+             * residual, jacobian and QI buffers are kept and zeroed in place on the next use,
+             * they are resized when the buffer layout changes and released by release_matrix_memory()
              */
             void free_matrix_memory();
 
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * release matrix memory,
+             * i.e. free residual, jacobian and QI buffers, called from fem::Set::finalize() when the model
+             * is rebuilt; it is not called from the destructor since it calls the virtual free_memory()
+             */
+            void release_matrix_memory();
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * check whether the residual, jacobian and QI buffers were sized for the
+             * current requested dof types, secondary dof types, number of RHS and requested IQIs,
+             * if not, the buffers are flagged for resizing on their next initialization
+             */
+            void check_workspace_layout();
+
             //-------------------------------------------------------------------------------------------------
             /**
              * initialize set
@@ -369,6 +395,32 @@ namespace moris
                 MORIS_ERROR( false, "Equation_Set::finalize - not implemented for msi base class." );
             }
 
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * get number of evaluation workspaces, i.e. independent copies of the evaluation state
+             * (residual and jacobian buffers, pdof values, field interpolators, IWGs) of this set
+             * on which equation objects of this set can be evaluated concurrently
+             */
+            virtual uint
+            get_number_of_evaluation_workspaces()
+            {
+                return 1;
+            }
+
+            //-------------------------------------------------------------------------------------------------
+            /**
+             * get evaluation workspace
+             * @param[ in ] aWorkspace index of the workspace, workspace 0 is the set itself
+             */
+            virtual Equation_Set*
+            get_evaluation_workspace( const uint aWorkspace )
+            {
+                MORIS_ASSERT( aWorkspace == 0,
+                        "Equation_Set::get_evaluation_workspace - set has a single evaluation workspace" );
+
+                return this;
+            }
+
             //-------------------------------------------------------------------------------------------------
             /**
              * set GEN/MSI interface
@@ -35,8 +35,6 @@ namespace moris::fem
             Matrix< DDSMat > mAdofIds;
             Matrix< DDRMat > mTmatrix;
 
-            uint mElementalSolVecEntry;
-
             Vector< Adof* > mAdofPtrList;    // FIXME: delete this list after call to get adof ids or replace it
         };
 
@@ -73,6 +73,17 @@ namespace moris::MSI
 
     //------------------------------------------------------------------------------
 
+    void
+    MSI_Solver_Interface::set_forward_recomputation( bool aIsForwardRecomputation )
+    {
+        // the sets are re-initialized by the base class and need the type of analysis of the equation model
+        mMSI->mEquationModel->set_forward_recomputation( aIsForwardRecomputation );
+
+        Solver_Interface::set_forward_recomputation( aIsForwardRecomputation );
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     MSI_Solver_Interface::set_solution_vector( sol::Dist_Vector* aSolutionVector )
     {
@@ -297,6 +308,81 @@ namespace moris::MSI
 
     //-------------------------------------------------------------------------------------------------------
 
+    uint
+    MSI_Solver_Interface::get_number_of_evaluation_workspaces( const moris::uint aMyEquSetInd )
+    {
+        // the IQIs of the workspaces are not normalized, the adjoint RHS is evaluated on the set itself
+        if ( !mMSI->get_equation_model()->is_forward_analysis() )
+        {
+            return 1;
+        }
+
+        return mMSI->get_equation_set( aMyEquSetInd )->get_number_of_evaluation_workspaces();
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+
+    void
+    MSI_Solver_Interface::get_equation_object_operator_on_workspace(
+            const moris::uint& aMyEquSetInd,
+            const moris::uint& aMyElementInd,
+            Matrix< DDRMat >&  aElementMatrix,
+            const moris::uint  aWorkspace )
+    {
+        Equation_Set*    tEquationSet    = mMSI->get_equation_set( aMyEquSetInd );
+        Equation_Object* tEquationObject = tEquationSet->get_equation_object_list()( aMyElementInd );
+
+        // evaluate the equation object on the state of the workspace and bind it back to its set
+        tEquationObject->set_equation_set( tEquationSet->get_evaluation_workspace( aWorkspace ) );
+
+        tEquationObject->get_egn_obj_jacobian( aElementMatrix );
+
+        tEquationObject->set_equation_set( tEquationSet );
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+
+    void
+    MSI_Solver_Interface::get_equation_object_rhs_on_workspace(
+            const moris::uint&          aMyEquSetInd,
+            const moris::uint&          aMyElementInd,
+            Vector< Matrix< DDRMat > >& aElementRHS,
+            const moris::uint           aWorkspace )
+    {
+        Equation_Set*    tEquationSet    = mMSI->get_equation_set( aMyEquSetInd );
+        Equation_Object* tEquationObject = tEquationSet->get_equation_object_list()( aMyElementInd );
+
+        // evaluate the equation object on the state of the workspace and bind it back to its set
+        tEquationObject->set_equation_set( tEquationSet->get_evaluation_workspace( aWorkspace ) );
+
+        tEquationObject->get_equation_obj_residual( aElementRHS );
+
+        tEquationObject->set_equation_set( tEquationSet );
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+
+    void
+    MSI_Solver_Interface::get_equation_object_operator_and_rhs_on_workspace(
+            const moris::uint&          aMyEquSetInd,
+            const moris::uint&          aMyElementInd,
+            Matrix< DDRMat >&           aElementMatrix,
+            Vector< Matrix< DDRMat > >& aElementRHS,
+            const moris::uint           aWorkspace )
+    {
+        Equation_Set*    tEquationSet    = mMSI->get_equation_set( aMyEquSetInd );
+        Equation_Object* tEquationObject = tEquationSet->get_equation_object_list()( aMyElementInd );
+
+        // evaluate the equation object on the state of the workspace and bind it back to its set
+        tEquationObject->set_equation_set( tEquationSet->get_evaluation_workspace( aWorkspace ) );
+
+        tEquationObject->get_egn_obj_jacobian_and_residual( aElementMatrix, aElementRHS );
+
+        tEquationObject->set_equation_set( tEquationSet );
+    }
+
+    //-------------------------------------------------------------------------------------------------------
+
     void
     MSI_Solver_Interface::set_solver_warehouse( const std::shared_ptr< sol::SOL_Warehouse >& aSolverWarehouse )
     {
@@ -226,6 +226,10 @@ namespace moris
 
             //------------------------------------------------------------------------------
 
+            void set_forward_recomputation( bool aIsForwardRecomputation ) override;
+
+            //------------------------------------------------------------------------------
+
             void
             set_requested_dof_types( const Vector< enum MSI::Dof_Type >& aListOfDofTypes ) override
             {
@@ -496,6 +500,38 @@ namespace moris
                         ->get_egn_obj_jacobian_and_residual( aElementMatrix, aElementRHS );
             };
 
+            //------------------------------------------------------------------------------
+            /**
+             * @brief number of evaluation workspaces of an equation set, one for sensitivity analysis
+             * since only the forward residual and jacobian evaluation is duplicated on the workspaces
+             */
+            uint get_number_of_evaluation_workspaces( const moris::uint aMyEquSetInd ) override;
+
+            //------------------------------------------------------------------------------
+
+            void get_equation_object_operator_on_workspace(
+                    const moris::uint& aMyEquSetInd,
+                    const moris::uint& aMyElementInd,
+                    Matrix< DDRMat >&  aElementMatrix,
+                    const moris::uint  aWorkspace ) override;
+
+            //------------------------------------------------------------------------------
+
+            void get_equation_object_rhs_on_workspace(
+                    const moris::uint&          aMyEquSetInd,
+                    const moris::uint&          aMyElementInd,
+                    Vector< Matrix< DDRMat > >& aElementRHS,
+                    const moris::uint           aWorkspace ) override;
+
+            //------------------------------------------------------------------------------
+
+            void get_equation_object_operator_and_rhs_on_workspace(
+                    const moris::uint&          aMyEquSetInd,
+                    const moris::uint&          aMyElementInd,
+                    Matrix< DDRMat >&           aElementMatrix,
+                    Vector< Matrix< DDRMat > >& aElementRHS,
+                    const moris::uint           aWorkspace ) override;
+
             //------------------------------------------------------------------------------
 
             mtk::Mesh*
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MSI_Sparse_PADofMap.cpp
+ *
+ */
+
+#include "cl_MSI_Sparse_PADofMap.hpp"
+
+namespace moris::MSI
+{
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::clear()
+    {
+        mNumRows = 0;
+        mNumCols = 0;
+
+        mRowOffsets.clear();
+        mRowOffsets.push_back( 0 );
+
+        mColumns.clear();
+        mValues.clear();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::add_row()
+    {
+        mRowOffsets.push_back( mColumns.size() );
+
+        mNumRows++;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::set_entry(
+            const uint aColumn,
+            const real aValue )
+    {
+        MORIS_ASSERT( mNumRows > 0,
+                "Sparse_PADofMap::set_entry - no row added yet." );
+
+        // overwrite entry if column already exists in this row
+        for ( uint iEntry = mRowOffsets( mNumRows - 1 ); iEntry < mColumns.size(); iEntry++ )
+        {
+            if ( mColumns( iEntry ) == aColumn )
+            {
+                mValues( iEntry ) = aValue;
+                return;
+            }
+        }
+
+        mColumns.push_back( aColumn );
+        mValues.push_back( aValue );
+
+        // close the row at the new end
+        mRowOffsets( mNumRows ) = mColumns.size();
+
+        mNumCols = std::max( mNumCols, aColumn + 1 );
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::append_block( const Sparse_PADofMap& aBlock )
+    {
+        uint tColumnShift = mNumCols;
+        uint tEntryShift  = mColumns.size();
+
+        mColumns.reserve( mColumns.size() + aBlock.mColumns.size() );
+        mValues.reserve( mValues.size() + aBlock.mValues.size() );
+        mRowOffsets.reserve( mRowOffsets.size() + aBlock.mNumRows );
+
+        for ( uint iEntry = 0; iEntry < aBlock.mColumns.size(); iEntry++ )
+        {
+            mColumns.push_back( aBlock.mColumns( iEntry ) + tColumnShift );
+            mValues.push_back( aBlock.mValues( iEntry ) );
+        }
+
+        for ( uint iRow = 0; iRow < aBlock.mNumRows; iRow++ )
+        {
+            mRowOffsets.push_back( aBlock.mRowOffsets( iRow + 1 ) + tEntryShift );
+        }
+
+        mNumRows += aBlock.mNumRows;
+        mNumCols += aBlock.mNumCols;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::project_matrix(
+            const Matrix< DDRMat >& aPdofMatrix,
+            Matrix< DDRMat >&       aAdofMatrix ) const
+    {
+        MORIS_ASSERT( aPdofMatrix.n_rows() == mNumRows && aPdofMatrix.n_cols() == mNumRows,
+                "Sparse_PADofMap::project_matrix - pdof matrix is %zu x %zu but map has %u rows.",
+                aPdofMatrix.n_rows(),
+                aPdofMatrix.n_cols(),
+                mNumRows );
+
+        // K * T, column iCol of the product is the weighted sum of the pdof columns interpolating from adof iCol
+        Matrix< DDRMat > tKT( mNumRows, mNumCols, 0.0 );
+
+        for ( uint iPdof = 0; iPdof < mNumRows; iPdof++ )
+        {
+            for ( uint iEntry = mRowOffsets( iPdof ); iEntry < mRowOffsets( iPdof + 1 ); iEntry++ )
+            {
+                const uint tCol   = mColumns( iEntry );
+                const real tValue = mValues( iEntry );
+
+                for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+                {
+                    tKT( iRow, tCol ) += tValue * aPdofMatrix( iRow, iPdof );
+                }
+            }
+        }
+
+        // trans( T ) * ( K * T ), filled column by column to stay within contiguous memory
+        aAdofMatrix.set_size( mNumCols, mNumCols, 0.0 );
+
+        for ( uint iCol = 0; iCol < mNumCols; iCol++ )
+        {
+            for ( uint iPdof = 0; iPdof < mNumRows; iPdof++ )
+            {
+                const real tKTValue = tKT( iPdof, iCol );
+
+                for ( uint iEntry = mRowOffsets( iPdof ); iEntry < mRowOffsets( iPdof + 1 ); iEntry++ )
+                {
+                    aAdofMatrix( mColumns( iEntry ), iCol ) += mValues( iEntry ) * tKTValue;
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::project_vector(
+            const Matrix< DDRMat >& aPdofVector,
+            Matrix< DDRMat >&       aAdofVector ) const
+    {
+        MORIS_ASSERT( aPdofVector.n_rows() == mNumRows,
+                "Sparse_PADofMap::project_vector - pdof vector has %zu rows but map has %u rows.",
+                aPdofVector.n_rows(),
+                mNumRows );
+
+        uint tNumVectors = aPdofVector.n_cols();
+
+        aAdofVector.set_size( mNumCols, tNumVectors, 0.0 );
+
+        for ( uint iVec = 0; iVec < tNumVectors; iVec++ )
+        {
+            for ( uint iPdof = 0; iPdof < mNumRows; iPdof++ )
+            {
+                const real tPdofValue = aPdofVector( iPdof, iVec );
+
+                for ( uint iEntry = mRowOffsets( iPdof ); iEntry < mRowOffsets( iPdof + 1 ); iEntry++ )
+                {
+                    aAdofVector( mColumns( iEntry ), iVec ) += mValues( iEntry ) * tPdofValue;
+                }
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Sparse_PADofMap::interpolate(
+            const Matrix< DDRMat >& aAdofVector,
+            Matrix< DDRMat >&       aPdofVector ) const
+    {
+        MORIS_ASSERT( aAdofVector.n_rows() == mNumCols,
+                "Sparse_PADofMap::interpolate - adof vector has %zu rows but map has %u columns.",
+                aAdofVector.n_rows(),
+                mNumCols );
+
+        uint tNumVectors = aAdofVector.n_cols();
+
+        aPdofVector.set_size( mNumRows, tNumVectors, 0.0 );
+
+        for ( uint iVec = 0; iVec < tNumVectors; iVec++ )
+        {
+            for ( uint iPdof = 0; iPdof < mNumRows; iPdof++ )
+            {
+                real tPdofValue = 0.0;
+
+                for ( uint iEntry = mRowOffsets( iPdof ); iEntry < mRowOffsets( iPdof + 1 ); iEntry++ )
+                {
+                    tPdofValue += mValues( iEntry ) * aAdofVector( mColumns( iEntry ), iVec );
+                }
+
+                aPdofVector( iPdof, iVec ) = tPdofValue;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    Matrix< DDRMat >
+    Sparse_PADofMap::get_dense() const
+    {
+        Matrix< DDRMat > tDense( mNumRows, mNumCols, 0.0 );
+
+        for ( uint iPdof = 0; iPdof < mNumRows; iPdof++ )
+        {
+            for ( uint iEntry = mRowOffsets( iPdof ); iEntry < mRowOffsets( iPdof + 1 ); iEntry++ )
+            {
+                tDense( iPdof, mColumns( iEntry ) ) = mValues( iEntry );
+            }
+        }
+
+        return tDense;
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace moris::MSI
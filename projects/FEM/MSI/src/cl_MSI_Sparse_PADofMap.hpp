@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MSI_Sparse_PADofMap.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_MSI_SPARSE_PADOFMAP_HPP_
+#define SRC_FEM_CL_MSI_SPARSE_PADOFMAP_HPP_
+
+#include "moris_typedefs.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "cl_Vector.hpp"
+
+namespace moris::MSI
+{
+    //------------------------------------------------------------------------------
+    /**
+     * \brief pdof to adof map (T-matrix) of an equation object stored in compressed row format
+     *
+     * Each row corresponds to a pdof, the entries of a row are the adof positions the pdof
+     * interpolates from and the corresponding T-matrix weights. The map is block sparse for
+     * B-spline and enriched meshes, such that applying it with sparse-dense kernels avoids the
+     * dense products trans( T ) * K * T.
+     */
+    class Sparse_PADofMap
+    {
+      private:
+        // number of pdofs and adofs
+        uint mNumRows = 0;
+        uint mNumCols = 0;
+
+        // row offsets into the column and value lists, size mNumRows + 1
+        Vector< uint > mRowOffsets = { 0 };
+
+        // adof positions and weights
+        Vector< uint > mColumns;
+        Vector< real > mValues;
+
+      public:
+        //------------------------------------------------------------------------------
+
+        Sparse_PADofMap() = default;
+
+        //------------------------------------------------------------------------------
+
+        ~Sparse_PADofMap() = default;
+
+        //------------------------------------------------------------------------------
+        /**
+         * removes all rows and entries
+         */
+        void clear();
+
+        //------------------------------------------------------------------------------
+        /**
+         * starts a new row (pdof)
+         */
+        void add_row();
+
+        //------------------------------------------------------------------------------
+        /**
+         * sets an entry in the last row. An existing entry in the same column is overwritten.
+         * @param[ in ] aColumn adof position
+         * @param[ in ] aValue  T-matrix weight
+         */
+        void set_entry(
+                const uint aColumn,
+                const real aValue );
+
+        //------------------------------------------------------------------------------
+        /**
+         * appends the rows and entries of another map, shifting its columns by the current number of columns
+         * @param[ in ] aBlock map to append as a diagonal block
+         */
+        void append_block( const Sparse_PADofMap& aBlock );
+
+        //------------------------------------------------------------------------------
+        /**
+         * sets the number of columns (adofs)
+         */
+        void
+        set_num_cols( const uint aNumCols )
+        {
+            mNumCols = aNumCols;
+        }
+
+        //------------------------------------------------------------------------------
+
+        uint
+        n_rows() const
+        {
+            return mNumRows;
+        }
+
+        //------------------------------------------------------------------------------
+
+        uint
+        n_cols() const
+        {
+            return mNumCols;
+        }
+
+        //------------------------------------------------------------------------------
+
+        uint
+        get_num_nonzeros() const
+        {
+            return mColumns.size();
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes trans( T ) * aPdofMatrix * T
+         * @param[ in ]  aPdofMatrix pdof matrix, n_rows x n_rows
+         * @param[ out ] aAdofMatrix adof matrix, n_cols x n_cols
+         */
+        void project_matrix(
+                const Matrix< DDRMat >& aPdofMatrix,
+                Matrix< DDRMat >&       aAdofMatrix ) const;
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes trans( T ) * aPdofVector
+         * @param[ in ]  aPdofVector pdof values, n_rows x n
+         * @param[ out ] aAdofVector adof values, n_cols x n
+         */
+        void project_vector(
+                const Matrix< DDRMat >& aPdofVector,
+                Matrix< DDRMat >&       aAdofVector ) const;
+
+        //------------------------------------------------------------------------------
+        /**
+         * computes T * aAdofVector
+         * @param[ in ]  aAdofVector adof values, n_cols x n
+         * @param[ out ] aPdofVector pdof values, n_rows x n
+         */
+        void interpolate(
+                const Matrix< DDRMat >& aAdofVector,
+                Matrix< DDRMat >&       aPdofVector ) const;
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the map as dense matrix, for debugging and testing
+         */
+        Matrix< DDRMat > get_dense() const;
+
+        //------------------------------------------------------------------------------
+    };
+}    // namespace moris::MSI
+
+#endif /* SRC_FEM_CL_MSI_SPARSE_PADOFMAP_HPP_ */
@@ -546,6 +546,65 @@ namespace moris::MSI
         CHECK( equal_to( tPADofMap( 3, 1 ), 10.1 ) );
         CHECK( equal_to( tPADofMap( 3, 5 ), 3.0 ) );
 
+        // Building sparse PADofMap
+        Sparse_PADofMap tSparsePADofMap;
+        EquObj.build_sparse_PADofMap( tSparsePADofMap );
+
+        REQUIRE( tSparsePADofMap.n_rows() == 4 );
+        REQUIRE( tSparsePADofMap.n_cols() == 6 );
+        CHECK( tSparsePADofMap.get_num_nonzeros() == 9 );
+
+        // Checking sparse against dense map
+        Matrix< DDRMat > tDensePADofMap = tSparsePADofMap.get_dense();
+        for ( uint iRow = 0; iRow < 4; iRow++ )
+        {
+            for ( uint iCol = 0; iCol < 6; iCol++ )
+            {
+                CHECK( equal_to( tDensePADofMap( iRow, iCol ), tPADofMap( iRow, iCol ) ) );
+            }
+        }
+
+        // Checking sparse kernels against dense products
+        Matrix< DDRMat > tPdofMatrix( 4, 4 );
+        Matrix< DDRMat > tPdofVector( 4, 1 );
+        Matrix< DDRMat > tAdofVector( 6, 1 );
+        for ( uint iRow = 0; iRow < 4; iRow++ )
+        {
+            tPdofVector( iRow ) = 1.0 + 0.5 * iRow;
+            for ( uint iCol = 0; iCol < 4; iCol++ )
+            {
+                tPdofMatrix( iRow, iCol ) = 1.0 / ( 1.0 + iRow + 2.0 * iCol );
+            }
+        }
+        for ( uint iRow = 0; iRow < 6; iRow++ )
+        {
+            tAdofVector( iRow ) = 2.0 - 0.25 * iRow;
+        }
+
+        Matrix< DDRMat > tProjectedMatrix;
+        Matrix< DDRMat > tProjectedVector;
+        Matrix< DDRMat > tInterpolatedVector;
+        tSparsePADofMap.project_matrix( tPdofMatrix, tProjectedMatrix );
+        tSparsePADofMap.project_vector( tPdofVector, tProjectedVector );
+        tSparsePADofMap.interpolate( tAdofVector, tInterpolatedVector );
+
+        Matrix< DDRMat > tDenseProjectedMatrix    = trans( tPADofMap ) * tPdofMatrix * tPADofMap;
+        Matrix< DDRMat > tDenseProjectedVector    = trans( tPADofMap ) * tPdofVector;
+        Matrix< DDRMat > tDenseInterpolatedVector = tPADofMap * tAdofVector;
+
+        for ( uint iRow = 0; iRow < 6; iRow++ )
+        {
+            CHECK( equal_to( tProjectedVector( iRow ), tDenseProjectedVector( iRow ) ) );
+            for ( uint iCol = 0; iCol < 6; iCol++ )
+            {
+                CHECK( equal_to( tProjectedMatrix( iRow, iCol ), tDenseProjectedMatrix( iRow, iCol ) ) );
+            }
+        }
+        for ( uint iRow = 0; iRow < 4; iRow++ )
+        {
+            CHECK( equal_to( tInterpolatedVector( iRow ), tDenseInterpolatedVector( iRow ) ) );
+        }
+
         delete EquObj.mFreePdofs( 0 );
         delete EquObj.mFreePdofs( 1 );
         delete EquObj.mFreePdofs( 2 );
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SDF_Facet_BVH.cpp
+ *
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "cl_SDF_Facet_BVH.hpp"
+#include "cl_SDF_Facet.hpp"
+
+namespace moris::sdf
+{
+    //-------------------------------------------------------------------------------
+
+    void
+    Facet_BVH::build(
+            const Vector< std::shared_ptr< Facet > >& aFacets,
+            uint                                      aDimension )
+    {
+        mDimension = aDimension;
+
+        uint tNumberOfFacets = aFacets.size();
+
+        mFacets.resize( tNumberOfFacets, nullptr );
+        for ( uint iFacet = 0; iFacet < tNumberOfFacets; iFacet++ )
+        {
+            mFacets( iFacet ) = aFacets( iFacet ).get();
+        }
+
+        mFacetIndices.resize( tNumberOfFacets );
+        std::iota( mFacetIndices.begin(), mFacetIndices.end(), 0 );
+
+        // a binary tree with at least one facet per leaf has less than 2n nodes
+        mNodes.clear();
+        mNodes.reserve( 2 * std::max( tNumberOfFacets, 1u ) );
+
+        if ( tNumberOfFacets > 0 )
+        {
+            this->build_node( 0, tNumberOfFacets );
+        }
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void
+    Facet_BVH::build_node(
+            uint aBegin,
+            uint aEnd )
+    {
+        uint tNodeIndex = mNodes.size();
+        mNodes.push_back( Node() );
+
+        // create a leaf if the number of facets is small enough
+        if ( aEnd - aBegin <= sMaxFacetsPerLeaf )
+        {
+            mNodes( tNodeIndex ).mOffset         = aBegin;
+            mNodes( tNodeIndex ).mNumberOfFacets = aEnd - aBegin;
+            this->compute_leaf_box( mNodes( tNodeIndex ) );
+            return;
+        }
+
+        // determine the bounds of the facet centers
+        real tMinCenter[ 3 ] = { MORIS_REAL_MAX, MORIS_REAL_MAX, MORIS_REAL_MAX };
+        real tMaxCenter[ 3 ] = { -MORIS_REAL_MAX, -MORIS_REAL_MAX, -MORIS_REAL_MAX };
+
+        for ( uint iFacet = aBegin; iFacet < aEnd; iFacet++ )
+        {
+            const Facet* tFacet = mFacets( mFacetIndices( iFacet ) );
+
+            for ( uint iAxis = 0; iAxis < mDimension; iAxis++ )
+            {
+                real tCenter        = 0.5 * ( tFacet->get_min_coord( iAxis ) + tFacet->get_max_coord( iAxis ) );
+                tMinCenter[ iAxis ] = std::min( tMinCenter[ iAxis ], tCenter );
+                tMaxCenter[ iAxis ] = std::max( tMaxCenter[ iAxis ], tCenter );
+            }
+        }
+
+        // split along the axis with the largest extent
+        uint tSplitAxis = 0;
+        for ( uint iAxis = 1; iAxis < mDimension; iAxis++ )
+        {
+            if ( tMaxCenter[ iAxis ] - tMinCenter[ iAxis ] > tMaxCenter[ tSplitAxis ] - tMinCenter[ tSplitAxis ] )
+            {
+                tSplitAxis = iAxis;
+            }
+        }
+
+        // partition the facets at the median center
+        uint tMiddle = aBegin + ( aEnd - aBegin ) / 2;
+
+        std::nth_element(
+                mFacetIndices.begin() + aBegin,
+                mFacetIndices.begin() + tMiddle,
+                mFacetIndices.begin() + aEnd,
+                [ this, tSplitAxis ]( uint aA, uint aB ) {
+                    return mFacets( aA )->get_min_coord( tSplitAxis ) + mFacets( aA )->get_max_coord( tSplitAxis )
+                         < mFacets( aB )->get_min_coord( tSplitAxis ) + mFacets( aB )->get_max_coord( tSplitAxis );
+                } );
+
+        // the left child directly follows this node
+        mNodes( tNodeIndex ).mNumberOfFacets = 0;
+        this->build_node( aBegin, tMiddle );
+
+        mNodes( tNodeIndex ).mOffset = mNodes.size();
+        this->build_node( tMiddle, aEnd );
+
+        // combine the boxes of the children
+        const Node& tLeft  = mNodes( tNodeIndex + 1 );
+        const Node& tRight = mNodes( mNodes( tNodeIndex ).mOffset );
+
+        for ( uint iAxis = 0; iAxis < 3; iAxis++ )
+        {
+            mNodes( tNodeIndex ).mMinCoord[ iAxis ] = std::min( tLeft.mMinCoord[ iAxis ], tRight.mMinCoord[ iAxis ] );
+            mNodes( tNodeIndex ).mMaxCoord[ iAxis ] = std::max( tLeft.mMaxCoord[ iAxis ], tRight.mMaxCoord[ iAxis ] );
+        }
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void
+    Facet_BVH::refit()
+    {
+        // children are stored after their parents, so a reverse sweep visits children first
+        for ( uint iNode = mNodes.size(); iNode-- > 0; )
+        {
+            Node& tNode = mNodes( iNode );
+
+            if ( tNode.mNumberOfFacets > 0 )
+            {
+                this->compute_leaf_box( tNode );
+            }
+            else
+            {
+                const Node& tLeft  = mNodes( iNode + 1 );
+                const Node& tRight = mNodes( tNode.mOffset );
+
+                for ( uint iAxis = 0; iAxis < 3; iAxis++ )
+                {
+                    tNode.mMinCoord[ iAxis ] = std::min( tLeft.mMinCoord[ iAxis ], tRight.mMinCoord[ iAxis ] );
+                    tNode.mMaxCoord[ iAxis ] = std::max( tLeft.mMaxCoord[ iAxis ], tRight.mMaxCoord[ iAxis ] );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void
+    Facet_BVH::compute_leaf_box( Node& aNode ) const
+    {
+        for ( uint iAxis = 0; iAxis < 3; iAxis++ )
+        {
+            aNode.mMinCoord[ iAxis ] = iAxis < mDimension ? MORIS_REAL_MAX : 0.0;
+            aNode.mMaxCoord[ iAxis ] = iAxis < mDimension ? -MORIS_REAL_MAX : 0.0;
+        }
+
+        for ( uint iFacet = aNode.mOffset; iFacet < aNode.mOffset + aNode.mNumberOfFacets; iFacet++ )
+        {
+            const Facet* tFacet = mFacets( mFacetIndices( iFacet ) );
+
+            for ( uint iAxis = 0; iAxis < mDimension; iAxis++ )
+            {
+                aNode.mMinCoord[ iAxis ] = std::min( aNode.mMinCoord[ iAxis ], tFacet->get_min_coord( iAxis ) );
+                aNode.mMaxCoord[ iAxis ] = std::max( aNode.mMaxCoord[ iAxis ], tFacet->get_max_coord( iAxis ) );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void
+    Facet_BVH::collect_facets_along_axis(
+            const Matrix< DDRMat >& aPoint,
+            uint                    aAxis,
+            real                    aTolerance,
+            Vector< uint >&         aFacetIndices ) const
+    {
+        aFacetIndices.clear();
+
+        if ( mNodes.size() == 0 )
+        {
+            return;
+        }
+
+        Vector< uint > tStack;
+        tStack.reserve( 64 );
+        tStack.push_back( 0 );
+
+        while ( tStack.size() > 0 )
+        {
+            uint tNodeIndex = tStack( tStack.size() - 1 );
+            tStack.pop_back();
+
+            const Node& tNode = mNodes( tNodeIndex );
+
+            // check if the line passes through the box in all directions normal to the line
+            bool tIsHit = true;
+            for ( uint iAxis = 0; iAxis < mDimension; iAxis++ )
+            {
+                if ( iAxis != aAxis
+                        && ( aPoint( iAxis ) < tNode.mMinCoord[ iAxis ] - aTolerance
+                                || aPoint( iAxis ) > tNode.mMaxCoord[ iAxis ] + aTolerance ) )
+                {
+                    tIsHit = false;
+                    break;
+                }
+            }
+
+            if ( !tIsHit )
+            {
+                continue;
+            }
+
+            if ( tNode.mNumberOfFacets > 0 )
+            {
+                for ( uint iFacet = tNode.mOffset; iFacet < tNode.mOffset + tNode.mNumberOfFacets; iFacet++ )
+                {
+                    aFacetIndices.push_back( mFacetIndices( iFacet ) );
+                }
+            }
+            else
+            {
+                tStack.push_back( tNode.mOffset );
+                tStack.push_back( tNodeIndex + 1 );
+            }
+        }
+
+        // return facets in the same order as a linear scan would
+        std::sort( aFacetIndices.begin(), aFacetIndices.end() );
+    }
+
+    //-------------------------------------------------------------------------------
+
+    real
+    Facet_BVH::get_distance_to_closest_facet(
+            const Matrix< DDRMat >& aPoint,
+            uint&                   aFacetIndex ) const
+    {
+        MORIS_ERROR( mNodes.size() > 0, "Facet_BVH::get_distance_to_closest_facet() - hierarchy has not been built." );
+
+        real tMinDistance = MORIS_REAL_MAX;
+        aFacetIndex       = MORIS_UINT_MAX;
+
+        Vector< uint > tStack;
+        tStack.reserve( 64 );
+        tStack.push_back( 0 );
+
+        while ( tStack.size() > 0 )
+        {
+            uint tNodeIndex = tStack( tStack.size() - 1 );
+            tStack.pop_back();
+
+            const Node& tNode = mNodes( tNodeIndex );
+
+            // skip subtrees that cannot contain a closer facet
+            if ( this->get_squared_distance_to_box( tNode, aPoint ) >= tMinDistance * tMinDistance )
+            {
+                continue;
+            }
+
+            if ( tNode.mNumberOfFacets > 0 )
+            {
+                for ( uint iFacet = tNode.mOffset; iFacet < tNode.mOffset + tNode.mNumberOfFacets; iFacet++ )
+                {
+                    real tDistance = mFacets( mFacetIndices( iFacet ) )->get_distance_to_point( aPoint );
+
+                    if ( tDistance < tMinDistance )
+                    {
+                        tMinDistance = tDistance;
+                        aFacetIndex  = mFacetIndices( iFacet );
+                    }
+                }
+            }
+            else
+            {
+                uint tLeft  = tNodeIndex + 1;
+                uint tRight = tNode.mOffset;
+
+                // visit the closer child first
+                if ( this->get_squared_distance_to_box( mNodes( tLeft ), aPoint )
+                        < this->get_squared_distance_to_box( mNodes( tRight ), aPoint ) )
+                {
+                    std::swap( tLeft, tRight );
+                }
+
+                tStack.push_back( tLeft );
+                tStack.push_back( tRight );
+            }
+        }
+
+        return tMinDistance;
+    }
+
+    //-------------------------------------------------------------------------------
+
+    real
+    Facet_BVH::get_squared_distance_to_box(
+            const Node&             aNode,
+            const Matrix< DDRMat >& aPoint ) const
+    {
+        real tSquaredDistance = 0.0;
+
+        for ( uint iAxis = 0; iAxis < mDimension; iAxis++ )
+        {
+            real tDelta = std::max( { aNode.mMinCoord[ iAxis ] - aPoint( iAxis ), 0.0, aPoint( iAxis ) - aNode.mMaxCoord[ iAxis ] } );
+
+            tSquaredDistance += tDelta * tDelta;
+        }
+
+        return tSquaredDistance;
+    }
+
+    //-------------------------------------------------------------------------------
+}    // namespace moris::sdf
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_SDF_Facet_BVH.hpp
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "moris_typedefs.hpp"
+#include "cl_Vector.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+namespace moris::sdf
+{
+    //-------------------------------------------------------------------------------
+
+    class Facet;
+
+    //-------------------------------------------------------------------------------
+
+    /**
+     * Bounding volume hierarchy over the axis aligned bounding boxes of the facets of an object.
+     * The tree is built once by median splits of the facet centers. Moving the facets only
+     * requires a refit of the boxes, which keeps all queries correct.
+     */
+    class Facet_BVH
+    {
+        /**
+         * node of the hierarchy. The left child of a node directly follows its parent.
+         */
+        struct Node
+        {
+            real mMinCoord[ 3 ];
+            real mMaxCoord[ 3 ];
+
+            // offset of first facet in mFacetIndices, or index of right child for inner nodes
+            uint mOffset;
+
+            // number of facets, zero for inner nodes
+            uint mNumberOfFacets;
+        };
+
+        //! maximum number of facets per leaf
+        static constexpr uint sMaxFacetsPerLeaf = 4;
+
+        uint mDimension = 0;
+
+        Vector< Node > mNodes;
+
+        //! facet indices sorted by leaf
+        Vector< uint > mFacetIndices;
+
+        //! facets of the object, owned by the object
+        Vector< Facet* > mFacets;
+
+        //-------------------------------------------------------------------------------
+
+      public:
+        //-------------------------------------------------------------------------------
+
+        Facet_BVH() = default;
+
+        //-------------------------------------------------------------------------------
+
+        ~Facet_BVH() = default;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * builds the hierarchy
+         *
+         * @param aFacets facets of the object
+         * @param aDimension spatial dimension of the object
+         */
+        void
+        build(
+                const Vector< std::shared_ptr< Facet > >& aFacets,
+                uint                                      aDimension );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * recomputes the bounding boxes after the facets have been moved. The tree topology is kept.
+         */
+        void
+        refit();
+
+        //-------------------------------------------------------------------------------
+
+        bool
+        is_built() const
+        {
+            return mNodes.size() > 0;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Collects all facets whose bounding box, enlarged by aTolerance, is hit by the line
+         * through aPoint parallel to the coordinate axis aAxis.
+         *
+         * @param aPoint origin of the line
+         * @param aAxis coordinate axis of the line
+         * @param aTolerance enlargement of the bounding boxes in the directions normal to the line
+         * @param aFacetIndices return variable, indices of the facets in ascending order
+         */
+        void
+        collect_facets_along_axis(
+                const Matrix< DDRMat >& aPoint,
+                uint                    aAxis,
+                real                    aTolerance,
+                Vector< uint >&         aFacetIndices ) const;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Finds the facet closest to aPoint. Subtrees whose bounding box is further away than
+         * the closest facet found so far are skipped.
+         *
+         * @param aPoint query point
+         * @param aFacetIndex return variable, index of the closest facet
+         * @return distance of aPoint to the closest facet
+         */
+        real
+        get_distance_to_closest_facet(
+                const Matrix< DDRMat >& aPoint,
+                uint&                   aFacetIndex ) const;
+
+        //-------------------------------------------------------------------------------
+
+      private:
+        //-------------------------------------------------------------------------------
+
+        /**
+         * recursively builds the subtree of the facets in mFacetIndices[ aBegin, aEnd )
+         */
+        void
+        build_node(
+                uint aBegin,
+                uint aEnd );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * computes the bounding box of a leaf from its facets
+         */
+        void
+        compute_leaf_box( Node& aNode ) const;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * squared distance of a point to the bounding box of a node
+         */
+        real
+        get_squared_distance_to_box(
+                const Node&             aNode,
+                const Matrix< DDRMat >& aPoint ) const;
+
+        //-------------------------------------------------------------------------------
+    };
+
+    //-------------------------------------------------------------------------------
+}    // namespace moris::sdf
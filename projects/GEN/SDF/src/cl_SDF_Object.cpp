@@ -407,6 +407,9 @@ namespace moris::sdf
         {
             mFacets( iFacet )->reset_vertex_transformed_flags();
         }
+
+        // facet bounding boxes have changed
+        mBVHNeedsRefit = true;
     }
 
     //-------------------------------------------------------------------------------
@@ -430,6 +433,9 @@ namespace moris::sdf
         {
             mFacets( iFacet )->reset_vertex_transformed_flags();
         }
+
+        // facet bounding boxes have changed
+        mBVHNeedsRefit = true;
     }
 
     //-------------------------------------------------------------------------------
@@ -453,6 +459,9 @@ namespace moris::sdf
         {
             mFacets( iFacet )->reset_vertex_transformed_flags();
         }
+
+        // facet bounding boxes have changed
+        mBVHNeedsRefit = true;
     }
 
     //-------------------------------------------------------------------------------
@@ -468,6 +477,9 @@ namespace moris::sdf
             // recompute information about the facet (normal, center, etc.)
             mFacets( iFacet )->update_data();
         }
+
+        // facet bounding boxes have changed
+        mBVHNeedsRefit = true;
     }
 
     //-------------------------------------------------------------------------------
@@ -499,4 +511,23 @@ namespace moris::sdf
 
     //-------------------------------------------------------------------------------
 
+    const Facet_BVH&
+    Object::get_bvh()
+    {
+        if ( !mBVH.is_built() )
+        {
+            mBVH.build( mFacets, mDimension );
+        }
+        else if ( mBVHNeedsRefit )
+        {
+            mBVH.refit();
+        }
+
+        mBVHNeedsRefit = false;
+
+        return mBVH;
+    }
+
+    //-------------------------------------------------------------------------------
+
 }    // namespace moris::sdf
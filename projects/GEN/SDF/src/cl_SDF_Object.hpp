@@ -17,6 +17,7 @@
 #include "cl_Vector.hpp"
 #include "cl_SDF_Triangle.hpp"
 #include "cl_SDF_Line.hpp"
+#include "cl_SDF_Facet_BVH.hpp"
 
 namespace moris::sdf
 {
@@ -29,6 +30,12 @@ namespace moris::sdf
         uint mDimension;
         uint mNumberOfFacets;
 
+        // bounding volume hierarchy of the facets, built on first use
+        Facet_BVH mBVH;
+
+        // flag that the facets have moved since the hierarchy was last fitted
+        bool mBVHNeedsRefit = false;
+
         //-------------------------------------------------------------------------------
 
       public:
@@ -120,6 +127,15 @@ namespace moris::sdf
                 uint aFacetIndex,
                 uint aAxis );
 
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Returns the bounding volume hierarchy of the facets. The hierarchy is built on the first call
+         * and its bounding boxes are refitted if the object has been rotated, scaled, or shifted since.
+         */
+        const Facet_BVH&
+        get_bvh();
+
         //-------------------------------------------------------------------------------
         // MTK
         //-------------------------------------------------------------------------------
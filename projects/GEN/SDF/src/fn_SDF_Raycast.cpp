@@ -8,6 +8,8 @@
  *
  */
 
+#include <cmath>
+
 #include "fn_sort.hpp"
 #include "fn_trans.hpp"
 
@@ -241,38 +243,29 @@ namespace moris::sdf
             }
         }
 
-        uint         tCountJ = 0;
-        Vector< uint > tCandJ( aObject.get_num_facets() );
-        for ( uint iFacetIndex = 0; iFacetIndex < aObject.get_num_facets(); ++iFacetIndex )
-        {
-            // check bounding box in J-direction
-            if ( ( aPoint( tFirstAxis ) - aObject.get_facet_min_coord( iFacetIndex, tFirstAxis ) )
-                            * ( aObject.get_facet_max_coord( iFacetIndex, tFirstAxis ) - aPoint( tFirstAxis ) )
-                    > -MORIS_REAL_EPS )
-            {
-                // remember this triangle
-                tCandJ( tCountJ ) = iFacetIndex;
-
-                // increment counter
-                ++tCountJ;
-            }
-        }
+        // facets whose bounding box is close to the ray. The bounding box check below accepts points
+        // outside of a box by at most the square root of the tolerance, so the search box is enlarged by this amount.
+        Vector< uint > tCandidates;
+        aObject.get_bvh().collect_facets_along_axis( aPoint, aAxis, std::sqrt( MORIS_REAL_EPS ), tCandidates );
 
         // counter for triangles
         uint tCount = 0;
 
         // reset candidate size
-        Vector< uint > tCandidateFacets( aObject.get_num_facets() );
+        Vector< uint > tCandidateFacets( tCandidates.size() );
 
-        // loop over remaining triangles in I-direction
-        for ( uint k = 0; k < tCountJ; ++k )
+        // loop over remaining triangles
+        for ( uint iFacetIndex : tCandidates )
         {
-            // check bounding box in I-direction
-            if ( ( aPoint( tSecondAxis ) - aObject.get_facet_min_coord( tCandJ( k ), tSecondAxis ) )
-                            * ( aObject.get_facet_max_coord( tCandJ( k ), tSecondAxis ) - aPoint( tSecondAxis ) )
-                    > -MORIS_REAL_EPS )
+            // check bounding box in J-direction and I-direction
+            if ( ( aPoint( tFirstAxis ) - aObject.get_facet_min_coord( iFacetIndex, tFirstAxis ) )
+                                 * ( aObject.get_facet_max_coord( iFacetIndex, tFirstAxis ) - aPoint( tFirstAxis ) )
+                         > -MORIS_REAL_EPS
+                    && ( aPoint( tSecondAxis ) - aObject.get_facet_min_coord( iFacetIndex, tSecondAxis ) )
+                                    * ( aObject.get_facet_max_coord( iFacetIndex, tSecondAxis ) - aPoint( tSecondAxis ) )
+                            > -MORIS_REAL_EPS )
             {
-                tCandidateFacets( tCount ) = tCandJ( k );
+                tCandidateFacets( tCount ) = iFacetIndex;
                 ++tCount;
             }
         }
@@ -302,17 +295,21 @@ namespace moris::sdf
                 "SDF_ preselect_lines() should be called for 2D problems only. Query point dimension = %lu",
                 aPoint.numel() );
 
-        // reset candidate and intersected facet size
-        aIntersectedFacets.resize( aObject.get_num_facets() );
-        aCandidateFacets.resize( aObject.get_num_facets() );
-
         // get the other axis
         uint tOtherAxis = not aAxis;
 
+        // lines whose bounding box is close to the ray. Covers the vertex check as well as the bounding box check below.
+        Vector< uint > tLines;
+        aObject.get_bvh().collect_facets_along_axis( aPoint, aAxis, std::max( gSDFepsilon, std::sqrt( MORIS_REAL_EPS ) ), tLines );
+
+        // reset candidate and intersected facet size
+        aIntersectedFacets.resize( tLines.size() );
+        aCandidateFacets.resize( tLines.size() );
+
         uint tCandidateCount        = 0;
         uint tIntersectedFacetCount = 0;
-        // loop over all lines in the aAxis direction
-        for ( uint iLineIndex = 0; iLineIndex < aObject.get_num_facets(); iLineIndex++ )
+        // loop over all lines close to the ray in the aAxis direction
+        for ( uint iLineIndex : tLines )
         {
             // get the difference of the cast point and the facet min and max coords in the !aAxis direction
             real tMaxCoordOffAxisDifference = aObject.get_facet_max_coord( iLineIndex, tOtherAxis ) - aPoint( tOtherAxis );
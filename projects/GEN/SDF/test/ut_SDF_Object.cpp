@@ -10,6 +10,7 @@
 
 #include <catch.hpp>
 #include <algorithm>
+#include <random>
 #include "moris_typedefs.hpp"
 #include "cl_Matrix.hpp"
 #include "paths.hpp"
@@ -77,4 +78,83 @@ namespace moris::sdf
         // reset
         tObject.reset_coordinates();
     }
+
+    TEST_CASE( "SDF::Object BVH", "[gen], [sdf], [object bvh test]" )
+    {
+        // CAD surface with 1290 triangles
+        std::string tObjectPath = get_base_moris_dir() + "/projects/GEN/test/bracket.obj";
+        Object      tObject( tObjectPath );
+
+        REQUIRE( tObject.get_num_facets() == 1290 );
+
+        std::mt19937                     tGenerator( 1234 );
+        std::uniform_real_distribution<> tDistributionX( -5.0, 1.0 );
+        std::uniform_real_distribution<> tDistributionY( 3.0, 6.0 );
+        std::uniform_real_distribution<> tDistributionZ( -2.0, 2.0 );
+
+        // compares the hierarchy against a scan over all facets
+        auto tCheckQueries = [ & ]()
+        {
+            const Facet_BVH& tBVH = tObject.get_bvh();
+
+            for ( uint iPoint = 0; iPoint < 20; iPoint++ )
+            {
+                Matrix< DDRMat > tPoint = { { tDistributionX( tGenerator ) }, { tDistributionY( tGenerator ) }, { tDistributionZ( tGenerator ) } };
+
+                for ( uint iAxis = 0; iAxis < 3; iAxis++ )
+                {
+                    Vector< uint > tFacets;
+                    tBVH.collect_facets_along_axis( tPoint, iAxis, 0.0, tFacets );
+
+                    Vector< uint > tFacetsExpected;
+                    for ( uint iFacet = 0; iFacet < tObject.get_num_facets(); iFacet++ )
+                    {
+                        bool tIsHit = true;
+                        for ( uint iOtherAxis = 0; iOtherAxis < 3; iOtherAxis++ )
+                        {
+                            if ( iOtherAxis != iAxis
+                                    && ( tPoint( iOtherAxis ) < tObject.get_facet_min_coord( iFacet, iOtherAxis )
+                                            || tPoint( iOtherAxis ) > tObject.get_facet_max_coord( iFacet, iOtherAxis ) ) )
+                            {
+                                tIsHit = false;
+                            }
+                        }
+
+                        if ( tIsHit )
+                        {
+                            tFacetsExpected.push_back( iFacet );
+                        }
+                    }
+
+                    REQUIRE( tFacets.size() == tFacetsExpected.size() );
+                    for ( uint iFacet = 0; iFacet < tFacets.size(); iFacet++ )
+                    {
+                        CHECK( tFacets( iFacet ) == tFacetsExpected( iFacet ) );
+                    }
+                }
+
+                // closest facet
+                uint tClosestFacet;
+                real tDistance = tBVH.get_distance_to_closest_facet( tPoint, tClosestFacet );
+
+                real tDistanceExpected = MORIS_REAL_MAX;
+                for ( uint iFacet = 0; iFacet < tObject.get_num_facets(); iFacet++ )
+                {
+                    tDistanceExpected = std::min( tDistanceExpected, tObject.get_facet( iFacet ).get_distance_to_point( tPoint ) );
+                }
+
+                CHECK( std::abs( tDistance - tDistanceExpected ) < 1e-12 );
+                CHECK( std::abs( tObject.get_facet( tClosestFacet ).get_distance_to_point( tPoint ) - tDistance ) < 1e-12 );
+            }
+        };
+
+        tCheckQueries();
+
+        // the hierarchy follows the facets when the object is moved
+        tObject.shift( { 0.3, -0.2, 0.1 } );
+        tCheckQueries();
+
+        tObject.reset_coordinates();
+        tCheckQueries();
+    }
 }    // namespace moris::sdf
@@ -10,6 +10,7 @@
 
 #include "cl_GEN_Design_Field.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "cl_MTK_Interpolation_Mesh.hpp"
 #include "cl_GEN_BSpline_Field.hpp"
@@ -145,6 +146,20 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void Design_Field::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues ) const
+    {
+        // Derived nodes are not supported here, since they need to be interpolated
+        MORIS_ASSERT( aNodeIndices.size() == 0 or mNodeManager->is_background_node( *std::max_element( aNodeIndices.begin(), aNodeIndices.end() ) ),
+                "Design_Field::get_field_values() can only be called with background nodes." );
+
+        mField->get_field_values( aNodeIndices, aCoordinates, aFieldValues );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix< DDRMat >& Design_Field::get_dfield_dadvs(
             uint                    aNodeIndex,
             const Matrix< DDRMat >& aCoordinates )
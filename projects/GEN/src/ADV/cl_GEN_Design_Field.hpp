@@ -100,6 +100,18 @@ namespace moris::gen
                 uint                    aNodeIndex,
                 const Matrix< DDRMat >& aCoordinates ) const;
 
+        /**
+         * Evaluates the field at a block of background nodes.
+         *
+         * @param aNodeIndices Background node indices
+         * @param aCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aFieldValues Field values
+         */
+        void get_field_values(
+                const Vector< uint >&   aNodeIndices,
+                const Matrix< DDRMat >& aCoordinates,
+                Vector< real >&         aFieldValues ) const;
+
         /**
          * Gets the IDs of ADVs which this design component depends on for evaluations.
          *
@@ -31,4 +31,23 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void Geometry::get_geometric_regions(
+            const Vector< uint >&       aNodeIndices,
+            const Matrix< DDRMat >&     aNodeCoordinates,
+            Vector< Geometric_Region >& aGeometricRegions )
+    {
+        // Coordinates of a single node
+        Matrix< DDRMat > tNodeCoordinates( 1, aNodeCoordinates.n_cols() );
+
+        // Evaluate each node separately
+        aGeometricRegions.resize( aNodeIndices.size() );
+        for ( uint iNode = 0; iNode < aNodeIndices.size(); iNode++ )
+        {
+            aNodeCoordinates.get_row( iNode, tNodeCoordinates );
+            aGeometricRegions( iNode ) = this->get_geometric_region( aNodeIndices( iNode ), tNodeCoordinates );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
 }
@@ -83,6 +83,19 @@ namespace moris::gen
                 uint                    aNodeIndex,
                 const Matrix< DDRMat >& aNodeCoordinates ) = 0;
 
+        /**
+         * Gets the geometric regions of a block of background nodes. Default implementation evaluates
+         * the nodes one at a time.
+         *
+         * @param aNodeIndices Background node indices
+         * @param aNodeCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aGeometricRegions Geometric region of each node
+         */
+        virtual void get_geometric_regions(
+                const Vector< uint >&       aNodeIndices,
+                const Matrix< DDRMat >&     aNodeCoordinates,
+                Vector< Geometric_Region >& aGeometricRegions );
+
         /**
          * Creates an intersection node based on the given information. The intersection node may or may not represent an intersection;
          * that is, its position may lie outside of the edge definition based on the given nodal coordinates. This information can be
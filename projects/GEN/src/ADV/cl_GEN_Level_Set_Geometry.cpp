@@ -126,6 +126,25 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void Level_Set_Geometry::get_geometric_regions(
+            const Vector< uint >&       aNodeIndices,
+            const Matrix< DDRMat >&     aNodeCoordinates,
+            Vector< Geometric_Region >& aGeometricRegions )
+    {
+        // Evaluate all nodes at once
+        Vector< real > tFieldValues;
+        this->get_field_values( aNodeIndices, aNodeCoordinates, tFieldValues );
+
+        // Classify field values
+        aGeometricRegions.resize( tFieldValues.size() );
+        for ( uint iNode = 0; iNode < tFieldValues.size(); iNode++ )
+        {
+            aGeometricRegions( iNode ) = this->determine_geometric_region( tFieldValues( iNode ) );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     Intersection_Node* Level_Set_Geometry::create_intersection_node(
             uint                              aNodeIndex,
             const Vector< Background_Node* >& aBackgroundNodes,
@@ -85,6 +85,18 @@ namespace moris::gen
                 uint                    aNodeIndex,
                 const Matrix< DDRMat >& aNodeCoordinates ) override;
 
+        /**
+         * Gets the geometric regions of a block of background nodes from a single batched field evaluation.
+         *
+         * @param aNodeIndices Background node indices
+         * @param aNodeCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aGeometricRegions Geometric region of each node
+         */
+        void get_geometric_regions(
+                const Vector< uint >&       aNodeIndices,
+                const Matrix< DDRMat >&     aNodeCoordinates,
+                Vector< Geometric_Region >& aGeometricRegions ) override;
+
         /**
          * Creates an intersection node based on the given information. The intersection node may or may not represent an intersection;
          * that is, its position may lie outside of the edge definition based on the given nodal coordinates. This information can be
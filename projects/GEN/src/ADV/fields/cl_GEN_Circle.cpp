@@ -9,6 +9,7 @@
  */
 
 #include "cl_GEN_Circle.hpp"
+#include "moris_openmp.hpp"
 
 namespace moris::gen
 {
@@ -40,6 +41,44 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Circle::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        // Get variables
+        real tXCenter = mADVHandler.get_variable( 0 );
+        real tYCenter = mADVHandler.get_variable( 1 );
+        real tRadius  = mADVHandler.get_variable( 2 );
+
+        // Size output
+        uint tNumberOfNodes = aCoordinates.n_rows();
+        aFieldValues.resize( tNumberOfNodes );
+
+        if ( tNumberOfNodes == 0 )
+        {
+            return;
+        }
+
+        // Coordinate columns are contiguous
+        const real* tX      = &aCoordinates( 0, 0 );
+        const real* tY      = &aCoordinates( 0, 1 );
+        real*       tValues = aFieldValues.memptr();
+
+        // Evaluate field
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            real tDeltaX = tX[ iNode ] - tXCenter;
+            real tDeltaY = tY[ iNode ] - tYCenter;
+
+            tValues[ iNode ] = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY ) - tRadius;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix< DDRMat >&
     Circle::get_dfield_dadvs( const Matrix< DDRMat >& aCoordinates )
     {
@@ -42,6 +42,18 @@ namespace moris::gen
          */
         real get_field_value( const Matrix< DDRMat >& aCoordinates ) override;
 
+        /**
+         * Evaluates the field at a block of nodes with a vectorizable loop.
+         *
+         * @param aNodeIndices Node indices
+         * @param aCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aFieldValues Field values
+         */
+        void get_field_values(
+                const Vector< uint >&   aNodeIndices,
+                const Matrix< DDRMat >& aCoordinates,
+                Vector< real >&         aFieldValues ) override;
+
         /**
          * Given a node coordinate, evaluates the sensitivity of the field with respect to all of the
          * field variables.
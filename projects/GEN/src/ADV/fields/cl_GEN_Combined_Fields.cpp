@@ -10,6 +10,7 @@
 
 #include "cl_GEN_Combined_Fields.hpp"
 #include "cl_MTK_Field_Discrete.hpp"
+#include "moris_openmp.hpp"
 
 namespace moris::gen
 {
@@ -57,6 +58,49 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void Combined_Fields::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        // Evaluate first field directly into the result
+        mFields( 0 )->get_field_values( aNodeIndices, aCoordinates, aFieldValues );
+
+        uint  tNumberOfNodes = aFieldValues.size();
+        real* tResult        = aFieldValues.memptr();
+        real  tScale         = mScale;
+
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            tResult[ iNode ] *= tScale;
+        }
+
+        // Fold the remaining fields into the result
+        Vector< real > tFieldValues;
+        for ( uint iField = 1; iField < mFields.size(); iField++ )
+        {
+            mFields( iField )->get_field_values( aNodeIndices, aCoordinates, tFieldValues );
+
+            const real* tValues = tFieldValues.memptr();
+
+            MORIS_OMP_PRAGMA( omp simd )
+            for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+            {
+                tResult[ iNode ] = std::min( tResult[ iNode ], tScale * tValues[ iNode ] );
+            }
+        }
+
+        // Undo scaling
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            tResult[ iNode ] *= tScale;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix< DDRMat >& Combined_Fields::get_dfield_dadvs(
             uint                    aNodeIndex,
             const Matrix< DDRMat >& aCoordinates )
@@ -55,6 +55,19 @@ namespace moris::gen
                 const Derived_Node& aDerivedNode,
                 const Node_Manager& aNodeManager ) override;
 
+        /**
+         * Evaluates all combined fields at a block of nodes and reduces them to the minimum (or maximum) in a
+         * single pass per field, without evaluating the nodes one at a time.
+         *
+         * @param aNodeIndices Node indices
+         * @param aCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aFieldValues Minimum field values, after scaling has been applied
+         */
+        void get_field_values(
+                const Vector< uint >&   aNodeIndices,
+                const Matrix< DDRMat >& aCoordinates,
+                Vector< real >&         aFieldValues ) override;
+
         /**
          * Given a node index or coordinate, returns a vector of the field derivatives with respect to its ADVs.
          *
@@ -91,6 +91,29 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void Field::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        MORIS_ASSERT( aNodeIndices.size() == aCoordinates.n_rows(),
+                "Field::get_field_values() - Number of node indices and coordinates do not match." );
+
+        // Coordinates of a single node
+        Matrix< DDRMat > tNodeCoordinates( 1, aCoordinates.n_cols() );
+
+        // Evaluate each node separately
+        uint tNumberOfNodes = aNodeIndices.size();
+        aFieldValues.resize( tNumberOfNodes );
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            aCoordinates.get_row( iNode, tNodeCoordinates );
+            aFieldValues( iNode ) = this->get_field_value( aNodeIndices( iNode ), tNodeCoordinates );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     real Field::get_interpolated_field_value(
             const Vector< Basis_Node >& aBasisNodes,
             const Node_Manager&         aNodeManager )
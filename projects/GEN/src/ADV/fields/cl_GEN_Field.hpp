@@ -170,6 +170,20 @@ namespace moris::gen
                 const Derived_Node& aDerivedNode,
                 const Node_Manager& aNodeManager ) = 0;
 
+        /**
+         * Evaluates the field at a block of background nodes. The coordinates are stored with one column per
+         * spatial dimension, so each coordinate direction is contiguous in memory. The default implementation
+         * evaluates the nodes one at a time; fields with a closed form override this with a vectorizable loop.
+         *
+         * @param aNodeIndices Node indices
+         * @param aCoordinates Node coordinates, number of nodes x number of dimensions
+         * @param aFieldValues Field values, resized to the number of nodes
+         */
+        virtual void get_field_values(
+                const Vector< uint >&   aNodeIndices,
+                const Matrix< DDRMat >& aCoordinates,
+                Vector< real >&         aFieldValues );
+
         /**
          * Gets an interpolated field value based on given basis nodes.
          *
@@ -9,6 +9,7 @@
  */
 
 #include "cl_GEN_Plane.hpp"
+#include "moris_openmp.hpp"
 
 namespace moris::gen
 {
@@ -45,6 +46,45 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Plane::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        // Get variables
+        real tXCenter = mADVHandler.get_variable( 0 );
+        real tYCenter = mADVHandler.get_variable( 1 );
+        real tZCenter = mADVHandler.get_variable( 2 );
+        real tXNormal = mADVHandler.get_variable( 3 );
+        real tYNormal = mADVHandler.get_variable( 4 );
+        real tZNormal = mADVHandler.get_variable( 5 );
+
+        // Size output
+        uint tNumberOfNodes = aCoordinates.n_rows();
+        aFieldValues.resize( tNumberOfNodes );
+
+        if ( tNumberOfNodes == 0 )
+        {
+            return;
+        }
+
+        // Coordinate columns are contiguous
+        const real* tX      = &aCoordinates( 0, 0 );
+        const real* tY      = &aCoordinates( 0, 1 );
+        const real* tZ      = &aCoordinates( 0, 2 );
+        real*       tValues = aFieldValues.memptr();
+
+        // Evaluate field values
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            tValues[ iNode ] = tXNormal * ( tX[ iNode ] - tXCenter ) + tYNormal * ( tY[ iNode ] - tYCenter ) + tZNormal * ( tZ[ iNode ] - tZCenter );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix< DDRMat >&
     Plane::get_dfield_dadvs( const Matrix< DDRMat >& aCoordinates )
     {
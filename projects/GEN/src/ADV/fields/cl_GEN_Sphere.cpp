@@ -9,6 +9,7 @@
  */
 
 #include "cl_GEN_Sphere.hpp"
+#include "moris_openmp.hpp"
 
 namespace moris::gen
 {
@@ -44,6 +45,47 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Sphere::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        // Get variables
+        real tXCenter = mADVHandler.get_variable( 0 );
+        real tYCenter = mADVHandler.get_variable( 1 );
+        real tZCenter = mADVHandler.get_variable( 2 );
+        real tRadius  = mADVHandler.get_variable( 3 );
+
+        // Size output
+        uint tNumberOfNodes = aCoordinates.n_rows();
+        aFieldValues.resize( tNumberOfNodes );
+
+        if ( tNumberOfNodes == 0 )
+        {
+            return;
+        }
+
+        // Coordinate columns are contiguous
+        const real* tX      = &aCoordinates( 0, 0 );
+        const real* tY      = &aCoordinates( 0, 1 );
+        const real* tZ      = &aCoordinates( 0, 2 );
+        real*       tValues = aFieldValues.memptr();
+
+        // Evaluate field
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            real tDeltaX = tX[ iNode ] - tXCenter;
+            real tDeltaY = tY[ iNode ] - tYCenter;
+            real tDeltaZ = tZ[ iNode ] - tZCenter;
+
+            tValues[ iNode ] = std::sqrt( tDeltaX * tDeltaX + tDeltaY * tDeltaY + tDeltaZ * tDeltaZ ) - tRadius;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix< DDRMat >&
     Sphere::get_dfield_dadvs( const Matrix< DDRMat >& aCoordinates )
     {
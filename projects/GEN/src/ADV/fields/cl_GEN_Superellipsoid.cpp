@@ -9,6 +9,7 @@
  */
 
 #include "cl_GEN_Superellipsoid.hpp"
+#include "moris_openmp.hpp"
 
 namespace moris::gen
 {
@@ -50,6 +51,50 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Superellipsoid::get_field_values(
+            const Vector< uint >&   aNodeIndices,
+            const Matrix< DDRMat >& aCoordinates,
+            Vector< real >&         aFieldValues )
+    {
+        // Get variables
+        real tXCenter       = mADVHandler.get_variable( 0 );
+        real tYCenter       = mADVHandler.get_variable( 1 );
+        real tZCenter       = mADVHandler.get_variable( 2 );
+        real tXSemidiameter = mADVHandler.get_variable( 3 );
+        real tYSemidiameter = mADVHandler.get_variable( 4 );
+        real tZSemidiameter = mADVHandler.get_variable( 5 );
+        real tExponent      = mADVHandler.get_variable( 6 );
+
+        // Size output
+        uint tNumberOfNodes = aCoordinates.n_rows();
+        aFieldValues.resize( tNumberOfNodes );
+
+        if ( tNumberOfNodes == 0 )
+        {
+            return;
+        }
+
+        // Coordinate columns are contiguous
+        const real* tX      = &aCoordinates( 0, 0 );
+        const real* tY      = &aCoordinates( 0, 1 );
+        const real* tZ      = &aCoordinates( 0, 2 );
+        real*       tValues = aFieldValues.memptr();
+
+        // Evaluate field
+        MORIS_OMP_PRAGMA( omp simd )
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            tValues[ iNode ] = std::pow( std::pow( std::abs( tX[ iNode ] - tXCenter ) / tXSemidiameter, tExponent )
+                                                 + std::pow( std::abs( tY[ iNode ] - tYCenter ) / tYSemidiameter, tExponent )
+                                                 + std::pow( std::abs( tZ[ iNode ] - tZCenter ) / tZSemidiameter, tExponent ),
+                                       1.0 / tExponent )
+                             - 1.0;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     const Matrix<DDRMat>& Superellipsoid::get_dfield_dadvs(const Matrix<DDRMat>& aCoordinates)
     {
         // Get variables
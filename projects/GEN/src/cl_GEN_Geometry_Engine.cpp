@@ -150,6 +150,9 @@ namespace moris::gen
         mOwnedADVs->vector_global_assembly();
         mPrimitiveADVs->import_local_to_global( *mOwnedADVs );
 
+        // Classified background nodes are no longer valid
+        this->clear_background_node_regions();
+
         // Import ADVs into fields that need it
         for ( uint tGeometryIndex = 0; tGeometryIndex < mGeometries.size(); tGeometryIndex++ )
         {
@@ -281,13 +284,13 @@ namespace moris::gen
             Vector< std::shared_ptr< moris::Matrix< moris::DDRMat > > >* aNodeCoordinates )
     {
         // Get first geometric region
-        Geometric_Region tFirstNodeGeometricRegion = mGeometries( aGeometryIndex )->get_geometric_region( aNodeIndices( 0 ), *( *aNodeCoordinates )( aNodeIndices( 0 ) ) );
+        Geometric_Region tFirstNodeGeometricRegion = this->get_classified_geometric_region( aGeometryIndex, aNodeIndices( 0 ), *( *aNodeCoordinates )( aNodeIndices( 0 ) ) );
 
         // Test nodes for other geometric regions
         for ( uint iNodeInEntityIndex = 0; iNodeInEntityIndex < aNodeIndices.length(); iNodeInEntityIndex++ )
         {
             // Get test geometric region
-            Geometric_Region tTestGeometricRegion = mGeometries( aGeometryIndex )->get_geometric_region( aNodeIndices( iNodeInEntityIndex ), *( *aNodeCoordinates )( aNodeIndices( iNodeInEntityIndex ) ) );
+            Geometric_Region tTestGeometricRegion = this->get_classified_geometric_region( aGeometryIndex, aNodeIndices( iNodeInEntityIndex ), *( *aNodeCoordinates )( aNodeIndices( iNodeInEntityIndex ) ) );
 
             // Test if it is different from the first region. If so, the entity is intersected
             if ( tTestGeometricRegion != tFirstNodeGeometricRegion )
@@ -302,6 +305,70 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Geometry_Engine::classify_background_nodes()
+    {
+        // Nothing to classify without a mesh
+        uint tNumberOfNodes = mNodeManager.get_number_of_background_nodes();
+        if ( tNumberOfNodes == 0 )
+        {
+            this->clear_background_node_regions();
+            return;
+        }
+
+        // Gather coordinates of all background nodes, one column per spatial dimension
+        uint tNumberOfDimensions = mNodeManager.get_background_node( 0 ).get_global_coordinates().numel();
+
+        Vector< uint >   tNodeIndices( tNumberOfNodes );
+        Matrix< DDRMat > tNodeCoordinates( tNumberOfNodes, tNumberOfDimensions );
+
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            const Matrix< DDRMat >& tCoordinates = mNodeManager.get_background_node( iNode ).get_global_coordinates();
+
+            tNodeIndices( iNode ) = iNode;
+            for ( uint iDimension = 0; iDimension < tNumberOfDimensions; iDimension++ )
+            {
+                tNodeCoordinates( iNode, iDimension ) = tCoordinates( iDimension );
+            }
+        }
+
+        // Classify all nodes for each geometry
+        mBackgroundNodeRegions.resize( mGeometries.size() );
+        for ( uint iGeometryIndex = 0; iGeometryIndex < mGeometries.size(); iGeometryIndex++ )
+        {
+            mGeometries( iGeometryIndex )->get_geometric_regions( tNodeIndices, tNodeCoordinates, mBackgroundNodeRegions( iGeometryIndex ) );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
+    void
+    Geometry_Engine::clear_background_node_regions()
+    {
+        mBackgroundNodeRegions.clear();
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
+    Geometric_Region
+    Geometry_Engine::get_classified_geometric_region(
+            uint                    aGeometryIndex,
+            uint                    aNodeIndex,
+            const Matrix< DDRMat >& aNodeCoordinates )
+    {
+        // Use classified background node if possible
+        if ( aGeometryIndex < mBackgroundNodeRegions.size() and aNodeIndex < mBackgroundNodeRegions( aGeometryIndex ).size() )
+        {
+            return mBackgroundNodeRegions( aGeometryIndex )( aNodeIndex );
+        }
+
+        // Otherwise evaluate the node
+        return mGeometries( aGeometryIndex )->get_geometric_region( aNodeIndex, aNodeCoordinates );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     bool
     Geometry_Engine::queue_intersection(
             uint                     aEdgeFirstNodeIndex,
@@ -1342,6 +1409,7 @@ namespace moris::gen
 
         // Set GEN nodes
         mNodeManager.reset_background_nodes( aMesh );
+        this->clear_background_node_regions();
 
         // Reset PDV host manager
         mPDVHostManager.reset();
@@ -75,6 +75,9 @@ namespace moris::gen
         bool        mShapeSensitivities = false;
         real        mTimeOffset;
 
+        // Geometric regions of all background nodes, per geometry
+        Vector< Vector< Geometric_Region > > mBackgroundNodeRegions;
+
         // PDVs
         PDV_Host_Manager                     mPDVHostManager;
         Intersection_Node* mQueuedIntersectionNode = nullptr;
@@ -213,6 +216,18 @@ namespace moris::gen
                 const Matrix< IndexMat >&                    aNodeIndices,
                 Vector< std::shared_ptr< Matrix< DDRMat > > >* aNodeCoordinates );
 
+        /**
+         * Determines the geometric regions of all background nodes for all geometries, with one batched field
+         * evaluation per geometry. Until the regions are cleared or the ADVs or mesh change, is_intersected()
+         * looks up background nodes instead of evaluating them again for every element they belong to.
+         */
+        void classify_background_nodes();
+
+        /**
+         * Clears the geometric regions stored by classify_background_nodes().
+         */
+        void clear_background_node_regions();
+
         /**
          * Determines if the given edge is intersected, and queues an intersection node if it is. If an intersection
          * node has been queued, questions can be asked about the queued node:
@@ -478,6 +493,19 @@ namespace moris::gen
 
       private:
 
+        /**
+         * Gets the geometric region of a node, using the classified background nodes if available.
+         *
+         * @param aGeometryIndex Geometry index
+         * @param aNodeIndex Node index
+         * @param aNodeCoordinates Node coordinates
+         * @return Geometric region
+         */
+        Geometric_Region get_classified_geometric_region(
+                uint                    aGeometryIndex,
+                uint                    aNodeIndex,
+                const Matrix< DDRMat >& aNodeCoordinates );
+
         static void communicate_missing_owned_coefficients(
                 mtk::Mesh_Pair&  aMeshPair,
                 Matrix< IdMat >& aAllCoefIds,
@@ -900,6 +900,82 @@ namespace moris::gen
 
     //--------------------------------------------------------------------------------------------------------------
 
+    TEST_CASE( "Batched Field Evaluation", "[gen], [field], [batched field evaluation]" )
+    {
+        // Set up two spheres to be combined, and primitives to be evaluated directly
+        Submodule_Parameter_Lists tParameterLists( "FIELDS" );
+        tParameterLists.add_parameter_list( prm::create_field_parameter_list( Field_Type::SPHERE ) );
+        tParameterLists( 0 ).set( "center_x", 0.5, 0.5, 0.5 );
+        tParameterLists( 0 ).set( "radius", 0.7, 0.7, 0.7 );
+        tParameterLists( 0 ).set( "name", "Sphere 1" );
+
+        tParameterLists.add_parameter_list( prm::create_field_parameter_list( Field_Type::SPHERE ) );
+        tParameterLists( 1 ).set( "center_y", 1.0, 1.0, 1.0 );
+        tParameterLists( 1 ).set( "radius", 0.4, 0.4, 0.4 );
+        tParameterLists( 1 ).set( "name", "Sphere 2" );
+
+        tParameterLists.add_parameter_list( prm::create_level_set_geometry_parameter_list( gen::Field_Type::COMBINED_FIELDS ) );
+        tParameterLists( 2 ).set( "dependencies", "Sphere 1", "Sphere 2" );
+
+        tParameterLists.add_parameter_list( prm::create_level_set_geometry_parameter_list( gen::Field_Type::SPHERE ) );
+        tParameterLists( 3 ).set( "center_z", 0.25, 0.25, 0.25 );
+        tParameterLists( 3 ).set( "radius", 0.5, 0.5, 0.5 );
+
+        tParameterLists.add_parameter_list( prm::create_level_set_geometry_parameter_list( gen::Field_Type::SUPERELLIPSOID ) );
+        tParameterLists( 4 ).set( "center_x", 0.1 );
+        tParameterLists( 4 ).set( "semidiameter_y", 0.5 );
+        tParameterLists( 4 ).set( "exponent", 4.0 );
+
+        tParameterLists.add_parameter_list( prm::create_level_set_geometry_parameter_list( gen::Field_Type::PLANE ) );
+        tParameterLists( 5 ).set( "center_x", 0.3 );
+        tParameterLists( 5 ).set( "normal_x", 0.6 );
+        tParameterLists( 5 ).set( "normal_y", 0.8 );
+
+        // Create geometries
+        ADV_Manager                           tADVManager;
+        Design_Factory                        tDesignFactory( tParameterLists, tADVManager );
+        Vector< std::shared_ptr< Geometry > > tGeometries = tDesignFactory.get_geometries();
+
+        REQUIRE( tGeometries.size() == 4 );
+
+        // Regular grid of nodes, stored with one column per coordinate direction
+        uint             tNumberOfNodes = 11 * 11 * 11;
+        Vector< uint >   tNodeIndices( tNumberOfNodes );
+        Matrix< DDRMat > tCoordinates( tNumberOfNodes, 3 );
+        for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+        {
+            tNodeIndices( iNode )    = iNode;
+            tCoordinates( iNode, 0 ) = -1.0 + 0.2 * ( iNode % 11 );
+            tCoordinates( iNode, 1 ) = -1.0 + 0.2 * ( ( iNode / 11 ) % 11 );
+            tCoordinates( iNode, 2 ) = -1.0 + 0.2 * ( iNode / 121 );
+        }
+
+        // Batched evaluation must match evaluation node by node
+        for ( uint iGeometry = 0; iGeometry < tGeometries.size(); iGeometry++ )
+        {
+            std::shared_ptr< Level_Set_Geometry > tGeometry = std::dynamic_pointer_cast< Level_Set_Geometry >( tGeometries( iGeometry ) );
+
+            Vector< real > tFieldValues;
+            tGeometry->get_field_values( tNodeIndices, tCoordinates, tFieldValues );
+
+            Vector< Geometric_Region > tGeometricRegions;
+            tGeometry->get_geometric_regions( tNodeIndices, tCoordinates, tGeometricRegions );
+
+            REQUIRE( tFieldValues.size() == tNumberOfNodes );
+            REQUIRE( tGeometricRegions.size() == tNumberOfNodes );
+
+            for ( uint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+            {
+                Matrix< DDRMat > tNodeCoordinates = { { tCoordinates( iNode, 0 ), tCoordinates( iNode, 1 ), tCoordinates( iNode, 2 ) } };
+
+                CHECK( tFieldValues( iNode ) == Approx( tGeometry->get_field_value( iNode, tNodeCoordinates ) ) );
+                CHECK( tGeometricRegions( iNode ) == tGeometry->get_geometric_region( iNode, tNodeCoordinates ) );
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
     TEST_CASE( "Field Array", "[gen], [field], [field array]" )
     {
         SECTION( "Circle Field Array (Number)" )
@@ -33,9 +33,10 @@
 #include "cl_HMR_Factory.hpp"
 #include "cl_HMR_Mesh_Interpolation.hpp"
 #include "cl_HMR_Mesh_Integration.hpp"
-#include "cl_HMR_Field.hpp"    //HMR/src
-#include "cl_HMR_File.hpp"     //HMR/src
-#include "cl_HMR_STK.hpp"      //HMR/src
+#include "cl_HMR_Field.hpp"           //HMR/src
+#include "cl_HMR_File.hpp"            //HMR/src
+#include "cl_HMR_Restart_File.hpp"    //HMR/src
+#include "cl_HMR_STK.hpp"             //HMR/src
 
 #include "MTK_Tools.hpp"
 #include "cl_MTK_Enums.hpp"
@@ -173,7 +174,7 @@ namespace moris::hmr
         this->finalize();
 
         // write refinement pattern file
-        if ( mParameters->write_refinement_pattern() )
+        if ( mParameters->write_refinement_pattern() || mParameters->write_binary_refinement_pattern() )
         {
             this->output_mesh_refinement_data();
         }
@@ -209,6 +210,72 @@ namespace moris::hmr
         // log & trace this function
         Tracer tTracer( "HMR", "Output mesh refinement data" );
 
+        if ( mParameters->write_refinement_pattern() )
+        {
+            // Get iteration from global clock
+            uint tOptIter = gLogger.get_iteration( "OPT", "Manager", "Perform" );
+
+            hmr::File tHDF5;
+
+            // create file on disk
+            tHDF5.create(
+                    "HMR_Background_Refinement_Iter_" + std::to_string( tOptIter ) + ".hdf5" );
+
+            tHDF5.save_refinement_pattern(
+                    mDatabase->get_background_mesh(),
+                    this->create_refinement_pattern_list() );
+
+            tHDF5.close();
+        }
+
+        // write binary restart file of the same refinement, can be read on any processor decomposition
+        if ( mParameters->write_binary_refinement_pattern() )
+        {
+            this->save_binary_refinement_pattern();
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    HMR::save_binary_refinement_pattern( const Vector< real >& aElementCosts )
+    {
+        // Get iteration from global clock
+        uint tOptIter = gLogger.get_iteration( "OPT", "Manager", "Perform" );
+
+        this->save_binary_refinement_pattern(
+                "HMR_Background_Refinement_Iter_" + std::to_string( tOptIter ) + ".hmr",
+                aElementCosts );
+    }
+
+    // -----------------------------------------------------------------------------
+
+    void
+    HMR::save_binary_refinement_pattern(
+            const std::string&    aPath,
+            const Vector< real >& aElementCosts )
+    {
+        Restart_File tRestartFile;
+
+        tRestartFile.set_refinement_pattern(
+                mDatabase->get_background_mesh(),
+                this->create_refinement_pattern_list() );
+
+        // store slabs that balance the output mesh for the next mesh created from this file
+        if ( mParameters->use_processor_load_balancing() )
+        {
+            tRestartFile.set_processor_splits(
+                    mDatabase->compute_balanced_processor_splits( mParameters->get_output_mesh()( 0 )( 0 ), aElementCosts ) );
+        }
+
+        tRestartFile.save( aPath );
+    }
+
+    // -----------------------------------------------------------------------------
+
+    Matrix< DDUMat >
+    HMR::create_refinement_pattern_list()
+    {
         // get all lagrange and bspline pattern
         Vector< uint > tLagrangePatterns = mParameters->get_lagrange_patterns();
         Vector< uint > tBSplinePatterns  = mParameters->get_bspline_patterns();
@@ -244,20 +311,60 @@ namespace moris::hmr
             tPatternListUniqueMat( Ik ) = tPatternList( Ik );
         }
 
-        // Get iteration from global clock
-        uint tOptIter = gLogger.get_iteration( "OPT", "Manager", "Perform" );
+        return tPatternListUniqueMat;
+    }
 
-        hmr::File tHDF5;
+    // -----------------------------------------------------------------------------
 
-        // create file on disk
-        tHDF5.create(
-                "HMR_Background_Refinement_Iter_" + std::to_string( tOptIter ) + ".hdf5" );
+    void
+    HMR::save_restart_file(
+            const std::string&                        aPath,
+            uint                                      aLagrangeMeshIndex,
+            const Vector< std::shared_ptr< Field > >& aFields )
+    {
+        Lagrange_Mesh_Base* tLagrangeMesh = mDatabase->get_lagrange_mesh_by_index( aLagrangeMeshIndex );
 
-        tHDF5.save_refinement_pattern(
-                mDatabase->get_background_mesh(),
-                tPatternListUniqueMat );
+        // patterns of Lagrange mesh and its B-spline meshes
+        uint tNumberOfBSplineMeshes = tLagrangeMesh->get_number_of_bspline_meshes();
 
-        tHDF5.close();
+        Matrix< DDUMat > tPatterns( tNumberOfBSplineMeshes + 1, 1 );
+
+        tPatterns( 0 ) = tLagrangeMesh->get_activation_pattern();
+
+        for ( uint iBSplineMesh = 0; iBSplineMesh < tNumberOfBSplineMeshes; ++iBSplineMesh )
+        {
+            tPatterns( iBSplineMesh + 1 ) = tLagrangeMesh->get_bspline_mesh( iBSplineMesh )->get_activation_pattern();
+        }
+
+        Matrix< DDUMat > tUniquePatterns;
+        unique( tPatterns, tUniquePatterns );
+
+        // get pointer to background mesh
+        Background_Mesh_Base* tBackgroundMesh = mDatabase->get_background_mesh();
+
+        // remember active pattern
+        auto tActivePattern = tBackgroundMesh->get_activation_pattern();
+
+        Restart_File tRestartFile;
+
+        tRestartFile.set_refinement_pattern( tBackgroundMesh, tUniquePatterns );
+
+        if ( mParameters->use_processor_load_balancing() )
+        {
+            tRestartFile.set_processor_splits( mDatabase->compute_balanced_processor_splits( aLagrangeMeshIndex ) );
+        }
+
+        for ( const std::shared_ptr< Field >& tField : aFields )
+        {
+            tRestartFile.add_field( tField->get_label(), tField->get_coefficients() );
+        }
+
+        tRestartFile.save( aPath );
+
+        if ( tActivePattern != tBackgroundMesh->get_activation_pattern() )
+        {
+            tBackgroundMesh->set_activation_pattern( tActivePattern );
+        }
     }
 
     // -----------------------------------------------------------------------------
@@ -267,8 +374,16 @@ namespace moris::hmr
     {
         if ( not mParameters->get_restart_refinement_pattern_file().empty() )
         {
-            // load refinement pattern from file. 2nd argument is just dummy for now.
-            mDatabase->load_pattern_from_hdf5_file( mParameters->get_restart_refinement_pattern_file() );
+            if ( Restart_File::is_restart_file( mParameters->get_restart_refinement_pattern_file() ) )
+            {
+                // restore refinement from binary restart file
+                mDatabase->load_pattern_from_restart_file( mParameters->get_restart_refinement_pattern_file() );
+            }
+            else
+            {
+                // load refinement pattern from file. 2nd argument is just dummy for now.
+                mDatabase->load_pattern_from_hdf5_file( mParameters->get_restart_refinement_pattern_file() );
+            }
 
             // update database
             mDatabase->update_bspline_meshes();
@@ -750,6 +865,27 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    void
+    HMR::put_elements_on_coarsening_queue( Vector< hmr::Element* >& aElements )
+    {
+        // loop over all active elements
+        for ( hmr::Element* tCell : aElements )
+        {
+            tCell->get_background_element()->put_on_coarsening_queue();
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+
+    bool
+    HMR::perform_coarsening( const uint aPattern )
+    {
+        // coarsen database and update meshes of this pattern
+        return mDatabase->perform_coarsening( aPattern );
+    }
+
+    // -----------------------------------------------------------------------------
+
     void
     HMR::perform_refinement_based_on_working_pattern(
             const uint aPattern,
@@ -1131,6 +1267,51 @@ namespace moris::hmr
 
     // ----------------------------------------------------------------------------
 
+    std::shared_ptr< Field >
+    HMR::load_field_from_restart_file(
+            const std::string& aLabel,
+            const std::string& aFilePath,
+            const uint         aLagrangeIndex,
+            const uint         aBSpineIndex )
+    {
+        // fields are stored with the file of this proc, refinement of other procs is skipped
+        Restart_File tRestartFile;
+        tRestartFile.load( aFilePath, mDatabase->get_background_mesh() );
+
+        std::shared_ptr< moris::hmr::Mesh > tMesh = this->create_mesh( aLagrangeIndex );
+
+        uint tFieldIndex = mFields.size();
+
+        // add a new field to the list
+        mFields.push_back( tMesh->create_field( aLabel, aBSpineIndex ) );
+
+        // get a pointer to this field
+        std::shared_ptr< Field > aField = mFields( tFieldIndex );
+
+        aField->get_coefficients() = tRestartFile.get_field( aLabel );
+
+        uint tNumberOfCoeffs = aField->get_coefficients().length();
+
+        uint tNumberOfCoeffs_BSpline = tMesh->get_lagrange_mesh()->get_bspline_mesh( aBSpineIndex )->get_number_of_active_basis_on_proc();
+
+        MORIS_ERROR( tNumberOfCoeffs == tNumberOfCoeffs_BSpline,
+                "load_field_from_restart_file(), file and BSpline number of coefficients does not match. Check BSpline Mesh Index" );
+
+        // set order of B-Splines
+        aField->set_bspline_order( tMesh->get_lagrange_mesh()->get_bspline_mesh( aBSpineIndex )->get_min_order() );
+
+        // allocate field of nodes
+        aField->get_node_values().set_size( tMesh->get_num_nodes(), 1 );
+
+        // evaluate node values
+        aField->evaluate_nodal_values();
+
+        // return the pointer
+        return aField;
+    }
+
+    // ----------------------------------------------------------------------------
+
     std::shared_ptr< Field >
     HMR::load_field_from_exo_file(
             const std::string& aLabel,
@@ -1259,6 +1440,11 @@ namespace moris::hmr
             // assume this is a hdf file
             return this->load_field_from_hdf5_file( aLabel, aFilePath, aLagrangeIndex, aBSpineIndex );
         }
+        else if ( tType == "hmr" )
+        {
+            // binary restart file
+            return this->load_field_from_restart_file( aLabel, aFilePath, aLagrangeIndex, aBSpineIndex );
+        }
         else
         {
             // assume this is an exodus file
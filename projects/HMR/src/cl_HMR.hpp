@@ -174,6 +174,17 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        /**
+         * save the refinement of a Lagrange mesh and its B-spline meshes and, optionally, field coefficients
+         * to a binary restart file with the extension "hmr", which can be used as restart refinement pattern file
+         */
+        void save_restart_file(
+                const std::string&                        aPath,
+                uint                                      aLagrangeMeshIndex,
+                const Vector< std::shared_ptr< Field > >& aFields = {} );
+
+        // -----------------------------------------------------------------------------
+
         /**
          * store the T-Matrices and B-Spline IDs into a file
          */
@@ -205,6 +216,14 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        std::shared_ptr< Field > load_field_from_restart_file(
+                const std::string& aLabel,
+                const std::string& aFilePath,
+                uint               aLagrangeIndex = 0,
+                uint               aBSpineIndex   = 0 );
+
+        // -----------------------------------------------------------------------------
+
         std::shared_ptr< Field > load_field_from_exo_file(
                 const std::string& aLabel,
                 const std::string& aFilePath,
@@ -261,6 +280,19 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        void put_elements_on_coarsening_queue( Vector< hmr::Element* >& aElements );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * merges elements on the coarsening queue into their parents, one level per call
+         *
+         * @return true if at least one element has been coarsened
+         */
+        bool perform_coarsening( uint aPattern );
+
+        // -----------------------------------------------------------------------------
+
         /**
          * copy output pattern to input pattern
          */
@@ -495,6 +527,30 @@ namespace moris::hmr
 
         void output_mesh_refinement_data();
 
+        // -----------------------------------------------------------------------------
+
+        /**
+         * writes the refinement of all Lagrange and B-spline patterns to the binary refinement pattern file of the
+         * current iteration. If processor load balancing is used, the file also holds processor slabs that balance
+         * the given cost of the elements of the output mesh, which are used when restarting from this file.
+         *
+         * @param[in] aElementCosts cost per element index of the output mesh, e.g. from cut cells; 1 for each element if empty
+         */
+        void save_binary_refinement_pattern( const Vector< real >& aElementCosts = {} );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * writes the refinement of all Lagrange and B-spline patterns to a binary refinement pattern file,
+         * see save_binary_refinement_pattern( aElementCosts )
+         *
+         * @param[in] aPath         path to file
+         * @param[in] aElementCosts cost per element index of the output mesh; 1 for each element if empty
+         */
+        void save_binary_refinement_pattern(
+                const std::string&    aPath,
+                const Vector< real >& aElementCosts = {} );
+
         // -----------------------------------------------------------------------------
         // Debug files
         // -----------------------------------------------------------------------------
@@ -585,6 +641,11 @@ namespace moris::hmr
                 const Matrix< DDRMat >&  aVertexValues,
                 Refinement_Function      aRefinementFunction );
 
+        /**
+         * returns all Lagrange and B-spline patterns, sorted and unique
+         */
+        Matrix< DDUMat > create_refinement_pattern_list();
+
     }; /* HMR */
 
 }    // namespace moris::hmr
@@ -75,6 +75,9 @@ namespace moris::hmr
         //! Tells if an element is flagged for refinement
         bool mRefinementQueueFlag = false;
 
+        //! Tells if an element is flagged for coarsening
+        bool mCoarseningQueueFlag = false;
+
         //! global index in whole domain ( all procs), depends on pattern ( only active elements )
         //! access using get_hmr_index( const uint aPattern )
         //! same as get_id() - 1
@@ -439,6 +442,46 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * tells if an element is on the coarsening queue
+         *
+         * @return bool   true if flagged for coarsening
+         */
+        bool
+        is_queued_for_coarsening() const
+        {
+            return mCoarseningQueueFlag;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * flags an active element for coarsening. The element is merged into its parent
+         * if all siblings are active and flagged as well.
+         *
+         * @return void
+         */
+        void
+        put_on_coarsening_queue()
+        {
+            mCoarseningQueueFlag = true;
+        }
+
+        //--------------------------------------------------------------------------------
+
+        /**
+         * un-flags an element for coarsening
+         *
+         * @return void
+         */
+        void
+        remove_from_coarsening_queue()
+        {
+            mCoarseningQueueFlag = false;
+        }
+
+        //--------------------------------------------------------------------------------
+
         void
         check_refinement_queue_for_pattern( const uint aPattern )
         {
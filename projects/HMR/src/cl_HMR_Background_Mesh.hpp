@@ -763,6 +763,57 @@ namespace moris::hmr
                         ( tNumberOfElementsPerDimension( k ) - ( tNumberOfElementsPerDimension( k ) % mProcessorDimensions( k ) ) ) / mProcessorDimensions( k ) + tRemainder( k );
             }
 
+            // number of coarsest elements per processor slab, e.g. from load balancing of a previous refinement
+            const Vector< uint >& tProcessorSplits = mParameters->get_processor_splits();
+
+            // first coarsest element of this processor per direction if slabs are given
+            Vector< uint > tSplitOffset( N, 0 );
+
+            if ( tProcessorSplits.size() > 0 )
+            {
+                uint tNumberOfSlabs = 0;
+                for ( uint k = 0; k < N; ++k )
+                {
+                    tNumberOfSlabs += mProcessorDimensions( k );
+                }
+
+                MORIS_ERROR( tProcessorSplits.size() == tNumberOfSlabs,
+                        "hmr::Background_Mesh::decompose_mesh() - "
+                        "Number of processor splits (%u) does not match processor grid (%u).",
+                        (uint)tProcessorSplits.size(),
+                        tNumberOfSlabs );
+
+                // slabs of a direction follow the slabs of the previous directions
+                uint tFirstSlab = 0;
+
+                for ( uint k = 0; k < N; ++k )
+                {
+                    uint tNumberOfElementsInSlabs = 0;
+
+                    for ( uint iSlab = 0; iSlab < mProcessorDimensions( k ); ++iSlab )
+                    {
+                        MORIS_ERROR( tProcessorSplits( tFirstSlab + iSlab ) > 0,
+                                "hmr::Background_Mesh::decompose_mesh() - Processor splits must not be empty." );
+
+                        if ( iSlab < mMyProcCoords( k ) )
+                        {
+                            tSplitOffset( k ) += tProcessorSplits( tFirstSlab + iSlab );
+                        }
+
+                        tNumberOfElementsInSlabs += tProcessorSplits( tFirstSlab + iSlab );
+                    }
+
+                    MORIS_ERROR( tNumberOfElementsInSlabs == tNumberOfElementsPerDimension( k ),
+                            "hmr::Background_Mesh::decompose_mesh() - "
+                            "Processor splits in direction %u do not add up to number of elements.",
+                            k );
+
+                    tNumberOfElementsPerDimensionOnProc( k ) = tProcessorSplits( tFirstSlab + mMyProcCoords( k ) );
+
+                    tFirstSlab += mProcessorDimensions( k );
+                }
+            }
+
             // calculate decomposition domain
             // set owned and shared limits
             Matrix< DDLUMat > tDomainIJK( 2, N );
@@ -772,10 +823,17 @@ namespace moris::hmr
 
             for ( uint k = 0; k < N; ++k )
             {
-                // calculates domain start taking into account remainder elements
-                tDomainIJK( 0, k ) =
-                        mPaddingSize + tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
-                        ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcessorDimensions( k ) );
+                // calculates domain start taking into account remainder elements or given processor splits
+                if ( tProcessorSplits.size() > 0 )
+                {
+                    tDomainIJK( 0, k ) = mPaddingSize + tSplitOffset( k );
+                }
+                else
+                {
+                    tDomainIJK( 0, k ) =
+                            mPaddingSize + tNumberOfElementsPerDimensionOnProc( k ) * mMyProcCoords( k ) +    //
+                            ( 1 - tRemainder( k ) ) * ( tNumberOfElementsPerDimension( k ) % mProcessorDimensions( k ) );
+                }
 
                 tDomainIJK( 1, k ) = tDomainIJK( 0, k ) + tNumberOfElementsPerDimensionOnProc( k ) - 1;
 
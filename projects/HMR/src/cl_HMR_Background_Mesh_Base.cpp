@@ -738,6 +738,113 @@ namespace moris::hmr
 
     //-------------------------------------------------------------------------------
 
+    bool
+    Background_Mesh_Base::perform_coarsening( const uint aPattern )
+    {
+        // log & trace this operation
+        Tracer tTracer( "HMR", "Background Mesh", "Perform queued coarsening on pattern #" + std::to_string( aPattern ) );
+
+        // refined elements on this proc that are kept, per level
+        Vector< Vector< Background_Element_Base* > > tRefinedElements( mMaxLevel );
+
+        // refined elements on this proc whose children are merged
+        Vector< Background_Element_Base* > tCoarsenedElements;
+
+        for ( uint l = 0; l < mMaxLevel; ++l )
+        {
+            // collect elements on this level ( without aura )
+            Vector< Background_Element_Base* > tElements;
+            this->collect_elements_on_level( l, tElements );
+
+            for ( Background_Element_Base* tElement : tElements )
+            {
+                // padding elements are always refined, aura elements are decided by their owner
+                if ( !tElement->is_refined( aPattern ) || tElement->is_padding() || tElement->get_owner() != par_rank() )
+                {
+                    continue;
+                }
+
+                // element is coarsened if all children are active and flagged
+                bool tCoarsen = tElement->has_children();
+
+                for ( uint iChild = 0; tCoarsen && iChild < mNumberOfChildrenPerElement; ++iChild )
+                {
+                    Background_Element_Base* tChild = tElement->get_child( iChild );
+
+                    tCoarsen = tChild->is_active( aPattern ) && tChild->is_queued_for_coarsening();
+                }
+
+                if ( tCoarsen )
+                {
+                    tCoarsenedElements.push_back( tElement );
+                }
+                else
+                {
+                    tRefinedElements( l ).push_back( tElement );
+                }
+            }
+        }
+
+        // empty coarsening queue
+        Vector< Background_Element_Base* > tAllElements;
+        this->collect_all_elements( tAllElements );
+
+        for ( Background_Element_Base* tElement : tAllElements )
+        {
+            tElement->remove_from_coarsening_queue();
+        }
+
+        if ( sum_all( (luint)tCoarsenedElements.size() ) == 0 )
+        {
+            return false;
+        }
+
+        // replay remaining refinement, elements and their children are kept in memory and reused
+        this->reset_pattern( aPattern );
+
+        // remember original pattern
+        auto tOldPattern = mActivePattern;
+
+        // select pattern
+        mActivePattern = aPattern;
+
+        for ( uint l = 0; l < mMaxLevel; ++l )
+        {
+            for ( Background_Element_Base* tElement : tRefinedElements( l ) )
+            {
+                tElement->put_on_refinement_queue();
+            }
+
+            // refine and synchronize with aura, this also restores the staircase buffer
+            this->perform_refinement( aPattern );
+        }
+
+        // get back to old pattern
+        mActivePattern = tOldPattern;
+
+        // the staircase buffer of the remaining refinement may have refined flagged elements again
+        luint tNumberOfCoarsenedElements = 0;
+
+        for ( Background_Element_Base* tElement : tCoarsenedElements )
+        {
+            if ( !tElement->is_refined( aPattern ) )
+            {
+                ++tNumberOfCoarsenedElements;
+            }
+        }
+
+        tNumberOfCoarsenedElements = sum_all( tNumberOfCoarsenedElements );
+
+        // report on this operation
+        MORIS_LOG_INFO( "Coarsened %lu elements on pattern #%u.",
+                (long unsigned int)tNumberOfCoarsenedElements,
+                aPattern );
+
+        return tNumberOfCoarsenedElements > 0;
+    }
+
+    //-------------------------------------------------------------------------------
+
     uint
     Background_Mesh_Base::calc_child_index( luint aI )
     {
@@ -515,6 +515,21 @@ namespace moris::hmr
 
         //--------------------------------------------------------------------------------
 
+        /**
+         * merges the children of refined elements into their parent if all children are
+         * active and on the coarsening queue. The remaining refinement of the pattern is
+         * replayed level by level, such that the staircase buffer and the aura are restored.
+         * Flagged elements that the staircase buffer refines again are not coarsened.
+         * Only one level is coarsened per call. The coarsening queue is emptied.
+         *
+         *@param[ in ]     uint pattern to be coarsened
+         *
+         * @return         bool telling if at least one element is coarser after the replay on any proc
+         */
+        bool perform_coarsening( uint aPattern );
+
+        //--------------------------------------------------------------------------------
+
         /**
          * Returns a Matrix< DDLUMat > of the dimension < number of dimensions >
          *                                       * < max number of levels >
@@ -12,7 +12,9 @@
 
 #include "cl_HMR_Field.hpp"
 #include "cl_HMR_File.hpp"
+#include "cl_HMR_Restart_File.hpp"
 #include "cl_HMR_Mesh.hpp"
+#include "fn_HMR_balance_processor_splits.hpp"
 #include "MTK_Tools.hpp"
 #include "cl_Tracer.hpp"
 
@@ -151,6 +153,20 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    void
+    Database::load_pattern_from_restart_file(
+            const std::string& aPath )
+    {
+        // read trees within the domain of this proc from the files of all procs that wrote them
+        Restart_File tRestartFile;
+        tRestartFile.load( aPath, mBackgroundMesh );
+
+        // replay refinement level by level
+        tRestartFile.apply_refinement_pattern( mBackgroundMesh );
+    }
+
+    // -----------------------------------------------------------------------------
+
     void
     Database::load_refinement_pattern(
             Matrix< DDLUMat >&                aElementCounterPerLevelAndPattern,
@@ -348,6 +364,9 @@ namespace moris::hmr
                     tOrderForLagMesh,
                     iLagMesh );
 
+            // share refinement products of T-matrices between all meshes
+            mLagrangeMeshes( iLagMesh )->set_t_matrix_cache( &mTMatrixCache );
+
             // link to side-set if this is an output mesh
             if ( mParameters->is_output_mesh( iLagMesh ) )
             {
@@ -984,6 +1003,25 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    bool
+    Database::perform_coarsening( const uint aPattern )
+    {
+        bool tCoarsened = mBackgroundMesh->perform_coarsening( aPattern );
+
+        if ( tCoarsened )
+        {
+            // create new B-Spline Meshes
+            this->update_bspline_meshes( aPattern );
+
+            // create new Lagrange meshes
+            this->update_lagrange_meshes( aPattern );
+        }
+
+        return tCoarsened;
+    }
+
+    // -----------------------------------------------------------------------------
+
     // interpolate field values from source Lagrange to target Lagrange mesh
     void
     Database::interpolate_field(
@@ -1333,6 +1371,98 @@ namespace moris::hmr
 
     // -----------------------------------------------------------------------------
 
+    Matrix< DDRMat >
+    Database::compute_coarsest_element_costs(
+            uint                  aLagrangeMeshIndex,
+            const Vector< real >& aElementCosts )
+    {
+        Lagrange_Mesh_Base* tMesh = mLagrangeMeshes( aLagrangeMeshIndex );
+
+        tMesh->select_activation_pattern();
+
+        uint tNumberOfDimensions = mParameters->get_number_of_dimensions();
+
+        Vector< uint >    tNumberOfElementsPerDimension = mParameters->get_number_of_elements_per_dimension();
+        Matrix< DDLUMat > tProcOffset                   = mBackgroundMesh->get_subdomain_offset_of_proc();
+        luint             tPaddingSize                  = mParameters->get_padding_size();
+
+        uint tNumberOfCoarsestElements = 1;
+
+        for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+        {
+            tNumberOfCoarsestElements *= tNumberOfElementsPerDimension( iDim );
+        }
+
+        Matrix< DDRMat > tCosts( tNumberOfCoarsestElements, 1, 0.0 );
+
+        uint tNumberOfElements = tMesh->get_number_of_elements();
+
+        for ( uint iElement = 0; iElement < tNumberOfElements; ++iElement )
+        {
+            Element* tElement = tMesh->get_element( iElement );
+
+            if ( tElement->get_owner() != par_rank() )
+            {
+                continue;
+            }
+
+            // find coarsest ancestor
+            const Background_Element_Base* tAncestor = tElement->get_background_element();
+
+            while ( tAncestor->get_level() > 0 )
+            {
+                tAncestor = tAncestor->get_parent();
+            }
+
+            // global position without padding, i running fastest
+            const luint* tIJK = tAncestor->get_ijk();
+
+            luint tIndex  = 0;
+            luint tStride = 1;
+
+            for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+            {
+                tIndex += ( tIJK[ iDim ] + tProcOffset( iDim, 0 ) - tPaddingSize ) * tStride;
+                tStride *= tNumberOfElementsPerDimension( iDim );
+            }
+
+            tCosts( tIndex ) += aElementCosts.size() > 0 ? aElementCosts( tElement->get_index() ) : 1.0;
+        }
+
+        return sum_all_matrix( tCosts );
+    }
+
+    // -----------------------------------------------------------------------------
+
+    Vector< uint >
+    Database::compute_balanced_processor_splits(
+            uint                  aLagrangeMeshIndex,
+            const Vector< real >& aElementCosts )
+    {
+        Tracer tTracer( "HMR", "Database", "Compute balanced processor splits" );
+
+        Matrix< DDRMat > tCosts = this->compute_coarsest_element_costs( aLagrangeMeshIndex, aElementCosts );
+
+        const Vector< uint >& tProcDims                     = mBackgroundMesh->get_proc_dims();
+        Vector< uint >        tNumberOfElementsPerDimension = mParameters->get_number_of_elements_per_dimension();
+
+        // slabs need to be at least as wide as the aura
+        Vector< uint > tProcessorSplits = balance_processor_splits(
+                tCosts,
+                tNumberOfElementsPerDimension,
+                tProcDims,
+                mParameters->get_padding_size() );
+
+        MORIS_LOG_INFO( "Load imbalance of Lagrange mesh %u is %5.3f, %5.3f with balanced processor splits.",
+                aLagrangeMeshIndex,
+                compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcDims, mParameters->get_processor_splits() ),
+                compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcDims, tProcessorSplits ) );
+
+        return tProcessorSplits;
+    }
+
+    // -----------------------------------------------------------------------------
+
     Matrix< DDUMat >
     Database::create_output_pattern_list()
     {
@@ -19,6 +19,7 @@
 #include "cl_HMR_Parameters.hpp"       //HMR/src
 #include "cl_HMR_Side_Set.hpp"         //HMR/src
 #include "cl_HMR_T_Matrix.hpp"         //HMR/src
+#include "cl_HMR_T_Matrix_Cache.hpp"   //HMR/src
 #include "cl_Vector.hpp"               //CNT/src
 #include "cl_Map.hpp"
 
@@ -51,6 +52,9 @@ namespace moris::hmr
         // These Lagrange meshes are created on the flight and not in the input file
         Vector< Vector< Lagrange_Mesh_Base* > > mAdditionalLagrangeMeshes;
 
+        //! products of child matrices shared by the T-matrices of all meshes
+        T_Matrix_Cache mTMatrixCache;
+
         //! communication table for this mesh. Created during finalize.
         Matrix< IdMat > mCommunicationTable;
 
@@ -102,6 +106,14 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        /**
+         * restores the refinement of the background mesh from a binary restart file, see Restart_File
+         */
+        void load_pattern_from_restart_file(
+                const std::string& aPath );
+
+        // -----------------------------------------------------------------------------
+
         void load_refinement_pattern(
                 Matrix< DDLUMat >&           aElementCounterPerLevelAndPattern,
                 Vector< Matrix< DDLUMat > >& aElementPerPattern,
@@ -153,6 +165,16 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        /**
+         * merges active elements on the coarsening queue into their parents and updates the
+         * B-spline and Lagrange meshes of the pattern if at least one element has been coarsened
+         *
+         * @return true if at least one element has been coarsened
+         */
+        bool perform_coarsening( uint aPattern );
+
+        // -----------------------------------------------------------------------------
+
         /**
          * aTarget must be a refined variant of aSource
          */
@@ -216,6 +238,17 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        /**
+         * returns the cache of products of child matrices shared by the T-matrices of all meshes
+         */
+        T_Matrix_Cache&
+        get_t_matrix_cache()
+        {
+            return mTMatrixCache;
+        }
+
+        // -----------------------------------------------------------------------------
+
         Matrix< DDUMat > create_output_pattern_list();
 
         // -----------------------------------------------------------------------------
@@ -433,6 +466,37 @@ namespace moris::hmr
 
         // -----------------------------------------------------------------------------
 
+        /**
+         * sums the cost of the owned active elements of a Lagrange mesh onto their coarsest ancestors
+         *
+         * @param[in] aLagrangeMeshIndex index of Lagrange mesh whose elements are summed
+         * @param[in] aElementCosts      cost per element index, e.g. from cut cells; 1 for each element if empty
+         *
+         * @return cost per coarsest element of all procs, ordered by global position with i running fastest
+         */
+        Matrix< DDRMat > compute_coarsest_element_costs(
+                uint                  aLagrangeMeshIndex,
+                const Vector< real >& aElementCosts = {} );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * computes processor slabs which balance the cost of the active elements of a Lagrange mesh,
+         * to be passed to Parameters::set_processor_splits() when the refined mesh is created again.
+         * Elements are assigned to the slabs of their coarsest ancestor, such that refined subtrees
+         * are never split between processors, see balance_processor_splits().
+         *
+         * @param[in] aLagrangeMeshIndex index of Lagrange mesh whose elements are balanced
+         * @param[in] aElementCosts      cost per element index, e.g. from cut cells; 1 for each element if empty
+         *
+         * @return number of coarsest elements per processor slab, concatenated over all directions
+         */
+        Vector< uint > compute_balanced_processor_splits(
+                uint                  aLagrangeMeshIndex,
+                const Vector< real >& aElementCosts = {} );
+
+        // -----------------------------------------------------------------------------
+
         // tells if at least one element has been refined in this database
         bool
         have_refined_at_least_one_element() const
@@ -507,6 +507,9 @@ namespace moris::hmr
                         mLagrangeMeshForTMatrix( iBspMesh )->update_mesh();
                     }
 
+                    // share refinement products with T-matrices of other B-spline meshes
+                    mTMatrix( iBspMesh )->set_cache( mTMatrixCache );
+
                     // compute the actual T-matrix
                     mTMatrix( iBspMesh )->evaluate( iBspMesh, aBool );
                 }
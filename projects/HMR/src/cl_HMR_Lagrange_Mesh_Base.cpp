@@ -2435,6 +2435,29 @@ namespace moris::hmr
 
     //------------------------------------------------------------------------------
 
+    Communication_Plan&
+    Lagrange_Mesh_Base::get_proc_neighbor_plan()
+    {
+        const Matrix< IdMat >& tProcNeighbors = mBackgroundMesh->get_proc_neighbors();
+
+        bool tIsUpToDate = mProcNeighborPlan != nullptr && mProcNeighborPlanTable.numel() == tProcNeighbors.numel();
+
+        for ( uint p = 0; tIsUpToDate && p < tProcNeighbors.numel(); ++p )
+        {
+            tIsUpToDate = mProcNeighborPlanTable( p ) == tProcNeighbors( p );
+        }
+
+        if ( !tIsUpToDate )
+        {
+            mProcNeighborPlan      = std::make_unique< Communication_Plan >( tProcNeighbors );
+            mProcNeighborPlanTable = tProcNeighbors;
+        }
+
+        return *mProcNeighborPlan;
+    }
+
+    //------------------------------------------------------------------------------
+
     Facet*
     Lagrange_Mesh_Base::create_facet( Background_Facet* aFacet )
     {
@@ -2519,6 +2542,9 @@ namespace moris::hmr
         // get proc neighbors from background mesh
         auto tProcNeighbors = mBackgroundMesh->get_proc_neighbors();
 
+        // communication plan reused for all exchanges with proc neighbors
+        Communication_Plan& tPlan = this->get_proc_neighbor_plan();
+
         // get number of proc neighbors
         uint tNumberOfNeighbors = mBackgroundMesh->get_number_of_proc_neighbors();
 
@@ -2602,26 +2628,27 @@ namespace moris::hmr
         Vector< Matrix< DDUMat > >  tFacetIndexListReceive;
 
         // communicate ancestor IDs
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tAncestorListSend,
                 tAncestorListReceive );
 
         // clear memory
         tAncestorListSend.clear();
 
+        // communicate indices, sizes are the same as for the ancestors
+        tPlan.communicate(
+                tFacetIndexListSend,
+                tFacetIndexListReceive,
+                true );
+
         // communicate pedigree list
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tPedigreeListSend,
                 tPedigreeListReceive );
 
         // clear memory
         tPedigreeListSend.clear();
 
-        // communicate indices
-        communicate_mats( tProcNeighbors,
-                tFacetIndexListSend,
-                tFacetIndexListReceive );
-
         // loop over all received lists
         for ( uint p = 0; p < tNumberOfNeighbors; ++p )
         {
@@ -2660,7 +2687,7 @@ namespace moris::hmr
         tFacetIndexListReceive.clear();
 
         // communicate ids
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tFacetIndexListSend,
                 tFacetIndexListReceive );
 
@@ -2732,6 +2759,9 @@ namespace moris::hmr
         // get proc neighbors from background mesh
         auto tProcNeighbors = mBackgroundMesh->get_proc_neighbors();
 
+        // communication plan reused for all exchanges with proc neighbors
+        Communication_Plan& tPlan = this->get_proc_neighbor_plan();
+
         // get number of proc neighbors
         uint tNumberOfNeighbors = mBackgroundMesh->get_number_of_proc_neighbors();
 
@@ -2819,26 +2849,27 @@ namespace moris::hmr
         Vector< Matrix< DDUMat > >  tEdgeIndexListReceive;
 
         // communicate ancestor IDs
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tAncestorListSend,
                 tAncestorListReceive );
 
         // clear memory
         tAncestorListSend.clear();
 
+        // communicate indices, sizes are the same as for the ancestors
+        tPlan.communicate(
+                tEdgeIndexListSend,
+                tEdgeIndexListReceive,
+                true );
+
         // communicate pedigree list
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tPedigreeListSend,
                 tPedigreeListReceive );
 
         // clear memory
         tPedigreeListSend.clear();
 
-        // communicate indices
-        communicate_mats( tProcNeighbors,
-                tEdgeIndexListSend,
-                tEdgeIndexListReceive );
-
         // loop over all received lists
         for ( uint p = 0; p < tNumberOfNeighbors; ++p )
         {
@@ -2876,7 +2907,7 @@ namespace moris::hmr
         tEdgeIndexListReceive.clear();
 
         // communicate ids
-        communicate_mats( tProcNeighbors,
+        tPlan.communicate(
                 tEdgeIndexListSend,
                 tEdgeIndexListReceive );
 
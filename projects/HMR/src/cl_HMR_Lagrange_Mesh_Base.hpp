@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "cl_HMR_Background_Element_Base.hpp"
@@ -29,12 +30,16 @@
 #include "cl_MTK_Side_Sets_Info.hpp"
 
 #include "cl_Matrix.hpp" //LINALG/src
+#include "cl_Communication_Plan.hpp" //COM/src
 
 namespace moris::hmr
 {
     // forward declaration of B-Spline mesh
     class BSpline_Mesh_Base;
 
+    // forward declaration of cache of refinement products
+    class T_Matrix_Cache;
+
     /**
      * \brief   Base class for Lagrange_Mesh
      *
@@ -64,6 +69,9 @@ namespace moris::hmr
         Vector< BSpline_Mesh_Base * > mBSplineMeshes;
         Vector< Lagrange_Mesh_Base * > mLagrangeMeshForTMatrix;
 
+        //! cache of refinement products on database object, shared by T-matrices
+        T_Matrix_Cache * mTMatrixCache = nullptr;
+
         //! IDs for MTK
         moris_id mMaxFacetDomainIndex = 0;
         moris_id mMaxEdgeDomainIndex = 0;
@@ -82,6 +90,12 @@ namespace moris::hmr
         //! pointer to sidesets on database object
       Vector< Side_Set > * mSideSets = nullptr;
 
+        //! communication plan for the proc neighbors of the background mesh, kept between ID synchronizations
+        std::unique_ptr< Communication_Plan > mProcNeighborPlan;
+
+        //! proc neighbors the communication plan was built for
+        Matrix< IdMat > mProcNeighborPlanTable;
+
     public:
 
         /**
@@ -805,6 +819,13 @@ namespace moris::hmr
 
         // ----------------------------------------------------------------------------
 
+        void set_t_matrix_cache( T_Matrix_Cache * aTMatrixCache )
+        {
+            mTMatrixCache = aTMatrixCache;
+        }
+
+        // ----------------------------------------------------------------------------
+
         mtk::MtkSideSetInfo & get_side_set_info( const uint aIndex )
         {
             Vector< Side_Set > & tSets = *mSideSets;
@@ -984,6 +1005,14 @@ namespace moris::hmr
         void delete_edges();
 
         // ----------------------------------------------------------------------------
+
+        /**
+         * returns the communication plan for the proc neighbors of the background mesh,
+         * the plan is rebuilt only if the proc neighbors have changed
+         */
+        Communication_Plan & get_proc_neighbor_plan();
+
+        // ----------------------------------------------------------------------------
     private:
         // ----------------------------------------------------------------------------
 
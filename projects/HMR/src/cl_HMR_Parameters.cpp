@@ -8,7 +8,8 @@
  *
  */
 
-#include "cl_HMR_Parameters.hpp"    //HMR/src
+#include "cl_HMR_Parameters.hpp"      //HMR/src
+#include "cl_HMR_Restart_File.hpp"    //HMR/src
 
 #include "assert.hpp"
 #include "fn_Parsing_Tools.hpp"
@@ -57,6 +58,9 @@ namespace moris::hmr
         // get user defined processor dimensions. Only matters if decomp method == 3.
         mProcessorDimensions = tHMRParameterList.get_vector< uint >( "processor_dimensions" );
 
+        // get number of coarsest elements per processor slab, uniform slabs if empty
+        mProcessorSplits = tHMRParameterList.get_vector< uint >( "processor_splits" );
+
         // get domain dimensions
         mDomainDimensions = tHMRParameterList.get_vector< real >( "domain_dimensions" );
 
@@ -116,8 +120,18 @@ namespace moris::hmr
 
         this->set_write_refinement_pattern_file_flag( tHMRParameterList.get< bool >( "write_refinement_pattern_file" ) );
 
+        this->set_write_binary_refinement_pattern_file_flag( tHMRParameterList.get< bool >( "write_binary_refinement_pattern_file" ) );
+
         this->set_restart_refinement_pattern_file( tHMRParameterList.get< std::string >( "restart_refinement_pattern_file" ) );
 
+        this->set_processor_load_balancing( tHMRParameterList.get< bool >( "processor_load_balancing" ) );
+
+        // restore balanced processor slabs that were stored with the refinement pattern on the same number of procs
+        if ( mProcessorLoadBalancing and mProcessorSplits.size() == 0 and Restart_File::is_restart_file( mRestartFromRefinedPatternFileName ) )
+        {
+            mProcessorSplits = Restart_File::read_processor_splits( mRestartFromRefinedPatternFileName );
+        }
+
         this->set_basis_fuction_vtk_file_name( tHMRParameterList.get< std::string >( "basis_function_vtk_file" ) );
 
         // Always create side sets when using parameter list
@@ -349,6 +363,17 @@ namespace moris::hmr
 
     //--------------------------------------------------------------------------------
 
+    void
+    Parameters::set_processor_splits( const Vector< uint >& aProcessorSplits )
+    {
+        // test if calling this function is allowed
+        this->error_if_locked( "set_processor_splits" );
+
+        mProcessorSplits = aProcessorSplits;
+    }
+
+    //--------------------------------------------------------------------------------
+
     /**
      * sets the mesh orders according to given matrix
      */
@@ -65,6 +65,9 @@ namespace moris::hmr
         //! Processor layout if mProcDecompMethod is 0 (user defined here). Product MUST = # of processors used. Can be 1, 2, or 3 dimensions.
         Vector< uint > mProcessorDimensions = { 2, 2 };
 
+        //! Number of coarsest elements per processor slab, concatenated over all directions. Uniform slabs if empty.
+        Vector< uint > mProcessorSplits;
+
         //! number of elements per direction in overall mesh, without aura
         //! 2D or 3D is determined by length of this vector
         Vector< uint > mNumberOfElementsPerDimension = { 2, 2 };
@@ -136,6 +139,11 @@ namespace moris::hmr
 
         bool mWriteRefinementPattern = false;
 
+        bool mWriteBinaryRefinementPattern = false;
+
+        //! balance processor slabs by the cost of the refined mesh
+        bool mProcessorLoadBalancing = false;
+
         std::string mRestartFromRefinedPatternFileName;
 
         //! Renumber Lagrange Nodes
@@ -178,6 +186,24 @@ namespace moris::hmr
             return mProcessorDimensions;
         }
 
+        /**
+         * returns number of coarsest elements per processor slab, concatenated over all directions
+         *
+         * @return Vector< uint >
+         */
+        const Vector< uint >&
+        get_processor_splits() const
+        {
+            return mProcessorSplits;
+        }
+
+        /**
+         * sets number of coarsest elements per processor slab, e.g. from Database::compute_balanced_processor_splits()
+         *
+         * @param[in] aProcessorSplits number of coarsest elements per slab, concatenated over all directions
+         */
+        void set_processor_splits( const Vector< uint >& aProcessorSplits );
+
         /**
          * Constructor that loads parameters from a library
          */
@@ -976,6 +1002,29 @@ namespace moris::hmr
             mWriteRefinementPattern = aWriteRefinmentPatternFile;
         }
 
+        /**
+         * Sets if HMR is to write the refinement pattern to a binary restart file.
+         *
+         * @param aWriteBinaryRefinementPatternFile Binary refinement pattern output flag
+         */
+        void
+        set_write_binary_refinement_pattern_file_flag( bool aWriteBinaryRefinementPatternFile )
+        {
+            mWriteBinaryRefinementPattern = aWriteBinaryRefinementPatternFile;
+        }
+
+        /**
+         * Sets if processor slabs are to be balanced by the cost of the refined mesh. The balanced slabs are stored
+         * with the binary refinement pattern file and used when restarting from it on the same number of procs.
+         *
+         * @param aProcessorLoadBalancing Load balancing flag
+         */
+        void
+        set_processor_load_balancing( bool aProcessorLoadBalancing )
+        {
+            mProcessorLoadBalancing = aProcessorLoadBalancing;
+        }
+
         /**
          * Sets the HDF5 file name for HMR to read in restart refinement info from.
          *
@@ -1020,6 +1069,28 @@ namespace moris::hmr
             return mWriteRefinementPattern;
         }
 
+        /**
+         * Gets if the refinement pattern is to be written to a binary restart file
+         *
+         * @return
+         */
+        [[nodiscard]] bool
+        write_binary_refinement_pattern() const
+        {
+            return mWriteBinaryRefinementPattern;
+        }
+
+        /**
+         * Gets if processor slabs are to be balanced by the cost of the refined mesh
+         *
+         * @return
+         */
+        [[nodiscard]] bool
+        use_processor_load_balancing() const
+        {
+            return mProcessorLoadBalancing;
+        }
+
         /**
          * Gets the HDF5 file name to read refinement restart info from.
          *
@@ -0,0 +1,764 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_HMR_Restart_File.cpp
+ *
+ */
+
+#include "cl_HMR_Restart_File.hpp"    //HMR/src
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#include "cl_HMR_Background_Mesh_Base.hpp"       //HMR/src
+#include "cl_HMR_Background_Element_Base.hpp"    //HMR/src
+#include "cl_HMR_Parameters.hpp"                 //HMR/src
+#include "cl_Communication_Tools.hpp"            //COM/src
+
+namespace moris::hmr
+{
+    namespace
+    {
+        //! identifier at the beginning of each restart file, "HMRRST" followed by format version
+        const uint64_t gRestartFileMagic = 0x3230545352524D48;
+
+        //! identifier at the beginning of the index of a restart file written in parallel, "HMRIDX01"
+        const uint64_t gRestartIndexMagic = 0x3130584449524D48;
+
+        //------------------------------------------------------------------------------
+
+        // path of the file of a proc, same scheme as parallelize_path()
+        std::string
+        get_file_path(
+                const std::string& aPath,
+                uint               aNumberOfFiles,
+                uint               aFileIndex )
+        {
+            if ( aNumberOfFiles == 1 )
+            {
+                return aPath;
+            }
+
+            return aPath.substr( 0, aPath.find_last_of( '.' ) )    //
+                 + "." + std::to_string( aNumberOfFiles )           //
+                 + "." + std::to_string( aFileIndex )               //
+                 + aPath.substr( aPath.find_last_of( '.' ), aPath.length() );
+        }
+
+        //------------------------------------------------------------------------------
+
+        // tells if an element of a level is refined on at least one pattern
+        bool
+        is_refined_on_any_pattern(
+                const uint64_t* aBitmap,
+                luint           aNumberOfWords,
+                uint            aNumberOfPatterns,
+                luint           aElement )
+        {
+            for ( uint iPattern = 0; iPattern < aNumberOfPatterns; ++iPattern )
+            {
+                if ( ( aBitmap[ iPattern * aNumberOfWords + aElement / 64 ] >> ( aElement % 64 ) ) & 1 )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // collects the children of all elements of a level of a tree that are refined on at least one pattern
+        void
+        collect_next_level(
+                const Vector< Background_Element_Base* >& aElements,
+                luint                                     aFirstElement,
+                luint                                     aNumberOfElements,
+                const uint64_t*                           aBitmap,
+                uint                                      aNumberOfPatterns,
+                uint                                      aNumberOfChildren,
+                Vector< Background_Element_Base* >&       aChildren )
+        {
+            luint tNumberOfWords = ( aNumberOfElements + 63 ) / 64;
+
+            for ( luint iElement = 0; iElement < aNumberOfElements; ++iElement )
+            {
+                Background_Element_Base* tElement = aElements( aFirstElement + iElement );
+
+                if ( is_refined_on_any_pattern( aBitmap, tNumberOfWords, aNumberOfPatterns, iElement ) && tElement->has_children() )
+                {
+                    for ( uint iChild = 0; iChild < aNumberOfChildren; ++iChild )
+                    {
+                        aChildren.push_back( tElement->get_child( iChild ) );
+                    }
+                }
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
+        // returns the coarsest element within the proc domain at a global ijk-position without padding, null if outside
+        Background_Element_Base*
+        get_coarsest_element_within_proc_domain(
+                Background_Mesh_Base*    aBackgroundMesh,
+                const Matrix< DDLUMat >& aSubdomainIJK,
+                const Matrix< DDLUMat >& aProcOffset,
+                luint                    aPaddingSize,
+                const luint*             aGlobalIJK )
+        {
+            uint tNumberOfDimensions = aSubdomainIJK.n_cols();
+
+            luint tIJK[ 3 ] = { 0, 0, 0 };
+
+            for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+            {
+                // position on proc including padding
+                luint tPosition = aGlobalIJK[ iDim ] + aPaddingSize;
+
+                if ( tPosition < aProcOffset( iDim, 0 ) + aSubdomainIJK( 0, iDim ) || tPosition > aProcOffset( iDim, 0 ) + aSubdomainIJK( 1, iDim ) )
+                {
+                    return nullptr;
+                }
+
+                tIJK[ iDim ] = tPosition - aProcOffset( iDim, 0 );
+            }
+
+            if ( tNumberOfDimensions == 2 )
+            {
+                return aBackgroundMesh->get_coarsest_element_by_ij( tIJK[ 0 ], tIJK[ 1 ] );
+            }
+
+            return aBackgroundMesh->get_coarsest_element_by_ijk( tIJK[ 0 ], tIJK[ 1 ], tIJK[ 2 ] );
+        }
+    }    // namespace
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::set_refinement_pattern(
+            Background_Mesh_Base*   aBackgroundMesh,
+            const Matrix< DDUMat >& aPatterns )
+    {
+        mNumberOfFiles      = par_size();
+        mNumberOfDimensions = aBackgroundMesh->get_parameters()->get_number_of_dimensions();
+
+        uint tNumberOfPatterns = aPatterns.numel();
+
+        mPatterns.resize( tNumberOfPatterns );
+
+        for ( uint iPattern = 0; iPattern < tNumberOfPatterns; ++iPattern )
+        {
+            mPatterns( iPattern ) = aPatterns( iPattern );
+        }
+
+        uint tNumberOfChildren = 1 << mNumberOfDimensions;
+
+        // offset of proc to convert proc local to global positions
+        Matrix< DDLUMat > tProcOffset  = aBackgroundMesh->get_subdomain_offset_of_proc();
+        luint             tPaddingSize = aBackgroundMesh->get_parameters()->get_padding_size();
+
+        mTreeIJK.clear();
+        mTrees.clear();
+
+        // coarsest elements on this proc
+        Vector< Background_Element_Base* > tCoarsestElements;
+        aBackgroundMesh->collect_elements_on_level_within_proc_domain( 0, tCoarsestElements );
+
+        Vector< Background_Element_Base* > tElements;
+        Vector< Background_Element_Base* > tChildren;
+
+        for ( Background_Element_Base* tCoarsestElement : tCoarsestElements )
+        {
+            Vector< uint64_t > tTree( 1, 0 );
+
+            tElements = { tCoarsestElement };
+
+            while ( tElements.size() > 0 )
+            {
+                luint tNumberOfElements = tElements.size();
+                luint tNumberOfWords    = get_number_of_words( tNumberOfElements );
+                luint tFirstWord        = tTree.size() + 1;
+
+                tTree.push_back( tNumberOfElements );
+                tTree.resize( tFirstWord + tNumberOfPatterns * tNumberOfWords, 0 );
+
+                for ( luint iElement = 0; iElement < tNumberOfElements; ++iElement )
+                {
+                    for ( uint iPattern = 0; iPattern < tNumberOfPatterns; ++iPattern )
+                    {
+                        if ( tElements( iElement )->is_refined( mPatterns( iPattern ) ) )
+                        {
+                            tTree( tFirstWord + iPattern * tNumberOfWords + iElement / 64 ) |= (uint64_t)1 << ( iElement % 64 );
+                        }
+                    }
+                }
+
+                tChildren.clear();
+
+                collect_next_level( tElements, 0, tNumberOfElements, tTree.memptr() + tFirstWord, tNumberOfPatterns, tNumberOfChildren, tChildren );
+
+                // count levels
+                ++tTree( 0 );
+
+                std::swap( tElements, tChildren );
+            }
+
+            // unrefined coarsest elements are not stored
+            if ( tTree( 0 ) == 1 )
+            {
+                continue;
+            }
+
+            const luint* tIJK = tCoarsestElement->get_ijk();
+
+            for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+            {
+                mTreeIJK.push_back( tIJK[ iDim ] + tProcOffset( iDim, 0 ) - tPaddingSize );
+            }
+
+            mTrees.push_back( std::move( tTree ) );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::apply_refinement_pattern( Background_Mesh_Base* aBackgroundMesh ) const
+    {
+        MORIS_ERROR( mNumberOfDimensions == aBackgroundMesh->get_parameters()->get_number_of_dimensions(),
+                "Restart_File::apply_refinement_pattern() - File was written for a mesh with %u dimensions.",
+                mNumberOfDimensions );
+
+        uint tNumberOfPatterns = mPatterns.size();
+        uint tNumberOfChildren = 1 << mNumberOfDimensions;
+
+        Matrix< DDLUMat > tSubdomainIJK = aBackgroundMesh->get_subdomain_ijk();
+        Matrix< DDLUMat > tProcOffset   = aBackgroundMesh->get_subdomain_offset_of_proc();
+        luint             tPaddingSize  = aBackgroundMesh->get_parameters()->get_padding_size();
+
+        // elements of the current level of all trees within the proc domain, one after the other
+        Vector< Background_Element_Base* > tElements;
+        Vector< Background_Element_Base* > tChildren;
+
+        // trees within proc domain, their first element on the current level and position in tree data
+        Vector< uint >  tTrees;
+        Vector< luint > tFirstElements;
+        Vector< luint > tPositions;
+
+        uint tMaxNumberOfLevels = 0;
+
+        for ( uint iTree = 0; iTree < mTrees.size(); ++iTree )
+        {
+            Background_Element_Base* tCoarsestElement = get_coarsest_element_within_proc_domain(
+                    aBackgroundMesh,
+                    tSubdomainIJK,
+                    tProcOffset,
+                    tPaddingSize,
+                    mTreeIJK.memptr() + iTree * mNumberOfDimensions );
+
+            if ( tCoarsestElement != nullptr )
+            {
+                tFirstElements.push_back( tElements.size() );
+                tTrees.push_back( iTree );
+                tPositions.push_back( 1 );
+                tElements.push_back( tCoarsestElement );
+
+                tMaxNumberOfLevels = std::max( tMaxNumberOfLevels, (uint)mTrees( iTree )( 0 ) );
+            }
+        }
+
+        tFirstElements.push_back( tElements.size() );
+
+        // refinement is collective, all procs loop over the same number of levels
+        uint tNumberOfLevels = max_all( tMaxNumberOfLevels );
+
+        for ( uint iLevel = 0; iLevel < tNumberOfLevels; ++iLevel )
+        {
+            for ( uint iPattern = 0; iPattern < tNumberOfPatterns; ++iPattern )
+            {
+                // select pattern
+                aBackgroundMesh->set_activation_pattern( mPatterns( iPattern ) );
+
+                for ( uint iTree = 0; iTree < tTrees.size(); ++iTree )
+                {
+                    const Vector< uint64_t >& tTree = mTrees( tTrees( iTree ) );
+
+                    if ( iLevel >= tTree( 0 ) )
+                    {
+                        continue;
+                    }
+
+                    luint tNumberOfElements = tTree( tPositions( iTree ) );
+                    luint tNumberOfWords    = get_number_of_words( tNumberOfElements );
+
+                    MORIS_ERROR( tNumberOfElements == tFirstElements( iTree + 1 ) - tFirstElements( iTree ),
+                            "Restart_File::apply_refinement_pattern() - Number of elements on level %u does not match file.",
+                            iLevel );
+
+                    const uint64_t* tBitmap = tTree.memptr() + tPositions( iTree ) + 1 + iPattern * tNumberOfWords;
+
+                    for ( luint iWord = 0; iWord < tNumberOfWords; ++iWord )
+                    {
+                        uint64_t tWord = tBitmap[ iWord ];
+
+                        // only visit set bits
+                        while ( tWord != 0 )
+                        {
+                            uint tBit = __builtin_ctzll( tWord );
+
+                            tElements( tFirstElements( iTree ) + iWord * 64 + tBit )->put_on_refinement_queue();
+
+                            tWord &= tWord - 1;
+                        }
+                    }
+                }
+
+                aBackgroundMesh->perform_refinement( mPatterns( iPattern ) );
+            }
+
+            // collect next level of all trees
+            tChildren.clear();
+
+            for ( uint iTree = 0; iTree < tTrees.size(); ++iTree )
+            {
+                const Vector< uint64_t >& tTree = mTrees( tTrees( iTree ) );
+
+                luint tFirstChild = tChildren.size();
+
+                if ( iLevel < tTree( 0 ) )
+                {
+                    luint tNumberOfElements = tTree( tPositions( iTree ) );
+                    luint tNumberOfWords    = get_number_of_words( tNumberOfElements );
+
+                    collect_next_level( tElements, tFirstElements( iTree ), tNumberOfElements, tTree.memptr() + tPositions( iTree ) + 1, tNumberOfPatterns, tNumberOfChildren, tChildren );
+
+                    tPositions( iTree ) += 1 + tNumberOfPatterns * tNumberOfWords;
+                }
+
+                tFirstElements( iTree ) = tFirstChild;
+            }
+
+            tFirstElements( tTrees.size() ) = tChildren.size();
+
+            std::swap( tElements, tChildren );
+        }
+
+        aBackgroundMesh->update_database();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::add_field(
+            const std::string&      aLabel,
+            const Matrix< DDRMat >& aCoefficients )
+    {
+        mFieldLabels.push_back( aLabel );
+        mFieldCoefficients.push_back( aCoefficients );
+    }
+
+    //------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >&
+    Restart_File::get_field( const std::string& aLabel ) const
+    {
+        for ( uint iField = 0; iField < mFieldLabels.size(); ++iField )
+        {
+            if ( mFieldLabels( iField ) == aLabel )
+            {
+                return mFieldCoefficients( iField );
+            }
+        }
+
+        MORIS_ERROR( false,
+                "Restart_File::get_field() - Field %s not found in restart file, fields can only be read on the same processor decomposition.",
+                aLabel.c_str() );
+
+        return mFieldCoefficients( 0 );
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::save( const std::string& aPath ) const
+    {
+        // assemble file content in 8 byte words
+        Vector< uint64_t > tBuffer;
+
+        tBuffer.push_back( gRestartFileMagic );
+        tBuffer.push_back( mNumberOfFiles );
+        tBuffer.push_back( mNumberOfDimensions );
+
+        // processor splits for the same number of procs
+        tBuffer.push_back( mProcessorSplits.size() );
+
+        for ( uint tSplit : mProcessorSplits )
+        {
+            tBuffer.push_back( tSplit );
+        }
+
+        // bounding box of trees, such that files outside a proc domain can be skipped when loading
+        luint tFirstWord = tBuffer.size();
+
+        tBuffer.resize( tFirstWord + 2 * mNumberOfDimensions, 0 );
+
+        for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+        {
+            tBuffer( tFirstWord + iDim ) = MORIS_LUINT_MAX;
+        }
+
+        for ( uint iTree = 0; iTree < mTrees.size(); ++iTree )
+        {
+            for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+            {
+                luint tPosition = mTreeIJK( iTree * mNumberOfDimensions + iDim );
+
+                tBuffer( tFirstWord + iDim ) = std::min( (luint)tBuffer( tFirstWord + iDim ), tPosition );
+
+                tBuffer( tFirstWord + mNumberOfDimensions + iDim ) = std::max( (luint)tBuffer( tFirstWord + mNumberOfDimensions + iDim ), tPosition );
+            }
+        }
+
+        // patterns
+        tBuffer.push_back( mPatterns.size() );
+
+        for ( uint tPattern : mPatterns )
+        {
+            tBuffer.push_back( tPattern );
+        }
+
+        // trees
+        tBuffer.push_back( mTrees.size() );
+
+        for ( uint iTree = 0; iTree < mTrees.size(); ++iTree )
+        {
+            for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+            {
+                tBuffer.push_back( mTreeIJK( iTree * mNumberOfDimensions + iDim ) );
+            }
+
+            tBuffer.push_back( mTrees( iTree ).size() );
+            tBuffer.append( mTrees( iTree ) );
+        }
+
+        // fields
+        tBuffer.push_back( mFieldLabels.size() );
+
+        for ( uint iField = 0; iField < mFieldLabels.size(); ++iField )
+        {
+            const std::string&      tLabel        = mFieldLabels( iField );
+            const Matrix< DDRMat >& tCoefficients = mFieldCoefficients( iField );
+
+            luint tLabelWords = ( tLabel.size() + 7 ) / 8;
+
+            tFirstWord = tBuffer.size();
+
+            tBuffer.push_back( tLabel.size() );
+            tBuffer.push_back( tCoefficients.n_rows() );
+            tBuffer.push_back( tCoefficients.n_cols() );
+            tBuffer.resize( tFirstWord + 3 + tLabelWords + tCoefficients.numel(), 0 );
+
+            std::memcpy( tBuffer.memptr() + tFirstWord + 3, tLabel.data(), tLabel.size() );
+            std::memcpy( tBuffer.memptr() + tFirstWord + 3 + tLabelWords, tCoefficients.data(), tCoefficients.numel() * sizeof( real ) );
+        }
+
+        std::string tPath = parallelize_path( aPath );
+
+        std::ofstream tFile( tPath, std::ios::binary );
+
+        MORIS_ERROR( tFile, "Restart_File::save() - Could not create file %s.", tPath.c_str() );
+
+        tFile.write( reinterpret_cast< const char* >( tBuffer.memptr() ), tBuffer.size() * sizeof( uint64_t ) );
+
+        // index with number of files, such that the refinement can be read on any number of procs
+        if ( par_size() > 1 && par_rank() == 0 )
+        {
+            uint64_t tIndex[ 2 ] = { gRestartIndexMagic, (uint64_t)par_size() };
+
+            std::ofstream tIndexFile( aPath, std::ios::binary );
+
+            MORIS_ERROR( tIndexFile, "Restart_File::save() - Could not create file %s.", aPath.c_str() );
+
+            tIndexFile.write( reinterpret_cast< const char* >( tIndex ), sizeof( tIndex ) );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::load(
+            const std::string&    aPath,
+            Background_Mesh_Base* aBackgroundMesh )
+    {
+        mPatterns.clear();
+        mTreeIJK.clear();
+        mTrees.clear();
+        mFieldLabels.clear();
+        mFieldCoefficients.clear();
+
+        // read number of files from index or from file written in serial
+        uint64_t tHeader[ 2 ] = { 0, 0 };
+
+        {
+            std::ifstream tFile( aPath, std::ios::binary );
+
+            MORIS_ERROR( tFile, "Restart_File::load() - Could not open file %s.", aPath.c_str() );
+
+            tFile.read( reinterpret_cast< char* >( tHeader ), sizeof( tHeader ) );
+
+            MORIS_ERROR( tFile && ( tHeader[ 0 ] == gRestartIndexMagic || tHeader[ 0 ] == gRestartFileMagic ),
+                    "Restart_File::load() - %s is not an HMR restart file.",
+                    aPath.c_str() );
+        }
+
+        mNumberOfFiles = tHeader[ 1 ];
+
+        for ( uint iFile = 0; iFile < mNumberOfFiles; ++iFile )
+        {
+            this->load_file( get_file_path( aPath, mNumberOfFiles, iFile ), iFile, aBackgroundMesh );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Restart_File::load_file(
+            const std::string&    aPath,
+            uint                  aFileIndex,
+            Background_Mesh_Base* aBackgroundMesh )
+    {
+        std::ifstream tFile( aPath, std::ios::binary | std::ios::ate );
+
+        MORIS_ERROR( tFile, "Restart_File::load() - Could not open file %s.", aPath.c_str() );
+
+        std::streamsize tFileSize = tFile.tellg();
+        tFile.seekg( 0, std::ios::beg );
+
+        MORIS_ERROR( tFileSize % sizeof( uint64_t ) == 0 && tFileSize >= (std::streamsize)( 4 * sizeof( uint64_t ) ),
+                "Restart_File::load() - File %s is corrupted.",
+                aPath.c_str() );
+
+        // fields belong to the proc that wrote them and are only read on the same decomposition
+        bool tReadFields = mNumberOfFiles == (uint)par_size() && aFileIndex == (uint)par_rank();
+
+        // read header with processor splits and bounding box of trees first
+        Vector< uint64_t > tBuffer( 4 );
+
+        tFile.read( reinterpret_cast< char* >( tBuffer.memptr() ), 4 * sizeof( uint64_t ) );
+
+        MORIS_ERROR( tFile && tBuffer( 0 ) == gRestartFileMagic, "Restart_File::load() - %s is not an HMR restart file.", aPath.c_str() );
+
+        MORIS_ERROR( tBuffer( 1 ) == mNumberOfFiles, "Restart_File::load() - %s does not belong to the same restart file.", aPath.c_str() );
+
+        mNumberOfDimensions = tBuffer( 2 );
+
+        uint tNumberOfSplits = tBuffer( 3 );
+
+        Vector< uint64_t > tHeader( tNumberOfSplits + 2 * mNumberOfDimensions );
+
+        tFile.read( reinterpret_cast< char* >( tHeader.memptr() ), tHeader.size() * sizeof( uint64_t ) );
+
+        MORIS_ERROR( tFile, "Restart_File::load() - Unexpected end of file %s.", aPath.c_str() );
+
+        mProcessorSplits.resize( tNumberOfSplits );
+
+        for ( uint iSplit = 0; iSplit < tNumberOfSplits; ++iSplit )
+        {
+            mProcessorSplits( iSplit ) = tHeader( iSplit );
+        }
+
+        const uint64_t* tBoundingBox = tHeader.memptr() + tNumberOfSplits;
+
+        // proc domain in global positions without padding
+        Matrix< DDLUMat > tSubdomainIJK;
+        Matrix< DDLUMat > tProcOffset;
+        luint             tPaddingSize = 0;
+
+        if ( aBackgroundMesh != nullptr )
+        {
+            tSubdomainIJK = aBackgroundMesh->get_subdomain_ijk();
+            tProcOffset   = aBackgroundMesh->get_subdomain_offset_of_proc();
+            tPaddingSize  = aBackgroundMesh->get_parameters()->get_padding_size();
+
+            MORIS_ERROR( tSubdomainIJK.n_cols() == mNumberOfDimensions,
+                    "Restart_File::load() - File %s was written for a mesh with %u dimensions.",
+                    aPath.c_str(),
+                    mNumberOfDimensions );
+
+            // skip files whose trees are all outside of the proc domain, the box of a file without trees is empty
+            bool tOverlaps = true;
+
+            for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+            {
+                tOverlaps = tOverlaps
+                         && tBoundingBox[ iDim ] <= tBoundingBox[ mNumberOfDimensions + iDim ]
+                         && tBoundingBox[ iDim ] + tPaddingSize <= tProcOffset( iDim, 0 ) + tSubdomainIJK( 1, iDim )
+                         && tBoundingBox[ mNumberOfDimensions + iDim ] + tPaddingSize >= tProcOffset( iDim, 0 ) + tSubdomainIJK( 0, iDim );
+            }
+
+            if ( !tOverlaps && !tReadFields )
+            {
+                return;
+            }
+        }
+
+        // read rest of file at once
+        luint tHeaderWords = 4 + tNumberOfSplits + 2 * mNumberOfDimensions;
+
+        tBuffer.resize( tFileSize / sizeof( uint64_t ) - tHeaderWords );
+
+        tFile.read( reinterpret_cast< char* >( tBuffer.memptr() ), tBuffer.size() * sizeof( uint64_t ) );
+
+        luint tPosition = 0;
+
+        // reads next word, checking that the file has not ended
+        auto tNext = [ & ]() -> uint64_t {
+            MORIS_ERROR( tPosition < tBuffer.size(), "Restart_File::load() - Unexpected end of file %s.", aPath.c_str() );
+            return tBuffer( tPosition++ );
+        };
+
+        // patterns, same in all files
+        uint tNumberOfPatterns = tNext();
+
+        mPatterns.resize( tNumberOfPatterns );
+
+        for ( uint& tPattern : mPatterns )
+        {
+            tPattern = tNext();
+        }
+
+        // trees
+        luint tNumberOfTrees = tNext();
+
+        for ( luint iTree = 0; iTree < tNumberOfTrees; ++iTree )
+        {
+            luint tIJK[ 3 ] = { 0, 0, 0 };
+
+            bool tIsWithinProcDomain = true;
+
+            for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+            {
+                tIJK[ iDim ] = tNext();
+
+                if ( aBackgroundMesh != nullptr )
+                {
+                    tIsWithinProcDomain = tIsWithinProcDomain
+                                       && tIJK[ iDim ] + tPaddingSize >= tProcOffset( iDim, 0 ) + tSubdomainIJK( 0, iDim )
+                                       && tIJK[ iDim ] + tPaddingSize <= tProcOffset( iDim, 0 ) + tSubdomainIJK( 1, iDim );
+                }
+            }
+
+            luint tNumberOfWords = tNext();
+
+            MORIS_ERROR( tPosition + tNumberOfWords <= tBuffer.size(), "Restart_File::load() - Unexpected end of file %s.", aPath.c_str() );
+
+            if ( tIsWithinProcDomain )
+            {
+                for ( uint iDim = 0; iDim < mNumberOfDimensions; ++iDim )
+                {
+                    mTreeIJK.push_back( tIJK[ iDim ] );
+                }
+
+                Vector< uint64_t > tTree( tNumberOfWords );
+                std::memcpy( tTree.memptr(), tBuffer.memptr() + tPosition, tNumberOfWords * sizeof( uint64_t ) );
+
+                mTrees.push_back( std::move( tTree ) );
+            }
+
+            tPosition += tNumberOfWords;
+        }
+
+        if ( !tReadFields )
+        {
+            return;
+        }
+
+        // fields
+        uint tNumberOfFields = tNext();
+
+        mFieldLabels.resize( tNumberOfFields );
+        mFieldCoefficients.resize( tNumberOfFields );
+
+        for ( uint iField = 0; iField < tNumberOfFields; ++iField )
+        {
+            luint tLabelLength = tNext();
+            luint tNumRows     = tNext();
+            luint tNumCols     = tNext();
+
+            luint tLabelWords = ( tLabelLength + 7 ) / 8;
+
+            MORIS_ERROR( tPosition + tLabelWords + tNumRows * tNumCols <= tBuffer.size(),
+                    "Restart_File::load() - Unexpected end of file %s.",
+                    aPath.c_str() );
+
+            mFieldLabels( iField ).assign( reinterpret_cast< const char* >( tBuffer.memptr() + tPosition ), tLabelLength );
+
+            mFieldCoefficients( iField ).set_size( tNumRows, tNumCols );
+            std::memcpy( mFieldCoefficients( iField ).data(), tBuffer.memptr() + tPosition + tLabelWords, tNumRows * tNumCols * sizeof( real ) );
+
+            tPosition += tLabelWords + tNumRows * tNumCols;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    Vector< uint >
+    Restart_File::read_processor_splits( const std::string& aPath )
+    {
+        uint64_t tHeader[ 4 ] = { 0, 0, 0, 0 };
+
+        // number of files from index or from file written in serial
+        {
+            std::ifstream tFile( aPath, std::ios::binary );
+
+            MORIS_ERROR( tFile, "Restart_File::read_processor_splits() - Could not open file %s.", aPath.c_str() );
+
+            tFile.read( reinterpret_cast< char* >( tHeader ), 2 * sizeof( uint64_t ) );
+        }
+
+        // splits only fit the processor grid of the same number of procs
+        if ( tHeader[ 1 ] != (uint64_t)par_size() )
+        {
+            return {};
+        }
+
+        std::string tPath = get_file_path( aPath, tHeader[ 1 ], 0 );
+
+        std::ifstream tFile( tPath, std::ios::binary );
+
+        MORIS_ERROR( tFile, "Restart_File::read_processor_splits() - Could not open file %s.", tPath.c_str() );
+
+        tFile.read( reinterpret_cast< char* >( tHeader ), 4 * sizeof( uint64_t ) );
+
+        MORIS_ERROR( tFile && tHeader[ 0 ] == gRestartFileMagic, "Restart_File::read_processor_splits() - %s is not an HMR restart file.", tPath.c_str() );
+
+        Vector< uint64_t > tSplits( tHeader[ 3 ] );
+
+        tFile.read( reinterpret_cast< char* >( tSplits.memptr() ), tSplits.size() * sizeof( uint64_t ) );
+
+        MORIS_ERROR( tFile, "Restart_File::read_processor_splits() - Unexpected end of file %s.", tPath.c_str() );
+
+        Vector< uint > tProcessorSplits( tSplits.size() );
+
+        for ( uint iSplit = 0; iSplit < tSplits.size(); ++iSplit )
+        {
+            tProcessorSplits( iSplit ) = tSplits( iSplit );
+        }
+
+        return tProcessorSplits;
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool
+    Restart_File::is_restart_file( const std::string& aPath )
+    {
+        return aPath.substr( aPath.find_last_of( '.' ) + 1 ) == "hmr";
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace moris::hmr
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_HMR_Restart_File.hpp
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "moris_typedefs.hpp"    //COR/src
+#include "cl_Matrix.hpp"         //LINALG/src
+#include "cl_Vector.hpp"         //CNT/src
+
+namespace moris::hmr
+{
+    class Background_Mesh_Base;
+
+    /**
+     * Binary restart file holding the refinement state of the background mesh and, optionally,
+     * coefficients of fields.
+     *
+     * The refinement state is stored per coarsest element that is refined on at least one stored pattern,
+     * identified by its global ijk-position without padding. For each of these trees, one bitmap per level
+     * and pattern is stored. The elements of a level are the children of all elements of the previous level
+     * of the tree that are refined on at least one stored pattern, ordered by parent and child index, i.e. in
+     * Morton order. Since no proc local positions or IDs are stored, the refinement can be restored on any
+     * processor decomposition of a background mesh with the same coarsest elements.
+     *
+     * Each proc writes its own file. In parallel, the first proc additionally writes an index at the given
+     * path that holds the number of files. Optionally, processor slabs are stored with which a mesh with this
+     * refinement is to be created on the same number of procs, see Database::compute_balanced_processor_splits().
+     * Fields are stored with the file of the proc that owns them and can only be restored on the same processor
+     * decomposition. All blocks of the file are aligned to 8 bytes and stored in native byte order.
+     */
+    class Restart_File
+    {
+      private:
+        //! number of files, i.e. processors, the refinement was written with
+        uint mNumberOfFiles = 0;
+
+        //! number of spatial dimensions
+        uint mNumberOfDimensions = 0;
+
+        //! processor slabs to restore the refinement with on the same number of procs, uniform slabs if empty
+        Vector< uint > mProcessorSplits;
+
+        //! stored patterns
+        Vector< uint > mPatterns;
+
+        //! global ijk-positions of coarsest elements of trees without padding, number of dimensions per tree
+        Vector< luint > mTreeIJK;
+
+        //! trees, i.e. number of levels followed by number of elements and bitmaps of all patterns per level
+        Vector< Vector< uint64_t > > mTrees;
+
+        //! labels and coefficients of fields
+        Vector< std::string >      mFieldLabels;
+        Vector< Matrix< DDRMat > > mFieldCoefficients;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * number of 64 bit words of the bitmap of one pattern on a level
+         */
+        static luint
+        get_number_of_words( luint aNumberOfElements )
+        {
+            return ( aNumberOfElements + 63 ) / 64;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * reads one file, keeping only trees within the proc domain of the background mesh if given
+         *
+         * @param[ in ] aPath             path to file
+         * @param[ in ] aFileIndex        index of file, i.e. rank of the proc that wrote it
+         * @param[ in ] aBackgroundMesh   background mesh whose proc domain is restored, all trees if null
+         */
+        void load_file(
+                const std::string&    aPath,
+                uint                  aFileIndex,
+                Background_Mesh_Base* aBackgroundMesh );
+
+      public:
+        //-------------------------------------------------------------------------------
+
+        Restart_File() = default;
+
+        //-------------------------------------------------------------------------------
+
+        ~Restart_File() = default;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * stores the refinement state of the given patterns of the coarsest elements within the proc domain
+         *
+         * @param[ in ] aBackgroundMesh   pointer to background mesh
+         * @param[ in ] aPatterns         patterns to be stored, need to include all refined patterns that are restored
+         */
+        void set_refinement_pattern(
+                Background_Mesh_Base*   aBackgroundMesh,
+                const Matrix< DDUMat >& aPatterns );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * restores the stored refinement of the trees within the proc domain on a background mesh that has
+         * been created with the same coarsest elements, the processor decomposition may differ
+         *
+         * @param[ inout ] aBackgroundMesh   pointer to background mesh
+         */
+        void apply_refinement_pattern( Background_Mesh_Base* aBackgroundMesh ) const;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * sets the processor slabs a mesh with this refinement is to be created with, e.g. for load balancing
+         *
+         * @param[ in ] aProcessorSplits   number of coarsest elements per processor slab, concatenated over all directions
+         */
+        void
+        set_processor_splits( const Vector< uint >& aProcessorSplits )
+        {
+            mProcessorSplits = aProcessorSplits;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * returns the processor slabs a mesh with this refinement is to be created with, uniform slabs if empty
+         */
+        const Vector< uint >&
+        get_processor_splits() const
+        {
+            return mProcessorSplits;
+        }
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * adds coefficients of a field to the file
+         *
+         * @param[ in ] aLabel          label of field
+         * @param[ in ] aCoefficients   coefficients owned by this proc
+         */
+        void add_field(
+                const std::string&      aLabel,
+                const Matrix< DDRMat >& aCoefficients );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * returns the coefficients of a field stored in the file
+         *
+         * @param[ in ] aLabel   label of field
+         */
+        const Matrix< DDRMat >& get_field( const std::string& aLabel ) const;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * writes the file of this proc, the processor count and rank are added to the path in parallel,
+         * and the first proc writes the index to the path itself
+         *
+         * @param[ in ] aPath   path to file
+         */
+        void save( const std::string& aPath ) const;
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * reads the files of all procs the refinement was written with, fields are only read if the
+         * number of procs is the same
+         *
+         * @param[ in ] aPath             path to file as passed to save()
+         * @param[ in ] aBackgroundMesh   if given, only trees within the proc domain of this mesh are read,
+         *                                and files that do not overlap it are skipped
+         */
+        void load(
+                const std::string&    aPath,
+                Background_Mesh_Base* aBackgroundMesh = nullptr );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * reads the processor slabs stored in a restart file before a mesh is created
+         *
+         * @param[ in ] aPath   path to file as passed to save()
+         *
+         * @return processor splits, empty if none are stored or the file was written on a different number of procs
+         */
+        static Vector< uint > read_processor_splits( const std::string& aPath );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * tells if a path refers to a binary restart file, i.e. has the extension "hmr"
+         */
+        static bool is_restart_file( const std::string& aPath );
+
+        //-------------------------------------------------------------------------------
+    };
+}    // namespace moris::hmr
@@ -12,6 +12,7 @@
 #include "HMR_Globals.hpp"        //HMR/src
 #include "fn_eye.hpp"
 #include "fn_inv.hpp"             //LINALG/src
+#include "moris_openmp.hpp"       //COR/src
 
 namespace moris::hmr
 {
@@ -80,8 +81,14 @@ namespace moris::hmr
         // allocate max memory for Basis
         aDOFs.resize( tMaxNumberOfBasis, nullptr );
 
-        // write unity into level matrix
-        Matrix< DDRMat > tT( mEye );
+        // level matrix starts with unity, points to cached products or to work matrix
+        const Matrix< DDRMat >* tT = &mEye;
+
+        // work matrix for products which are not cached
+        Matrix< DDRMat > tTWork;
+
+        // key of path of child indices, a leading one bit marks the path length
+        luint tPath = 1;
 
         // counter for basis
         uint tBasisCount = 0;
@@ -102,18 +109,26 @@ namespace moris::hmr
                 if ( tBasis->is_active() )
                 {
                     // copy columns into matrix
-                    aTMatrixTransposed.set_column( tBasisCount, tT.get_column( iBasisIndex ) );
+                    aTMatrixTransposed.set_column( tBasisCount, tT->get_column( iBasisIndex ) );
 
                     // copy pointer to basis into output array
                     aDOFs( tBasisCount++ ) = tBasis;
                 }
             }
 
-            // left-multiply T-Matrix with child matrix
-            tT = tT * mChildMatrices( tParent->get_background_element()->get_child_index() );
-
-            // jump to next
-            tParent = mBSplineMesh->get_parent_of_element( tParent );
+            // no product needed beyond coarsest level
+            if ( iLevelIndex < tLevel )
+            {
+                // left-multiply T-Matrix with child matrix
+                tT = this->multiply_child_matrix(
+                        tPath,
+                        tParent->get_background_element()->get_child_index(),
+                        *tT,
+                        tTWork );
+
+                // jump to next
+                tParent = mBSplineMesh->get_parent_of_element( tParent );
+            }
         }
 
         // Shrink memory to exact size
@@ -123,6 +138,83 @@ namespace moris::hmr
 
     //-------------------------------------------------------------------------------
 
+    void
+    T_Matrix_Base::set_cache( T_Matrix_Cache* aCache )
+    {
+        mCache = aCache;
+
+        // child matrices are only needed and cached for non-truncated T-matrices
+        if ( mCache == nullptr || mBSplineMesh == nullptr || mChildMatrices.size() == 0 )
+        {
+            mCache = nullptr;
+            return;
+        }
+
+        // number of dimensions from number of children
+        uint tNumberOfDimensions = 0;
+        while ( ( 1u << tNumberOfDimensions ) < mChildMatrices.size() )
+        {
+            tNumberOfDimensions++;
+        }
+
+        mChildIndexBits = tNumberOfDimensions;
+
+        // B-spline basis given by number of dimensions, orders per dimension and truncation
+        mCacheFamily = tNumberOfDimensions;
+
+        for ( uint iDimension = 0; iDimension < tNumberOfDimensions; iDimension++ )
+        {
+            mCacheFamily = 32 * mCacheFamily + mBSplineMesh->get_order( iDimension );
+        }
+
+        mCacheFamily = 2 * mCacheFamily + mTruncate;
+    }
+
+    //-------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >*
+    T_Matrix_Base::multiply_child_matrix(
+            luint&                  aPath,
+            uint                    aChildIndex,
+            const Matrix< DDRMat >& aProduct,
+            Matrix< DDRMat >&       aWork )
+    {
+        if ( mCache != nullptr )
+        {
+            // extend path key as long as it fits, paths which do not fit are not cached
+            if ( aPath != 0 && ( aPath >> ( 63 - mChildIndexBits ) ) == 0 )
+            {
+                aPath = ( aPath << mChildIndexBits ) | aChildIndex;
+            }
+            else
+            {
+                aPath = 0;
+            }
+
+            if ( aPath != 0 )
+            {
+                const Matrix< DDRMat >* tCachedProduct = mCache->get_product( mCacheFamily, aPath );
+
+                if ( tCachedProduct != nullptr )
+                {
+                    return tCachedProduct;
+                }
+
+                aWork = aProduct * mChildMatrices( aChildIndex );
+
+                tCachedProduct = mCache->add_product( mCacheFamily, aPath, aWork );
+
+                return tCachedProduct != nullptr ? tCachedProduct : &aWork;
+            }
+        }
+
+        aWork = aProduct * mChildMatrices( aChildIndex );
+
+        return &aWork;
+    }
+
+    //-------------------------------------------------------------------------------
+
     void
     T_Matrix_Base::calculate_truncated_t_matrix(
             luint             aElementMemoryIndex,
@@ -308,7 +400,7 @@ namespace moris::hmr
             const bool aBool )
     {
         // get B-Spline pattern of this mesh
-        auto tBSplinePattern = mBSplineMesh->get_activation_pattern();
+        uint tBSplinePattern = mBSplineMesh->get_activation_pattern();
 
         // select pattern
         mLagrangeMesh->select_activation_pattern();
@@ -322,135 +414,193 @@ namespace moris::hmr
         // number of nodes per element
         uint tNumberOfNodesPerElement = mLagrangeMesh->get_number_of_bases_per_element();
 
-        // unity matrix
-        Matrix< DDRMat > tEye;
-        eye( tNumberOfNodesPerElement, tNumberOfNodesPerElement, tEye );
-
         // calculate transposed Lagrange T-Matrix
         Matrix< DDRMat > tL( this->get_lagrange_matrix() );
 
-        // loop over all elements
+        // Step 1: assign each node to the first element containing it, as in a sequential loop over all elements
+        Vector< luint > tElementIndices;
+        Vector< luint > tElementOffsets( 1, 0 );
+        Vector< uint >  tLocalNodeIndices;
+
         for ( luint iElementIndex = 0; iElementIndex < tNumberOfElements; iElementIndex++ )
         {
             // get pointer to element
-            auto tLagrangeElement = mLagrangeMesh->get_element( iElementIndex );
+            Element* tLagrangeElement = mLagrangeMesh->get_element( iElementIndex );
 
-            // FIXME : activate this flag
-            // if ( tLagrangeElement->get_t_matrix_flag() )
+            // loop over all nodes of this element
+            for ( uint iLagNode = 0; iLagNode < tNumberOfNodesPerElement; iLagNode++ )
             {
-                // get pointer to background element
-                auto tBackgroundElement = tLagrangeElement->get_background_element();
+                // pointer to node
+                Basis* tNode = tLagrangeElement->get_basis( iLagNode );
 
-                // initialize refinement Matrix
-                Matrix< DDRMat > tR;
+                // test if node is flagged
+                if ( !tNode->is_flagged() )
+                {
+                    tLocalNodeIndices.push_back( iLagNode );
 
-                bool tLagrangeEqualBspline    = false;
-                bool tFirstLagrangeRefinement = true;
+                    // flag this node as processed
+                    tNode->flag();
+                }
+            }
+
+            // only elements with nodes to process need a T-matrix
+            if ( tLocalNodeIndices.size() > tElementOffsets( tElementOffsets.size() - 1 ) )
+            {
+                tElementIndices.push_back( iElementIndex );
+                tElementOffsets.push_back( tLocalNodeIndices.size() );
+            }
+        }
+
+        // coefficients and DOFs of each assigned node
+        Vector< Matrix< DDRMat > > tNodeWeights( tLocalNodeIndices.size() );
+        Vector< Vector< Basis* > > tNodeDOFs( tLocalNodeIndices.size() );
+
+        // Step 2: evaluate T-matrices of the elements independently of each other
+        sint tNumberOfAssignedElements = tElementIndices.size();
+
+        MORIS_OMP_PRAGMA( omp parallel for schedule( dynamic, 16 ) )
+        for ( sint iElement = 0; iElement < tNumberOfAssignedElements; iElement++ )
+        {
+            Element* tLagrangeElement = mLagrangeMesh->get_element( tElementIndices( iElement ) );
 
-                while ( !tBackgroundElement->is_active( tBSplinePattern ) )
+            Matrix< DDRMat > tT;
+            Vector< Basis* > tDOFs;
+
+            this->calculate_lagrange_t_matrix( tLagrangeElement, tBSplinePattern, tL, tT, tDOFs );
+
+            // number of columns in T-Matrix
+            uint tNCols = tT.n_cols();
+
+            // epsilon to count T-Matrix
+            real tEpsilon = 1e-12;
+
+            // loop over all nodes assigned to this element
+            for ( luint iNode = tElementOffsets( iElement ); iNode < tElementOffsets( iElement + 1 ); iNode++ )
+            {
+                uint tLagNode = tLocalNodeIndices( iNode );
+
+                // initialize counter
+                uint tNodeCount = 0;
+
+                // reserve DOF cell and matrix with coefficients
+                Vector< Basis* >& tDOFsOfNode  = tNodeDOFs( iNode );
+                Matrix< DDRMat >& tCoefficients = tNodeWeights( iNode );
+
+                tDOFsOfNode.resize( tNCols, nullptr );
+                tCoefficients.set_size( tNCols, 1 );
+
+                // loop over all nonzero entries
+                for ( uint iBspBF = 0; iBspBF < tNCols; ++iBspBF )
                 {
-                    if ( tFirstLagrangeRefinement )
-                    {
-                        // right multiply refinement matrix
-                        tR                       = this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                        tFirstLagrangeRefinement = false;
-                        tLagrangeEqualBspline    = true;
-                    }
-                    else
+                    // get the T-matrix entry
+                    real tTMatEntry = tT( tLagNode, iBspBF );
+
+                    // ignore entries close to zero
+                    if ( std::abs( tTMatEntry ) > tEpsilon )
                     {
-                        tR = tR * this->get_refinement_matrix( tBackgroundElement->get_child_index() );
-                    }
+                        // copy entry of T-Matrix
+                        tCoefficients( tNodeCount ) = tTMatEntry;
 
-                    // jump to parent
-                    tBackgroundElement = tBackgroundElement->get_parent();
+                        // copy pointer of dof
+                        tDOFsOfNode( tNodeCount++ ) = tDOFs( iBspBF );
+                    }
                 }
 
-                // calculate the B-Spline T-Matrix
-                Matrix< DDRMat > tB;
-                Vector< Basis* > tDOFs;
+                tCoefficients.resize( tNodeCount, 1 );
+                tDOFsOfNode.resize( tNodeCount );
+            }
+        }
 
-                uint tElemMemIndex = tBackgroundElement->get_memory_index();
-                this->calculate_t_matrix(
-                        tElemMemIndex,
-                        tB,
-                        tDOFs );
+        // Step 3: merge into node interpolations in element order
+        for ( sint iElement = 0; iElement < tNumberOfAssignedElements; iElement++ )
+        {
+            Element* tLagrangeElement = mLagrangeMesh->get_element( tElementIndices( iElement ) );
 
-                Matrix< DDRMat > tT;
+            for ( luint iNode = tElementOffsets( iElement ); iNode < tElementOffsets( iElement + 1 ); iNode++ )
+            {
+                // pointer to node
+                Basis* tNode = tLagrangeElement->get_basis( tLocalNodeIndices( iNode ) );
 
-                if ( tLagrangeEqualBspline )
-                {
-                    // transposed T-Matrix
-                    tT = tR * tL * tB;
-                }
-                else
-                {
-                    tT = tL * tB;
-                }
+                // convert DOFs to mtk::Vertex and flag them
+                Vector< mtk::Vertex* > tVertexDOFs( tNodeDOFs( iNode ).size() );
 
-                // number of columns in T-Matrix
-                uint tNCols = tT.n_cols();
+                for ( uint iDOF = 0; iDOF < tNodeDOFs( iNode ).size(); iDOF++ )
+                {
+                    tVertexDOFs( iDOF ) = tNodeDOFs( iNode )( iDOF );
 
-                // epsilon to count T-Matrix
-                real tEpsilon = 1e-12;
+                    // flag this DOF
+                    tNodeDOFs( iNode )( iDOF )->flag();
+                }
 
-                // loop over all nodes of this element
-                for ( uint iLagNode = 0; iLagNode < tNumberOfNodesPerElement; iLagNode++ )
+                if ( aBool )
                 {
-                    // pointer to node
-                    auto tNode = tLagrangeElement->get_basis( iLagNode );
+                    // init interpolation container for this node
+                    tNode->init_interpolation( aBSplineMeshIndex );
 
-                    // test if node is flagged
-                    if ( !tNode->is_flagged() )
-                    {
-                        // initialize counter
-                        uint tNodeCount = 0;
+                    // store the coefficients
+                    tNode->set_weights( aBSplineMeshIndex, tNodeWeights( iNode ) );
 
-                        // reserve DOF cell
-                        Vector< mtk::Vertex* > tNodeDOFs( tNCols, nullptr );
+                    // store pointers to the DOFs
+                    tNode->set_coefficients( aBSplineMeshIndex, tVertexDOFs );
+                }
+            }
+        }
+    }
 
-                        // reserve matrix with coefficients
-                        Matrix< DDRMat > tCoefficients( tNCols, 1 );
+    //-------------------------------------------------------------------------------
 
-                        // loop over all nonzero entries
-                        for ( uint iBspBF = 0; iBspBF < tNCols; ++iBspBF )
-                        {
-                            // get the T-matrix entry
-                            real tTMatEntry = tT( iLagNode, iBspBF );
+    void
+    T_Matrix_Base::calculate_lagrange_t_matrix(
+            Element*                aLagrangeElement,
+            uint                    aBSplinePattern,
+            const Matrix< DDRMat >& aLagrangeMatrix,
+            Matrix< DDRMat >&       aTMatrix,
+            Vector< Basis* >&       aDOFs )
+    {
+        // get pointer to background element
+        Background_Element_Base* tBackgroundElement = aLagrangeElement->get_background_element();
 
-                            // ignore entries close to zero
-                            if ( std::abs( tTMatEntry ) > tEpsilon )
-                            {
-                                // copy entry of T-Matrix
-                                tCoefficients( tNodeCount ) = tTMatEntry;
+        // initialize refinement Matrix
+        Matrix< DDRMat > tR;
 
-                                // copy pointer of dof and convert to mtk::Vertex
-                                tNodeDOFs( tNodeCount++ ) = tDOFs( iBspBF );
+        bool tLagrangeEqualBspline    = false;
+        bool tFirstLagrangeRefinement = true;
 
-                                // flag this DOF
-                                tDOFs( iBspBF )->flag();
-                            }
-                        }
+        while ( !tBackgroundElement->is_active( aBSplinePattern ) )
+        {
+            if ( tFirstLagrangeRefinement )
+            {
+                // right multiply refinement matrix
+                tR                       = this->get_refinement_matrix( tBackgroundElement->get_child_index() );
+                tFirstLagrangeRefinement = false;
+                tLagrangeEqualBspline    = true;
+            }
+            else
+            {
+                tR = tR * this->get_refinement_matrix( tBackgroundElement->get_child_index() );
+            }
 
-                        tCoefficients.resize( tNodeCount, 1 );
-                        tNodeDOFs.resize( tNodeCount );
+            // jump to parent
+            tBackgroundElement = tBackgroundElement->get_parent();
+        }
 
-                        if ( aBool )
-                        {
-                            // init interpolation container for this node
-                            tNode->init_interpolation( aBSplineMeshIndex );
+        // calculate the B-Spline T-Matrix
+        Matrix< DDRMat > tB;
 
-                            // store the coefficients
-                            tNode->set_weights( aBSplineMeshIndex, tCoefficients );
+        this->calculate_t_matrix(
+                tBackgroundElement->get_memory_index(),
+                tB,
+                aDOFs );
 
-                            // store pointers to the DOFs
-                            tNode->set_coefficients( aBSplineMeshIndex, tNodeDOFs );
-                        }
-                        // flag this node as processed
-                        tNode->flag();
-                    }
-                }    // end loop over all nodes of this element
-            }        // end if element is flagged
-        }            // end loop over all elements
+        if ( tLagrangeEqualBspline )
+        {
+            // transposed T-Matrix
+            aTMatrix = tR * aLagrangeMatrix * tB;
+        }
+        else
+        {
+            aTMatrix = aLagrangeMatrix * tB;
+        }
     }
 
     //-------------------------------------------------------------------------------
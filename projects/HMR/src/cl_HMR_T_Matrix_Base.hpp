@@ -13,6 +13,7 @@
 #include "cl_HMR_BSpline_Mesh_Base.hpp"     //HMR/src
 #include "cl_HMR_Lagrange_Mesh_Base.hpp"    //HMR/src
 #include "cl_HMR_Parameters.hpp"            //HMR/src
+#include "cl_HMR_T_Matrix_Cache.hpp"        //HMR/src
 #include "moris_typedefs.hpp"                     //COR/src
 #include "cl_Matrix.hpp"                    //LINALG/src
 #include "cl_Vector.hpp"                    //CNT/src
@@ -82,6 +83,15 @@ namespace moris::hmr
         //! matrices for changing the order of a Lagrange mesh
         Vector< Matrix< DDRMat > > mLagrangeChangeOrderMatrix;
 
+        //! cache of products of child matrices shared with other T-matrices, not owned
+        T_Matrix_Cache* mCache = nullptr;
+
+        //! key of B-spline basis in cache
+        luint mCacheFamily = 0;
+
+        //! number of bits of a child index in the path key of the cache
+        uint mChildIndexBits = 0;
+
       public:
         /**
          * Constructor initializing Lagrange coefficients
@@ -156,6 +166,13 @@ namespace moris::hmr
                 Matrix< DDRMat >& aTMatrixTransposed,
                 Vector< Basis* >&   aDOFs );
 
+        /**
+         * Sets the cache of refinement products used for non-truncated T-matrices
+         *
+         * @param aCache Cache shared with other T-matrices, nullptr to disable caching
+         */
+        void set_cache( T_Matrix_Cache* aCache );
+
       private:
         /**
          * Calculates the non-truncated T-matrix for a B-spline element.
@@ -169,6 +186,39 @@ namespace moris::hmr
                 Matrix< DDRMat >& aTMatrixTransposed,
                 Vector< Basis* >&   aDOFs );
 
+        /**
+         * Calculates the transposed T-matrix from the B-spline basis to the nodes of a Lagrange element. Only reads
+         * mesh data, such that it can be called for different elements concurrently.
+         *
+         * @param aLagrangeElement Lagrange element
+         * @param aBSplinePattern Activation pattern of the B-spline mesh
+         * @param aLagrangeMatrix Transposed Lagrange T-matrix
+         * @param aTMatrix T-matrix of the Lagrange element
+         * @param aDOFs B-spline bases of the T-matrix
+         */
+        void calculate_lagrange_t_matrix(
+                Element*                aLagrangeElement,
+                uint                    aBSplinePattern,
+                const Matrix< DDRMat >& aLagrangeMatrix,
+                Matrix< DDRMat >&       aTMatrix,
+                Vector< Basis* >&       aDOFs );
+
+        /**
+         * Multiplies the product of child matrices up to the current level with the child matrix of the next level,
+         * looking up the product in the cache if one is set.
+         *
+         * @param aPath Key of path of child indices up to the current level, extended by the child index, 0 if too long
+         * @param aChildIndex Child index of the element on the current level
+         * @param aProduct Product of child matrices up to the current level
+         * @param aWork Matrix storing the product if it is not cached
+         * @return Product of child matrices up to the next level
+         */
+        const Matrix< DDRMat >* multiply_child_matrix(
+                luint&                  aPath,
+                uint                    aChildIndex,
+                const Matrix< DDRMat >& aProduct,
+                Matrix< DDRMat >&       aWork );
+
         /**
          * Calculates the truncated T-matrix for a B-spline element.
          *
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_HMR_T_Matrix_Cache.cpp
+ *
+ */
+
+#include "cl_HMR_T_Matrix_Cache.hpp"    //HMR/src
+
+namespace moris::hmr
+{
+    //-------------------------------------------------------------------------------
+
+    T_Matrix_Cache::T_Matrix_Cache( luint aMaxNumberOfValues )
+            : mMaxNumberOfValues( aMaxNumberOfValues )
+    {
+    }
+
+    //-------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >*
+    T_Matrix_Cache::get_product(
+            luint aFamily,
+            luint aPath ) const
+    {
+        std::lock_guard< std::mutex > tLock( mMutex );
+
+        auto tIterator = mProducts.find( { aFamily, aPath } );
+
+        if ( tIterator == mProducts.end() )
+        {
+            return nullptr;
+        }
+
+        return &tIterator->second;
+    }
+
+    //-------------------------------------------------------------------------------
+
+    const Matrix< DDRMat >*
+    T_Matrix_Cache::add_product(
+            luint                   aFamily,
+            luint                   aPath,
+            const Matrix< DDRMat >& aProduct )
+    {
+        std::lock_guard< std::mutex > tLock( mMutex );
+
+        // stop caching once memory limit is reached
+        if ( mNumberOfValues + aProduct.numel() > mMaxNumberOfValues )
+        {
+            return nullptr;
+        }
+
+        auto tInsertion = mProducts.emplace( std::make_pair( aFamily, aPath ), aProduct );
+
+        if ( tInsertion.second )
+        {
+            mNumberOfValues += aProduct.numel();
+        }
+
+        // pointers to entries of map stay valid when further products are added
+        return &tInsertion.first->second;
+    }
+
+    //-------------------------------------------------------------------------------
+
+    void
+    T_Matrix_Cache::clear()
+    {
+        std::lock_guard< std::mutex > tLock( mMutex );
+
+        mProducts.clear();
+        mNumberOfValues = 0;
+    }
+
+    //-------------------------------------------------------------------------------
+}    // namespace moris::hmr
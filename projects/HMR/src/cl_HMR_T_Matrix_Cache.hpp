@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_HMR_T_Matrix_Cache.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+
+#include "moris_typedefs.hpp"    //COR/src
+#include "cl_Matrix.hpp"         //LINALG/src
+
+namespace moris::hmr
+{
+    /**
+     * Cache of accumulated products of child matrices along refinement paths.
+     *
+     * The product of the child matrices from an element up to one of its ancestors only depends on the child indices
+     * along this path and on the B-spline basis, i.e. the number of dimensions and the polynomial orders. The cache is
+     * owned by the database and shared by the T-matrices of all B-spline meshes, such that elements with the same
+     * path suffix look up their products instead of recomputing them. Products are never invalidated by refinement.
+     * Lookups and insertions are locked, such that T-matrices of different elements can be computed concurrently.
+     */
+    class T_Matrix_Cache
+    {
+      private:
+        //! products of child matrices, keyed by basis family and path of child indices
+        std::map< std::pair< luint, luint >, Matrix< DDRMat > > mProducts;
+
+        //! maximum number of matrix entries stored in cache
+        luint mMaxNumberOfValues;
+
+        //! number of matrix entries stored in cache
+        luint mNumberOfValues = 0;
+
+        //! lock for concurrent access
+        mutable std::mutex mMutex;
+
+      public:
+        // -----------------------------------------------------------------------------
+
+        /**
+         * Constructor
+         *
+         * @param aMaxNumberOfValues Maximum number of matrix entries stored, further products are not cached
+         */
+        explicit T_Matrix_Cache( luint aMaxNumberOfValues = 10000000 );
+
+        // -----------------------------------------------------------------------------
+
+        ~T_Matrix_Cache() = default;
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * Looks up the product for a refinement path
+         *
+         * @param aFamily Key of B-spline basis
+         * @param aPath Key of path of child indices
+         * @return Pointer to cached product, nullptr if not cached
+         */
+        const Matrix< DDRMat >* get_product(
+                luint aFamily,
+                luint aPath ) const;
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * Stores the product for a refinement path
+         *
+         * @param aFamily Key of B-spline basis
+         * @param aPath Key of path of child indices
+         * @param aProduct Product of child matrices along the path
+         * @return Pointer to cached product, nullptr if the cache is full
+         */
+        const Matrix< DDRMat >* add_product(
+                luint                   aFamily,
+                luint                   aPath,
+                const Matrix< DDRMat >& aProduct );
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * Returns the number of cached products
+         */
+        luint
+        get_number_of_products() const
+        {
+            std::lock_guard< std::mutex > tLock( mMutex );
+
+            return mProducts.size();
+        }
+
+        // -----------------------------------------------------------------------------
+
+        /**
+         * Deletes all cached products
+         */
+        void clear();
+
+        // -----------------------------------------------------------------------------
+    };
+}    // namespace moris::hmr
@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_HMR_balance_processor_splits.cpp
+ *
+ */
+
+#include "fn_HMR_balance_processor_splits.hpp"    //HMR/src
+
+#include <algorithm>
+
+#include "moris_typedefs.hpp"    //COR/src
+
+namespace moris::hmr
+{
+    namespace
+    {
+        //! maximum number of passes over all directions
+        const uint gMaxNumberOfSweeps = 10;
+
+        //! number of bisection steps for the maximum cost of a slab
+        const uint gNumberOfBisections = 50;
+
+        //------------------------------------------------------------------------------
+
+        // splits with the remainder elements on the first slabs, same as Background_Mesh::decompose_mesh()
+        Vector< uint >
+        get_uniform_splits(
+                const Vector< uint >& aNumberOfElementsPerDimension,
+                const Vector< uint >& aProcessorDimensions )
+        {
+            Vector< uint > tSplits;
+
+            for ( uint iDim = 0; iDim < aNumberOfElementsPerDimension.size(); ++iDim )
+            {
+                uint tNumberOfElements = aNumberOfElementsPerDimension( iDim );
+                uint tNumberOfSlabs    = aProcessorDimensions( iDim );
+
+                for ( uint iSlab = 0; iSlab < tNumberOfSlabs; ++iSlab )
+                {
+                    tSplits.push_back( tNumberOfElements / tNumberOfSlabs + ( iSlab < tNumberOfElements % tNumberOfSlabs ? 1 : 0 ) );
+                }
+            }
+
+            return tSplits;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // splits of one direction from splits concatenated over all directions
+        Vector< uint >
+        get_splits_of_direction(
+                const Vector< uint >& aProcessorSplits,
+                const Vector< uint >& aProcessorDimensions,
+                uint                  aDirection )
+        {
+            uint tFirstSplit = 0;
+
+            for ( uint iDim = 0; iDim < aDirection; ++iDim )
+            {
+                tFirstSplit += aProcessorDimensions( iDim );
+            }
+
+            Vector< uint > tSplits( aProcessorDimensions( aDirection ) );
+
+            for ( uint iSlab = 0; iSlab < aProcessorDimensions( aDirection ); ++iSlab )
+            {
+                tSplits( iSlab ) = aProcessorSplits( tFirstSplit + iSlab );
+            }
+
+            return tSplits;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // slab of each position of a coarsest element per direction
+        Vector< Vector< uint > >
+        get_slabs_of_positions(
+                const Vector< uint >& aProcessorDimensions,
+                const Vector< uint >& aProcessorSplits )
+        {
+            uint tNumberOfDimensions = aProcessorDimensions.size();
+
+            Vector< Vector< uint > > tSlabs( tNumberOfDimensions );
+
+            uint tFirstSplit = 0;
+
+            for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+            {
+                for ( uint iSlab = 0; iSlab < aProcessorDimensions( iDim ); ++iSlab )
+                {
+                    for ( uint iPosition = 0; iPosition < aProcessorSplits( tFirstSplit + iSlab ); ++iPosition )
+                    {
+                        tSlabs( iDim ).push_back( iSlab );
+                    }
+                }
+
+                tFirstSplit += aProcessorDimensions( iDim );
+            }
+
+            return tSlabs;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // cost per slice of a direction and group of processors with the same slabs in all other directions
+        Matrix< DDRMat >
+        compute_slice_costs(
+                const Matrix< DDRMat >&         aCosts,
+                const Vector< uint >&           aNumberOfElementsPerDimension,
+                const Vector< uint >&           aProcessorDimensions,
+                const Vector< Vector< uint > >& aSlabs,
+                uint                            aDirection )
+        {
+            uint tNumberOfDimensions = aNumberOfElementsPerDimension.size();
+
+            uint tNumberOfGroups = 1;
+
+            for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+            {
+                tNumberOfGroups *= iDim == aDirection ? 1 : aProcessorDimensions( iDim );
+            }
+
+            Matrix< DDRMat > tSliceCosts( aNumberOfElementsPerDimension( aDirection ), tNumberOfGroups, 0.0 );
+
+            uint tIJK[ 3 ] = { 0, 0, 0 };
+
+            for ( uint iElement = 0; iElement < aCosts.numel(); ++iElement )
+            {
+                // group from slabs of the other directions
+                uint tGroup  = 0;
+                uint tStride = 1;
+
+                for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+                {
+                    if ( iDim != aDirection )
+                    {
+                        tGroup += aSlabs( iDim )( tIJK[ iDim ] ) * tStride;
+                        tStride *= aProcessorDimensions( iDim );
+                    }
+                }
+
+                tSliceCosts( tIJK[ aDirection ], tGroup ) += aCosts( iElement );
+
+                // advance position, i running fastest
+                for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+                {
+                    if ( ++tIJK[ iDim ] < aNumberOfElementsPerDimension( iDim ) )
+                    {
+                        break;
+                    }
+
+                    tIJK[ iDim ] = 0;
+                }
+            }
+
+            return tSliceCosts;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // maximum cost over all slabs and groups
+        real
+        compute_max_slab_cost(
+                const Matrix< DDRMat >& aSliceCosts,
+                const Vector< uint >&   aSplits )
+        {
+            real tMaxCost    = 0.0;
+            uint tFirstSlice = 0;
+
+            for ( uint tWidth : aSplits )
+            {
+                for ( uint iGroup = 0; iGroup < aSliceCosts.n_cols(); ++iGroup )
+                {
+                    real tCost = 0.0;
+
+                    for ( uint iSlice = tFirstSlice; iSlice < tFirstSlice + tWidth; ++iSlice )
+                    {
+                        tCost += aSliceCosts( iSlice, iGroup );
+                    }
+
+                    tMaxCost = std::max( tMaxCost, tCost );
+                }
+
+                tFirstSlice += tWidth;
+            }
+
+            return tMaxCost;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // fills slabs greedily up to a maximum cost, the last slab takes the remaining slices
+        Vector< uint >
+        fill_slabs(
+                const Matrix< DDRMat >& aSliceCosts,
+                uint                    aNumberOfSlabs,
+                uint                    aMinimumWidth,
+                real                    aMaxCost )
+        {
+            uint tNumberOfSlices = aSliceCosts.n_rows();
+            uint tNumberOfGroups = aSliceCosts.n_cols();
+
+            Vector< uint > tSplits( aNumberOfSlabs, 0 );
+            Vector< real > tSlabCosts( tNumberOfGroups );
+
+            uint tFirstSlice = 0;
+
+            for ( uint iSlab = 0; iSlab + 1 < aNumberOfSlabs; ++iSlab )
+            {
+                // leave room for the minimum width of the remaining slabs
+                uint tMaxLastSlice = tNumberOfSlices - ( aNumberOfSlabs - iSlab - 1 ) * aMinimumWidth;
+
+                uint tLastSlice = tFirstSlice + aMinimumWidth;
+
+                for ( uint iGroup = 0; iGroup < tNumberOfGroups; ++iGroup )
+                {
+                    tSlabCosts( iGroup ) = 0.0;
+
+                    for ( uint iSlice = tFirstSlice; iSlice < tLastSlice; ++iSlice )
+                    {
+                        tSlabCosts( iGroup ) += aSliceCosts( iSlice, iGroup );
+                    }
+                }
+
+                // add slices while no group exceeds the maximum cost
+                while ( tLastSlice < tMaxLastSlice )
+                {
+                    bool tFits = true;
+
+                    for ( uint iGroup = 0; iGroup < tNumberOfGroups && tFits; ++iGroup )
+                    {
+                        tFits = tSlabCosts( iGroup ) + aSliceCosts( tLastSlice, iGroup ) <= aMaxCost;
+                    }
+
+                    if ( !tFits )
+                    {
+                        break;
+                    }
+
+                    for ( uint iGroup = 0; iGroup < tNumberOfGroups; ++iGroup )
+                    {
+                        tSlabCosts( iGroup ) += aSliceCosts( tLastSlice, iGroup );
+                    }
+
+                    ++tLastSlice;
+                }
+
+                tSplits( iSlab ) = tLastSlice - tFirstSlice;
+
+                tFirstSlice = tLastSlice;
+            }
+
+            tSplits( aNumberOfSlabs - 1 ) = tNumberOfSlices - tFirstSlice;
+
+            return tSplits;
+        }
+
+        //------------------------------------------------------------------------------
+
+        // splits of a direction that balance its cost summed over all other directions
+        Vector< uint >
+        balance_direction_marginal(
+                const Matrix< DDRMat >& aSliceCosts,
+                uint                    aNumberOfSlabs,
+                uint                    aMinimumWidth )
+        {
+            uint tNumberOfSlices = aSliceCosts.n_rows();
+
+            Vector< real > tCosts( tNumberOfSlices, 0.0 );
+
+            real tDirectionCost = 0.0;
+
+            for ( uint iSlice = 0; iSlice < tNumberOfSlices; ++iSlice )
+            {
+                for ( uint iGroup = 0; iGroup < aSliceCosts.n_cols(); ++iGroup )
+                {
+                    tCosts( iSlice ) += aSliceCosts( iSlice, iGroup );
+                }
+
+                tDirectionCost += tCosts( iSlice );
+            }
+
+            Vector< uint > tSplits( aNumberOfSlabs, 0 );
+
+            uint tFirstSlice = 0;
+            real tPrefixCost = 0.0;
+
+            for ( uint iSlab = 0; iSlab < aNumberOfSlabs; ++iSlab )
+            {
+                uint tLastSlice = tNumberOfSlices;
+
+                if ( iSlab + 1 < aNumberOfSlabs )
+                {
+                    real tTargetCost = tDirectionCost * ( iSlab + 1 ) / aNumberOfSlabs;
+
+                    // leave room for the minimum width of the remaining slabs
+                    uint tMaxLastSlice = tNumberOfSlices - ( aNumberOfSlabs - iSlab - 1 ) * aMinimumWidth;
+
+                    tLastSlice = tFirstSlice + aMinimumWidth;
+
+                    for ( uint iSlice = tFirstSlice; iSlice < tLastSlice; ++iSlice )
+                    {
+                        tPrefixCost += tCosts( iSlice );
+                    }
+
+                    // add slices while this brings the prefix cost closer to the target
+                    while ( tLastSlice < tMaxLastSlice
+                            && std::abs( tPrefixCost + tCosts( tLastSlice ) - tTargetCost ) < std::abs( tPrefixCost - tTargetCost ) )
+                    {
+                        tPrefixCost += tCosts( tLastSlice );
+                        ++tLastSlice;
+                    }
+                }
+
+                tSplits( iSlab ) = tLastSlice - tFirstSlice;
+
+                tFirstSlice = tLastSlice;
+            }
+
+            return tSplits;
+        }
+    }    // namespace
+
+    //------------------------------------------------------------------------------
+
+    Vector< uint >
+    balance_processor_splits(
+            const Matrix< DDRMat >& aCosts,
+            const Vector< uint >&   aNumberOfElementsPerDimension,
+            const Vector< uint >&   aProcessorDimensions,
+            uint                    aMinimumWidth )
+    {
+        uint tNumberOfDimensions = aNumberOfElementsPerDimension.size();
+
+        MORIS_ERROR( aProcessorDimensions.size() == tNumberOfDimensions,
+                "balance_processor_splits() - Processor grid has %u directions, mesh has %u.",
+                (uint)aProcessorDimensions.size(),
+                tNumberOfDimensions );
+
+        // offsets of directions in processor splits and minimum width of slabs per direction
+        Vector< uint > tSplitOffsets( tNumberOfDimensions + 1, 0 );
+        Vector< uint > tMinimumWidths( tNumberOfDimensions );
+
+        for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+        {
+            tSplitOffsets( iDim + 1 ) = tSplitOffsets( iDim ) + aProcessorDimensions( iDim );
+
+            tMinimumWidths( iDim ) = std::max( 1u, std::min( aMinimumWidth, aNumberOfElementsPerDimension( iDim ) / aProcessorDimensions( iDim ) ) );
+        }
+
+        // start with slabs that balance each direction separately
+        Vector< uint > tSplits = get_uniform_splits( aNumberOfElementsPerDimension, aProcessorDimensions );
+
+        Vector< Vector< uint > > tSlabs = get_slabs_of_positions( aProcessorDimensions, tSplits );
+
+        for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+        {
+            Matrix< DDRMat > tSliceCosts = compute_slice_costs( aCosts, aNumberOfElementsPerDimension, aProcessorDimensions, tSlabs, iDim );
+
+            Vector< uint > tDirectionSplits = balance_direction_marginal( tSliceCosts, aProcessorDimensions( iDim ), tMinimumWidths( iDim ) );
+
+            for ( uint iSlab = 0; iSlab < aProcessorDimensions( iDim ); ++iSlab )
+            {
+                tSplits( tSplitOffsets( iDim ) + iSlab ) = tDirectionSplits( iSlab );
+            }
+        }
+
+        // maximum cost of a processor
+        tSlabs = get_slabs_of_positions( aProcessorDimensions, tSplits );
+
+        real tMaxCost = compute_max_slab_cost(
+                compute_slice_costs( aCosts, aNumberOfElementsPerDimension, aProcessorDimensions, tSlabs, 0 ),
+                get_splits_of_direction( tSplits, aProcessorDimensions, 0 ) );
+
+        // rebalance one direction at a time for fixed slabs of all other directions
+        for ( uint iSweep = 0; iSweep < gMaxNumberOfSweeps; ++iSweep )
+        {
+            bool tImproved = false;
+
+            for ( uint iDim = 0; iDim < tNumberOfDimensions; ++iDim )
+            {
+                if ( aProcessorDimensions( iDim ) < 2 )
+                {
+                    continue;
+                }
+
+                tSlabs = get_slabs_of_positions( aProcessorDimensions, tSplits );
+
+                Matrix< DDRMat > tSliceCosts = compute_slice_costs( aCosts, aNumberOfElementsPerDimension, aProcessorDimensions, tSlabs, iDim );
+
+                // bisection for the smallest maximum cost that the slabs can be filled with
+                real tLowerBound = 0.0;
+                real tUpperBound = tMaxCost;
+
+                for ( uint iBisection = 0; iBisection < gNumberOfBisections; ++iBisection )
+                {
+                    real tBound = 0.5 * ( tLowerBound + tUpperBound );
+
+                    Vector< uint > tDirectionSplits = fill_slabs( tSliceCosts, aProcessorDimensions( iDim ), tMinimumWidths( iDim ), tBound );
+
+                    real tCost = compute_max_slab_cost( tSliceCosts, tDirectionSplits );
+
+                    if ( tCost <= tBound )
+                    {
+                        tUpperBound = tBound;
+
+                        if ( tCost < tMaxCost )
+                        {
+                            tMaxCost  = tCost;
+                            tImproved = true;
+
+                            for ( uint iSlab = 0; iSlab < aProcessorDimensions( iDim ); ++iSlab )
+                            {
+                                tSplits( tSplitOffsets( iDim ) + iSlab ) = tDirectionSplits( iSlab );
+                            }
+                        }
+                    }
+                    else
+                    {
+                        tLowerBound = tBound;
+                    }
+                }
+            }
+
+            if ( !tImproved )
+            {
+                break;
+            }
+        }
+
+        return tSplits;
+    }
+
+    //------------------------------------------------------------------------------
+
+    real
+    compute_load_imbalance(
+            const Matrix< DDRMat >& aCosts,
+            const Vector< uint >&   aNumberOfElementsPerDimension,
+            const Vector< uint >&   aProcessorDimensions,
+            const Vector< uint >&   aProcessorSplits )
+    {
+        Vector< uint > tSplits = aProcessorSplits.size() > 0 ? aProcessorSplits : get_uniform_splits( aNumberOfElementsPerDimension, aProcessorDimensions );
+
+        Vector< Vector< uint > > tSlabs = get_slabs_of_positions( aProcessorDimensions, tSplits );
+
+        // processors of all other directions are grouped, such that slabs of the first direction give all processors
+        real tMaxCost = compute_max_slab_cost(
+                compute_slice_costs( aCosts, aNumberOfElementsPerDimension, aProcessorDimensions, tSlabs, 0 ),
+                get_splits_of_direction( tSplits, aProcessorDimensions, 0 ) );
+
+        real tTotalCost = 0.0;
+
+        for ( uint iElement = 0; iElement < aCosts.numel(); ++iElement )
+        {
+            tTotalCost += aCosts( iElement );
+        }
+
+        uint tNumberOfProcessors = 1;
+
+        for ( uint tNumberOfSlabs : aProcessorDimensions )
+        {
+            tNumberOfProcessors *= tNumberOfSlabs;
+        }
+
+        return tTotalCost > 0.0 ? tMaxCost * tNumberOfProcessors / tTotalCost : 1.0;
+    }
+}    // namespace moris::hmr
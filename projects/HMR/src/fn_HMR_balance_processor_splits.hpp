@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * fn_HMR_balance_processor_splits.hpp
+ *
+ */
+
+#pragma once
+
+#include "moris_typedefs.hpp"    //COR/src
+#include "cl_Matrix.hpp"         //LINALG/src
+#include "cl_Vector.hpp"         //CNT/src
+
+namespace moris::hmr
+{
+    /**
+     * Computes the slabs of a Cartesian processor grid that minimize the maximum cost of a processor.
+     *
+     * Starting from slabs that balance the cost of each direction separately, the slabs of one direction
+     * are recomputed at a time for fixed slabs of the other directions, until the maximum cost does not
+     * decrease anymore. This also balances costs that are concentrated at a corner or an edge of the
+     * domain, as far as the rectilinear grid of processors and the size of the coarsest elements allow.
+     *
+     * @param[ in ] aCosts                          cost per coarsest element, i-position running fastest
+     * @param[ in ] aNumberOfElementsPerDimension   number of coarsest elements per direction
+     * @param[ in ] aProcessorDimensions            number of processors per direction
+     * @param[ in ] aMinimumWidth                   minimum number of coarsest elements per slab, e.g. size of aura
+     *
+     * @return number of coarsest elements per processor slab, concatenated over all directions
+     */
+    Vector< uint > balance_processor_splits(
+            const Matrix< DDRMat >& aCosts,
+            const Vector< uint >&   aNumberOfElementsPerDimension,
+            const Vector< uint >&   aProcessorDimensions,
+            uint                    aMinimumWidth );
+
+    /**
+     * Computes the maximum cost of a processor divided by the mean cost of all processors.
+     *
+     * @param[ in ] aCosts                          cost per coarsest element, i-position running fastest
+     * @param[ in ] aNumberOfElementsPerDimension   number of coarsest elements per direction
+     * @param[ in ] aProcessorDimensions            number of processors per direction
+     * @param[ in ] aProcessorSplits                number of coarsest elements per processor slab, uniform slabs if empty
+     *
+     * @return load imbalance, 1 if balanced
+     */
+    real compute_load_imbalance(
+            const Matrix< DDRMat >& aCosts,
+            const Vector< uint >&   aNumberOfElementsPerDimension,
+            const Vector< uint >&   aProcessorDimensions,
+            const Vector< uint >&   aProcessorSplits );
+}    // namespace moris::hmr
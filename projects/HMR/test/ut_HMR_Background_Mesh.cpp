@@ -22,6 +22,7 @@
 
 #include "cl_HMR.hpp" //HMR/src
 #include "cl_HMR_Database.hpp" //HMR/src
+#include "fn_HMR_balance_processor_splits.hpp" //HMR/src
 
 namespace moris::hmr
 {
@@ -901,6 +902,176 @@ namespace moris::hmr
         }
     }
 
+    TEST_CASE( "HMR_Background_Mesh_coarsen", "[moris],[mesh],[hmr],[Background_Mesh_coarsen],[Background_Mesh]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // create parameter object
+            Parameters tParameters;
+
+            tParameters.set_processor_decomp_method( 1 );
+
+            tParameters.set_number_of_elements_per_dimension( 2, 2 );
+            tParameters.set_severity_level( 0 );
+            tParameters.set_multigrid( false );
+            tParameters.set_bspline_truncation( true );
+
+            tParameters.set_lagrange_orders( { 1 } );
+            tParameters.set_lagrange_patterns( { 0 } );
+
+            tParameters.set_bspline_orders( { 1 } );
+            tParameters.set_bspline_patterns( { 0 } );
+
+            // create HMR object
+            HMR tHMR( tParameters );
+
+            Background_Mesh_Base* tBackgroundMesh = tHMR.get_database()->get_background_mesh();
+
+            // refine all elements twice
+            for ( uint Ii = 0; Ii < 2; Ii++ )
+            {
+                luint tNumActiveElements = tBackgroundMesh->get_number_of_active_elements_on_proc();
+
+                for ( luint Ik = 0; Ik < tNumActiveElements; Ik++ )
+                {
+                    tHMR.flag_element( Ik );
+                }
+                tHMR.perform_refinement( 0 );
+                tHMR.update_refinement_pattern( 0 );
+            }
+
+            REQUIRE( tBackgroundMesh->get_number_of_active_elements_on_proc() == 64 );
+
+            // flag only one of four siblings, their parent stays refined
+            tBackgroundMesh->get_element( 0 )->put_on_coarsening_queue();
+
+            REQUIRE( !tHMR.perform_coarsening( 0 ) );
+            REQUIRE( tBackgroundMesh->get_number_of_active_elements_on_proc() == 64 );
+
+            // coarsen one level per call
+            for ( luint tExpectedNumElements : { 16, 4 } )
+            {
+                luint tNumActiveElements = tBackgroundMesh->get_number_of_active_elements_on_proc();
+
+                for ( luint Ik = 0; Ik < tNumActiveElements; Ik++ )
+                {
+                    tBackgroundMesh->get_element( Ik )->put_on_coarsening_queue();
+                }
+
+                REQUIRE( tHMR.perform_coarsening( 0 ) );
+                REQUIRE( tBackgroundMesh->get_number_of_active_elements_on_proc() == tExpectedNumElements );
+            }
+
+            // coarsest elements can not be coarsened
+            tBackgroundMesh->get_element( 0 )->put_on_coarsening_queue();
+
+            REQUIRE( !tHMR.perform_coarsening( 0 ) );
+        }
+    }
+
+    TEST_CASE( "HMR_Background_Mesh_coarsen_staircase",
+            "[moris],[mesh],[hmr],[Background_Mesh_coarsen],[Background_Mesh]" )
+    {
+        if ( par_size() == 1 || par_size() == 2 )
+        {
+            // create parameter object
+            Parameters tParameters;
+
+            tParameters.set_processor_decomp_method( 1 );
+
+            tParameters.set_number_of_elements_per_dimension( 4, 4 );
+            tParameters.set_severity_level( 0 );
+            tParameters.set_multigrid( false );
+            tParameters.set_bspline_truncation( true );
+
+            // only the staircase buffer, which is restored when coarsening
+            tParameters.set_refinement_buffer( 0 );
+            tParameters.set_staircase_buffer( 1 );
+
+            tParameters.set_lagrange_orders( { 1 } );
+            tParameters.set_lagrange_patterns( { 0 } );
+
+            tParameters.set_bspline_orders( { 1 } );
+            tParameters.set_bspline_patterns( { 0 } );
+
+            // create HMR object
+            HMR tHMR( tParameters );
+
+            Background_Mesh_Base* tBackgroundMesh = tHMR.get_database()->get_background_mesh();
+
+            luint tNumberOfCoarsestElements = sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() );
+
+            // coarsest element at the corner of the domain
+            Background_Element_Base* tCorner = nullptr;
+
+            Matrix< DDLUMat > tProcOffset   = tBackgroundMesh->get_subdomain_offset_of_proc();
+            Matrix< DDLUMat > tSubdomainIJK = tBackgroundMesh->get_subdomain_ijk();
+
+            if ( tProcOffset( 0, 0 ) == 0 && tProcOffset( 1, 0 ) == 0 )
+            {
+                tCorner = tBackgroundMesh->get_coarsest_element_by_ij( tSubdomainIJK( 0, 0 ), tSubdomainIJK( 0, 1 ) );
+            }
+
+            // refine corner twice, staircase buffer refines its neighbors once
+            for ( uint tLevel = 0; tLevel < 2; ++tLevel )
+            {
+                if ( tCorner != nullptr )
+                {
+                    if ( tLevel == 0 )
+                    {
+                        tCorner->put_on_refinement_queue();
+                    }
+                    else
+                    {
+                        for ( uint iChild = 0; iChild < 4; ++iChild )
+                        {
+                            tCorner->get_child( iChild )->put_on_refinement_queue();
+                        }
+                    }
+                }
+
+                tBackgroundMesh->perform_refinement( 0 );
+            }
+
+            tHMR.update_refinement_pattern( 0 );
+
+            luint tNumberOfRefinedElements = sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() );
+
+            // 16 elements at the corner and the refined neighbors
+            REQUIRE( tNumberOfRefinedElements > tNumberOfCoarsestElements + 15 );
+
+            // flag children of the neighbors, which are refined again by the staircase buffer of the corner
+            luint tNumberOfActiveElements = tBackgroundMesh->get_number_of_active_elements_on_proc();
+
+            for ( luint iElement = 0; iElement < tNumberOfActiveElements; ++iElement )
+            {
+                if ( tBackgroundMesh->get_element( iElement )->get_level() == 1 )
+                {
+                    tBackgroundMesh->get_element( iElement )->put_on_coarsening_queue();
+                }
+            }
+
+            REQUIRE( !tHMR.perform_coarsening( 0 ) );
+            REQUIRE( sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() ) == tNumberOfRefinedElements );
+
+            // coarsen all elements, one level per call
+            for ( uint tLevel = 0; tLevel < 2; ++tLevel )
+            {
+                tNumberOfActiveElements = tBackgroundMesh->get_number_of_active_elements_on_proc();
+
+                for ( luint iElement = 0; iElement < tNumberOfActiveElements; ++iElement )
+                {
+                    tBackgroundMesh->get_element( iElement )->put_on_coarsening_queue();
+                }
+
+                REQUIRE( tHMR.perform_coarsening( 0 ) );
+                REQUIRE( sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() ) < tNumberOfRefinedElements );
+            }
+
+            REQUIRE( sum_all( tBackgroundMesh->get_number_of_active_elements_on_proc() ) == tNumberOfCoarsestElements );
+        }
+    }
+
     TEST_CASE( "HMR_Background_Mesh_refinement_buffer",
                "[moris],[mesh],[hmr],[Background_Mesh_refinement_buffer],[Background_Mesh]" )
     {
@@ -2537,4 +2708,213 @@ namespace moris::hmr
             }
         }
     }
+
+    //-------------------------------------------------------------------------------
+
+    TEST_CASE( "HMR_Background_Mesh_Processor_Splits",
+            "[moris],[mesh],[hmr],[Processor_Splits],[Background_Mesh]" )
+    {
+        if ( par_size() == 1 || par_size() == 2 )
+        {
+            // create settings object
+            auto tParameters = new Parameters;
+
+            // processor grid from MPI, split in x-direction only for 2 procs
+            tParameters->set_processor_decomp_method( 1 );
+
+            // set number of elements
+            tParameters->set_number_of_elements_per_dimension( 8, 2 );
+
+            // slabs of 3 and 5 coarsest elements in x-direction on 2 procs
+            if ( par_size() == 1 )
+            {
+                tParameters->set_processor_splits( { 8, 2 } );
+            }
+            else
+            {
+                tParameters->set_processor_splits( { 3, 5, 2 } );
+            }
+
+            // do not print debug information during test
+            tParameters->set_severity_level( 0 );
+
+            tParameters->set_refinement_buffer( 1 );
+            tParameters->set_staircase_buffer( 1 );
+
+            tParameters->set_lagrange_orders( { 1 } );
+            tParameters->set_lagrange_patterns( { 0 } );
+
+            // create factory
+            Factory tFactory( tParameters );
+
+            // create background mesh object
+            Background_Mesh_Base* tBackgroundMesh = tFactory.create_background_mesh();
+
+            luint tNumberOfElements = tBackgroundMesh->get_number_of_active_elements_on_proc();
+
+            // all coarsest elements are distributed
+            REQUIRE( sum_all( tNumberOfElements ) == 16 );
+
+            // larger slab holds 5 x 2 elements
+            REQUIRE( max_all( tNumberOfElements ) == ( par_size() == 1 ? 16 : 10 ) );
+
+            delete tBackgroundMesh;
+            delete tParameters;
+        }
+    }
+
+    TEST_CASE( "HMR_Balance_Processor_Splits",
+            "[moris],[mesh],[hmr],[Balance_Processor_Splits],[Background_Mesh]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // 16 x 16 coarsest elements, 3 x 3 elements at the corner are 30 times as expensive
+            Vector< uint > tNumberOfElementsPerDimension = { 16, 16 };
+            Vector< uint > tProcessorDimensions          = { 4, 4 };
+
+            Matrix< DDRMat > tCosts( 256, 1, 1.0 );
+
+            for ( uint j = 0; j < 3; ++j )
+            {
+                for ( uint i = 0; i < 3; ++i )
+                {
+                    tCosts( i + 16 * j ) = 30.0;
+                }
+            }
+
+            Vector< uint > tSplits = balance_processor_splits( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, 1 );
+
+            // corner is split between the first two slabs of both directions
+            Vector< uint > tExpectedSplits = { 1, 1, 6, 8, 1, 1, 6, 8 };
+
+            REQUIRE( tSplits.size() == tExpectedSplits.size() );
+
+            for ( uint iSplit = 0; iSplit < tSplits.size(); ++iSplit )
+            {
+                CHECK( tSplits( iSplit ) == tExpectedSplits( iSplit ) );
+            }
+
+            // most expensive proc holds 65 of 517, marginal balancing of each direction gives 120
+            CHECK( compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, tSplits ) == Approx( 65.0 * 16.0 / 517.0 ) );
+            CHECK( compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, { 1, 2, 5, 8, 1, 2, 5, 8 } ) == Approx( 120.0 * 16.0 / 517.0 ) );
+            CHECK( compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, {} ) == Approx( 278.0 * 16.0 / 517.0 ) );
+        }
+    }
+
+    TEST_CASE( "HMR_Balance_Processor_Splits_Refined_Mesh",
+            "[moris],[mesh],[hmr],[Balance_Processor_Splits],[Background_Mesh]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Parameters tParameters;
+
+            tParameters.set_number_of_elements_per_dimension( 16, 16 );
+            tParameters.set_domain_dimensions( 1, 1 );
+            tParameters.set_domain_offset( 0, 0 );
+
+            tParameters.set_lagrange_orders( { 1 } );
+            tParameters.set_lagrange_patterns( { 0 } );
+
+            tParameters.set_bspline_orders( { 1 } );
+            tParameters.set_bspline_patterns( { 0 } );
+
+            tParameters.set_staircase_buffer( 1 );
+            tParameters.set_refinement_buffer( 1 );
+
+            tParameters.set_severity_level( 0 );
+
+            HMR tHMR( tParameters );
+
+            auto tDatabase = tHMR.get_database();
+
+            Background_Mesh_Base* tBackgroundMesh = tDatabase->get_background_mesh();
+
+            luint tPaddingSize = tParameters.get_padding_size();
+
+            // refine the 3 x 3 coarsest elements at the corner twice
+            tDatabase->set_activation_pattern( 0 );
+
+            for ( uint tLevel = 0; tLevel < 2; ++tLevel )
+            {
+                for ( luint j = 0; j < 3; ++j )
+                {
+                    for ( luint i = 0; i < 3; ++i )
+                    {
+                        Background_Element_Base* tElement = tBackgroundMesh->get_coarsest_element_by_ij( i + tPaddingSize, j + tPaddingSize );
+
+                        // refine active descendants of the coarsest element
+                        Vector< Background_Element_Base* > tDescendants;
+                        luint                              tNumberOfDescendants = 0;
+
+                        tElement->get_number_of_descendants( tNumberOfDescendants );
+                        tDescendants.resize( tNumberOfDescendants, nullptr );
+
+                        tNumberOfDescendants = 0;
+                        tElement->collect_descendants( tDescendants, tNumberOfDescendants );
+
+                        for ( Background_Element_Base* tDescendant : tDescendants )
+                        {
+                            if ( tDescendant->is_active( 0 ) )
+                            {
+                                tDescendant->put_on_refinement_queue();
+                            }
+                        }
+                    }
+                }
+
+                tBackgroundMesh->perform_refinement( 0 );
+            }
+
+            tBackgroundMesh->update_database();
+
+            tDatabase->update_bspline_meshes();
+            tDatabase->update_lagrange_meshes();
+
+            Matrix< DDRMat > tCosts = tDatabase->compute_coarsest_element_costs( 0 );
+
+            // each element counts for its coarsest ancestor
+            REQUIRE( tCosts.numel() == 256 );
+
+            CHECK( tCosts( 0 ) == Approx( 16.0 ) );
+            CHECK( tCosts( 255 ) == Approx( 1.0 ) );
+
+            real tTotalCost = 0.0;
+
+            for ( uint iElement = 0; iElement < tCosts.numel(); ++iElement )
+            {
+                tTotalCost += tCosts( iElement );
+            }
+
+            CHECK( tTotalCost == Approx( tDatabase->get_lagrange_mesh_by_index( 0 )->get_number_of_elements() ) );
+
+            // balance for a grid of 4 x 4 procs
+            Vector< uint > tNumberOfElementsPerDimension = { 16, 16 };
+            Vector< uint > tProcessorDimensions          = { 4, 4 };
+
+            Vector< uint > tSplits = balance_processor_splits( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, tPaddingSize );
+
+            REQUIRE( tSplits.size() == 8 );
+
+            for ( uint iDim = 0; iDim < 2; ++iDim )
+            {
+                uint tNumberOfElements = 0;
+
+                for ( uint iSlab = 0; iSlab < 4; ++iSlab )
+                {
+                    CHECK( tSplits( 4 * iDim + iSlab ) >= 1 );
+
+                    tNumberOfElements += tSplits( 4 * iDim + iSlab );
+                }
+
+                CHECK( tNumberOfElements == 16 );
+            }
+
+            // refined corner is spread over more procs than with uniform slabs
+            real tImbalance        = compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, tSplits );
+            real tUniformImbalance = compute_load_imbalance( tCosts, tNumberOfElementsPerDimension, tProcessorDimensions, {} );
+
+            CHECK( tImbalance >= 1.0 );
+            CHECK( tImbalance < tUniformImbalance );
+        }
+    }
 }
@@ -18,6 +18,7 @@
 #include "cl_HMR_Field.hpp"
 #include "cl_HMR_Lagrange_Mesh_Base.hpp"    //HMR/src
 #include "cl_HMR_Parameters.hpp"            //HMR/src
+#include "cl_HMR_Restart_File.hpp"          //HMR/src
 
 #include "cl_Communication_Manager.hpp"    //COM/src
 #include "cl_Communication_Tools.hpp"      //COM/src
@@ -134,6 +135,184 @@ namespace moris::hmr
         }
     }
 
+    TEST_CASE( "HMR_IO_Restart", "[moris],[hmr],[HMR_IO_Restart]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // create settings object
+            Parameters tParameters;
+
+            tParameters.set_number_of_elements_per_dimension( 4, 4 );
+
+            tParameters.set_domain_dimensions( 1, 1 );
+            tParameters.set_domain_offset( -0.5, -0.5 );
+
+            tParameters.set_bspline_truncation( true );
+
+            tParameters.set_lagrange_orders( { 1 } );
+            tParameters.set_lagrange_patterns( { 2 } );
+
+            tParameters.set_bspline_orders( { 1, 1 } );
+            tParameters.set_bspline_patterns( { 0, 1 } );
+
+            tParameters.set_staircase_buffer( 3 );
+            tParameters.set_refinement_buffer( 3 );
+
+            tParameters.set_initial_refinement( { 1 } );
+
+            Vector< Vector< uint > > tLagrangeToBSplineMesh( 1 );
+            tLagrangeToBSplineMesh( 0 ) = { { 0, 1 } };
+
+            tParameters.set_lagrange_to_bspline_mesh( tLagrangeToBSplineMesh );
+
+            HMR tHMR( tParameters );
+
+            auto tDatabase = tHMR.get_database();
+
+            // refine pattern 0 once everywhere and pattern 1 three times at the first element
+            tDatabase->set_activation_pattern( 0 );
+
+            tHMR.perform_initial_refinement();
+
+            tDatabase->set_activation_pattern( 1 );
+
+            for ( uint tLevel = 0; tLevel < 3; ++tLevel )
+            {
+                tDatabase->get_background_mesh()->get_element( 0 )->put_on_refinement_queue();
+
+                tDatabase->get_background_mesh()->perform_refinement( 1 );
+            }
+
+            tDatabase->unite_patterns( 0, 1, 2 );
+
+            tDatabase->update_bspline_meshes();
+            tDatabase->update_lagrange_meshes();
+
+            // save refinement and dummy coefficients
+            Matrix< DDRMat > tCoefficients = { { 1.0 }, { 2.0 }, { 3.0 } };
+
+            Matrix< DDUMat > tPatterns = { { 0 }, { 1 }, { 2 } };
+
+            Restart_File tRestartFile;
+
+            tRestartFile.set_refinement_pattern( tDatabase->get_background_mesh(), tPatterns );
+            tRestartFile.add_field( "Coefficients", tCoefficients );
+            tRestartFile.save( "Mesh_Data_test.hmr" );
+
+            // restore refinement on unrefined mesh
+            HMR tHMR_Restart( tParameters );
+
+            auto tDatabaseRestart = tHMR_Restart.get_database();
+
+            tDatabaseRestart->load_pattern_from_restart_file( "Mesh_Data_test.hmr" );
+
+            for ( uint tPattern = 0; tPattern < 3; ++tPattern )
+            {
+                tDatabase->set_activation_pattern( tPattern );
+                tDatabaseRestart->set_activation_pattern( tPattern );
+
+                REQUIRE( tDatabaseRestart->get_number_of_elements_on_proc() == tDatabase->get_number_of_elements_on_proc() );
+            }
+
+            // read coefficients
+            Restart_File tRestartFileInput;
+            tRestartFileInput.load( "Mesh_Data_test.hmr" );
+
+            REQUIRE( tRestartFileInput.get_field( "Coefficients" ).numel() == 3 );
+            REQUIRE( tRestartFileInput.get_field( "Coefficients" )( 2 ) == 3.0 );
+        }
+    }
+
+    TEST_CASE( "HMR_IO_Restart_Decomposition", "[moris],[hmr],[HMR_IO_Restart_Decomposition]" )
+    {
+        if ( par_size() == 1 || par_size() == 2 )
+        {
+            // sets settings with the given number of coarsest elements per processor slab
+            auto tSetParameters = []( Parameters& aParameters, const Vector< uint >& aProcessorSplits ) {
+                // processor grid from MPI, split in x-direction only for 2 procs
+                aParameters.set_processor_decomp_method( 1 );
+
+                aParameters.set_number_of_elements_per_dimension( 8, 2 );
+                aParameters.set_domain_dimensions( 4, 1 );
+                aParameters.set_domain_offset( 0, 0 );
+
+                aParameters.set_processor_splits( aProcessorSplits );
+
+                aParameters.set_lagrange_orders( { 1 } );
+                aParameters.set_lagrange_patterns( { 0 } );
+
+                aParameters.set_bspline_orders( { 1 } );
+                aParameters.set_bspline_patterns( { 0 } );
+
+                aParameters.set_staircase_buffer( 1 );
+                aParameters.set_refinement_buffer( 1 );
+
+                aParameters.set_severity_level( 0 );
+            };
+
+            // write refinement with uniform slabs
+            Parameters tParameters;
+            tSetParameters( tParameters, {} );
+
+            HMR tHMR( tParameters );
+
+            auto tDatabase = tHMR.get_database();
+
+            // refine the elements at the corner of the first proc three times
+            for ( uint tLevel = 0; tLevel < 3; ++tLevel )
+            {
+                if ( par_rank() == 0 )
+                {
+                    tDatabase->get_background_mesh()->get_element( 0 )->put_on_refinement_queue();
+                }
+
+                tDatabase->get_background_mesh()->perform_refinement( 0 );
+            }
+
+            tDatabase->get_background_mesh()->update_database();
+
+            Restart_File tRestartFile;
+
+            Matrix< DDUMat > tPatterns = { { 0 } };
+
+            // slabs for a restart on the same number of procs
+            Vector< uint > tProcessorSplits = par_size() == 1 ? Vector< uint >{ 8, 2 } : Vector< uint >{ 3, 5, 2 };
+
+            tRestartFile.set_refinement_pattern( tDatabase->get_background_mesh(), tPatterns );
+            tRestartFile.set_processor_splits( tProcessorSplits );
+            tRestartFile.save( "Mesh_Data_Decomposition_test.hmr" );
+
+            barrier();
+
+            Vector< uint > tStoredSplits = Restart_File::read_processor_splits( "Mesh_Data_Decomposition_test.hmr" );
+
+            REQUIRE( tStoredSplits.size() == tProcessorSplits.size() );
+
+            for ( uint iSplit = 0; iSplit < tStoredSplits.size(); ++iSplit )
+            {
+                CHECK( tStoredSplits( iSplit ) == tProcessorSplits( iSplit ) );
+            }
+
+            // restore refinement with different slabs
+            Parameters tParametersRestart;
+            tSetParameters( tParametersRestart, par_size() == 1 ? Vector< uint >{ 8, 2 } : Vector< uint >{ 2, 6, 2 } );
+
+            HMR tHMR_Restart( tParametersRestart );
+
+            auto tDatabaseRestart = tHMR_Restart.get_database();
+
+            tDatabaseRestart->load_pattern_from_restart_file( "Mesh_Data_Decomposition_test.hmr" );
+
+            tDatabase->set_activation_pattern( 0 );
+            tDatabaseRestart->set_activation_pattern( 0 );
+
+            // same mesh, distributed differently
+            REQUIRE( sum_all( tDatabaseRestart->get_number_of_elements_on_proc() ) == sum_all( tDatabase->get_number_of_elements_on_proc() ) );
+
+            REQUIRE( max_all( tDatabaseRestart->get_background_mesh()->get_max_level() ) == 3 );
+        }
+    }
+
     TEST_CASE( "HMR_Field_IO_EXO", "[moris],[hmr],[HMR_Field_IO_Exo]" )
     {
         if ( par_size() == 1 )
@@ -16,9 +16,14 @@
 #include "cl_HMR_Factory.hpp"                 //HMR/src
 #include "cl_HMR_Lagrange_Mesh_Base.hpp"      //HMR/src
 #include "cl_HMR_Parameters.hpp"              //HMR/src
+#include "cl_HMR.hpp"                         //HMR/src
+#include "cl_HMR_Database.hpp"                //HMR/src
 
 #include "cl_Communication_Manager.hpp"    //COM/src
 #include "cl_Communication_Tools.hpp"      //COM/src
+#include "cl_Stopwatch.hpp"                //CHR/src
+#include "cl_Logger.hpp"                   //MRS/IOS/src
+#include "moris_openmp.hpp"                //COR/src
 
 #include "paths.hpp"
 #include "HDF5_Tools.hpp"
@@ -188,6 +193,24 @@ namespace moris::hmr
                         load_matrix_from_hdf5_file( tFileID, tLabel, tTMatrixExpected, tStatus );
                         CHECK_EQUAL( tTMatrixCalculated, tTMatrixExpected, );
 
+                        // T-matrix with refinement products computed into and then looked up from cache
+                        T_Matrix_Cache tCache;
+                        tTMatrix->set_cache( &tCache );
+
+                        for ( uint iEvaluation = 0; iEvaluation < 2; iEvaluation++ )
+                        {
+                            tTMatrix->calculate_t_matrix( tBSplineMesh->get_element( 0 )->get_memory_index(),
+                                    tTMatrixCalculated,
+                                    tBasis );
+
+                            CHECK_EQUAL( tTMatrixCalculated, tTMatrixExpected, );
+                        }
+
+                        // one product per level of non-truncated T-matrix, none for truncated T-matrix
+                        CHECK( tCache.get_number_of_products() == ( iTruncation ? 0 : tBSplineMesh->get_element( 0 )->get_level() ) );
+
+                        tTMatrix->set_cache( nullptr );
+
                         // tidy up memory
                         delete tTMatrix;
                         delete tBSplineMesh;
@@ -204,4 +227,124 @@ namespace moris::hmr
             delete tParameters;
         }
     }
+
+    // -----------------------------------------------------------------------------------------------------------------
+
+    TEST_CASE( "HMR T-matrix thread scaling", "[moris],[mesh],[hmr],[hmr_t_matrix_scaling]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // truncated B-splines are computed directly, products of child matrices are only cached without truncation
+            for ( bool tTruncate : { true, false } )
+            {
+                // cubic B-splines and Lagrange elements in 3D on a locally refined mesh
+                Parameters tParameters;
+
+                tParameters.set_number_of_elements_per_dimension( 4, 4, 4 );
+                tParameters.set_domain_dimensions( 4.0, 4.0, 4.0 );
+                tParameters.set_domain_offset( -2.0, -2.0, -2.0 );
+                tParameters.set_bspline_truncation( tTruncate );
+
+                tParameters.set_lagrange_orders( { 3 } );
+                tParameters.set_lagrange_patterns( { 0 } );
+
+                tParameters.set_bspline_orders( { 3 } );
+                tParameters.set_bspline_patterns( { 0 } );
+
+                tParameters.set_refinement_buffer( 1 );
+                tParameters.set_staircase_buffer( 1 );
+
+                HMR tHMR( tParameters );
+
+                auto tDatabase = tHMR.get_database();
+
+                // refine the first element twice
+                for ( uint iLevel = 0; iLevel < 2; ++iLevel )
+                {
+                    tDatabase->flag_element( 0 );
+
+                    tDatabase->perform_refinement( 0, false );
+                }
+
+                tDatabase->perform_refinement( 0, false );
+
+                tHMR.finalize();
+
+                Lagrange_Mesh_Base* tLagrangeMesh = tDatabase->get_lagrange_mesh_by_index( 0 );
+
+                T_Matrix_Cache& tCache = tDatabase->get_t_matrix_cache();
+
+                luint tNumberOfNodes = tLagrangeMesh->get_number_of_nodes_on_proc();
+
+                // weights computed with one thread
+                Vector< Matrix< DDRMat > > tReferenceWeights( tNumberOfNodes );
+
+                int tMaxThreads = omp_max_threads();
+
+                for ( int iNumThreads = 1; iNumThreads <= tMaxThreads; iNumThreads *= 2 )
+                {
+                    omp_set_max_threads( iNumThreads );
+
+                    // fill the cache concurrently with the given number of threads
+                    tCache.clear();
+
+                    tic tTimer;
+
+                    tLagrangeMesh->calculate_t_matrices();
+
+                    real tTime = tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+                    MORIS_LOG_INFO( "T-matrices of %lu nodes with %d threads, truncation %d: %f s, %lu cached products",
+                            (long unsigned int)tNumberOfNodes,
+                            iNumThreads,
+                            (int)tTruncate,
+                            tTime,
+                            (long unsigned int)tCache.get_number_of_products() );
+
+                    // the untruncated T-matrices of the refined elements use the cache
+                    if ( !tTruncate )
+                    {
+                        CHECK( tCache.get_number_of_products() > 0 );
+                    }
+
+                    // result does not depend on number of threads
+                    for ( luint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+                    {
+                        const Matrix< DDRMat >& tWeights = *tLagrangeMesh->get_basis_by_memory_index( iNode )->get_interpolation( 0 )->get_weights();
+
+                        if ( iNumThreads == 1 )
+                        {
+                            tReferenceWeights( iNode ) = tWeights;
+                        }
+                        else
+                        {
+                            REQUIRE( tWeights.numel() == tReferenceWeights( iNode ).numel() );
+
+                            for ( uint iWeight = 0; iWeight < tWeights.numel(); iWeight++ )
+                            {
+                                CHECK( tWeights( iWeight ) == tReferenceWeights( iNode )( iWeight ) );
+                            }
+                        }
+                    }
+                }
+
+                // a second computation with a filled cache gives the same result
+                tLagrangeMesh->calculate_t_matrices();
+
+                for ( luint iNode = 0; iNode < tNumberOfNodes; iNode++ )
+                {
+                    const Matrix< DDRMat >& tWeights = *tLagrangeMesh->get_basis_by_memory_index( iNode )->get_interpolation( 0 )->get_weights();
+
+                    REQUIRE( tWeights.numel() == tReferenceWeights( iNode ).numel() );
+
+                    for ( uint iWeight = 0; iWeight < tWeights.numel(); iWeight++ )
+                    {
+                        CHECK( tWeights( iWeight ) == tReferenceWeights( iNode )( iWeight ) );
+                    }
+                }
+
+                omp_set_max_threads( tMaxThreads );
+            }
+        }
+    }
 }    // namespace moris::hmr
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * moris_openmp.hpp
+ *
+ */
+
+#ifndef MORIS_OPENMP_HPP_
+#define MORIS_OPENMP_HPP_
+
+#ifdef MORIS_USE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * @brief OpenMP pragma that is only emitted if moris is built with MORIS_USE_OPENMP.
+ * Without OpenMP the pragma is dropped such that -Wunknown-pragmas does not trigger.
+ *
+ * usage: MORIS_OMP_PRAGMA( omp parallel for schedule( dynamic ) )
+ */
+#define MORIS_OMP_STRINGIFY( ... ) #__VA_ARGS__
+
+#ifdef MORIS_USE_OPENMP
+#define MORIS_OMP_PRAGMA( ... ) _Pragma( MORIS_OMP_STRINGIFY( __VA_ARGS__ ) )
+#else
+#define MORIS_OMP_PRAGMA( ... )
+#endif
+
+namespace moris
+{
+    //------------------------------------------------------------------------------
+
+    /**
+     * @brief returns the maximum number of threads available to a parallel region
+     */
+    inline int
+    omp_max_threads()
+    {
+#ifdef MORIS_USE_OPENMP
+        return omp_get_max_threads();
+#else
+        return 1;
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * @brief sets the number of threads used by subsequent parallel regions
+     */
+    inline void
+    omp_set_max_threads( int aNumThreads )
+    {
+#ifdef MORIS_USE_OPENMP
+        omp_set_num_threads( aNumThreads );
+#else
+        (void)aNumThreads;
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * @brief returns the index of the calling thread within the current team
+     */
+    inline int
+    omp_thread_index()
+    {
+#ifdef MORIS_USE_OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    }
+
+    //------------------------------------------------------------------------------
+
+}    // namespace moris
+
+#endif /* MORIS_OPENMP_HPP_ */
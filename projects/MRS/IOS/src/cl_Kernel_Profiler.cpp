@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Kernel_Profiler.cpp
+ *
+ */
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <vector>
+
+#include <boost/core/demangle.hpp>
+
+#include "cl_Kernel_Profiler.hpp"
+#include "cl_Logger.hpp"
+#include "cl_Json_Object.hpp"
+#include "cl_Communication_Tools.hpp"    // COM/src
+
+namespace moris
+{
+    //------------------------------------------------------------------------------
+
+    // reports of all previous calls to Kernel_Profiler::report()
+    static Json gKernelProfilerReports;
+
+    //------------------------------------------------------------------------------
+
+    void
+    Kernel_Profiler::report(
+            const std::string& aLabel,
+            const std::string& aFileName )
+    {
+        // merge records by name, a kernel name literal may have different addresses in different translation units
+        std::map< std::string, Kernel_Record > tLocalRecords;
+
+        for ( const auto& iRecord : mRecords )
+        {
+            std::string tKey = std::string( iRecord.first.first ) + '\n' + boost::core::demangle( iRecord.first.second.name() ) + '\n';
+
+            tLocalRecords[ tKey ].mCalls += iRecord.second.mCalls;
+            tLocalRecords[ tKey ].mTime += iRecord.second.mTime;
+            tLocalRecords[ tKey ].mExclusiveTime += iRecord.second.mExclusiveTime;
+        }
+
+        mRecords.clear();
+
+        // concatenate the local keys
+        std::string tLocalKeys;
+        for ( const auto& iRecord : tLocalRecords )
+        {
+            tLocalKeys += iRecord.first;
+        }
+
+        // gather the keys of all processors
+        int tProcSize = par_size();
+        int tLength   = tLocalKeys.size();
+
+        std::vector< int > tLengths( tProcSize );
+        MPI_Allgather( &tLength, 1, MPI_INT, tLengths.data(), 1, MPI_INT, get_comm() );
+
+        std::vector< int > tOffsets( tProcSize, 0 );
+        std::partial_sum( tLengths.begin(), tLengths.end() - 1, tOffsets.begin() + 1 );
+
+        std::string tAllKeys( tOffsets.back() + tLengths.back(), '\n' );
+        MPI_Allgatherv( tLocalKeys.data(), tLength, MPI_CHAR, tAllKeys.data(), tLengths.data(), tOffsets.data(), MPI_CHAR, get_comm() );
+
+        // build the sorted union of keys, which is the same on all processors
+        std::map< std::string, uint > tGlobalKeys;
+
+        size_t tPosition = 0;
+        while ( tPosition < tAllKeys.size() )
+        {
+            // a key consists of the kernel name and the type, each terminated by a new line
+            size_t tEnd = tAllKeys.find( '\n', tAllKeys.find( '\n', tPosition ) + 1 ) + 1;
+
+            tGlobalKeys.emplace( tAllKeys.substr( tPosition, tEnd - tPosition ), 0 );
+
+            tPosition = tEnd;
+        }
+
+        uint tNumKernels = 0;
+        for ( auto& iKey : tGlobalKeys )
+        {
+            iKey.second = tNumKernels++;
+        }
+
+        // fill local values in global order
+        std::vector< luint > tCalls( tNumKernels, 0 );
+        std::vector< real >  tTimes( tNumKernels, 0.0 );
+        std::vector< real >  tExclusiveTimes( tNumKernels, 0.0 );
+
+        for ( const auto& iRecord : tLocalRecords )
+        {
+            uint tIndex               = tGlobalKeys.at( iRecord.first );
+            tCalls[ tIndex ]          = iRecord.second.mCalls;
+            tTimes[ tIndex ]          = iRecord.second.mTime;
+            tExclusiveTimes[ tIndex ] = iRecord.second.mExclusiveTime;
+        }
+
+        // reduce on the output processor
+        std::vector< luint > tTotalCalls( tNumKernels, 0 );
+        std::vector< real >  tTotalTimes( tNumKernels, 0.0 );
+        std::vector< real >  tMaxTimes( tNumKernels, 0.0 );
+        std::vector< real >  tTotalExclusiveTimes( tNumKernels, 0.0 );
+
+        MPI_Reduce( tCalls.data(), tTotalCalls.data(), tNumKernels, get_comm_datatype( (luint)0 ), MPI_SUM, 0, get_comm() );
+        MPI_Reduce( tTimes.data(), tTotalTimes.data(), tNumKernels, get_comm_datatype( (real)0 ), MPI_SUM, 0, get_comm() );
+        MPI_Reduce( tTimes.data(), tMaxTimes.data(), tNumKernels, get_comm_datatype( (real)0 ), MPI_MAX, 0, get_comm() );
+        MPI_Reduce( tExclusiveTimes.data(), tTotalExclusiveTimes.data(), tNumKernels, get_comm_datatype( (real)0 ), MPI_SUM, 0, get_comm() );
+
+        if ( par_rank() != 0 )
+        {
+            return;
+        }
+
+        // sort kernels by exclusive time
+        std::vector< std::string > tKeys;
+        tKeys.reserve( tNumKernels );
+        for ( const auto& iKey : tGlobalKeys )
+        {
+            tKeys.push_back( iKey.first );
+        }
+
+        std::vector< uint > tOrder( tNumKernels );
+        std::iota( tOrder.begin(), tOrder.end(), 0 );
+        std::sort( tOrder.begin(), tOrder.end(), [ &tTotalExclusiveTimes ]( uint aA, uint aB ) { return tTotalExclusiveTimes[ aA ] > tTotalExclusiveTimes[ aB ]; } );
+
+        // nested kernels are contained in the inclusive time of their callers, only exclusive times add up
+        real tSumTime = std::accumulate( tTotalExclusiveTimes.begin(), tTotalExclusiveTimes.end(), 0.0 );
+
+        // log summary table
+        MORIS_LOG_INFO( "Kernel profile of %s on %d processors:", aLabel.c_str(), tProcSize );
+        MORIS_LOG_INFO( "%-28s %-48s %14s %14s %14s %14s %8s", "Kernel", "Type", "Calls", "Time [s]", "Max. time [s]", "Excl. time [s]", "Share" );
+
+        Json tKernels;
+        for ( uint iKernel : tOrder )
+        {
+            size_t      tSeparator = tKeys[ iKernel ].find( '\n' );
+            std::string tKernel    = tKeys[ iKernel ].substr( 0, tSeparator );
+            std::string tType      = tKeys[ iKernel ].substr( tSeparator + 1, tKeys[ iKernel ].size() - tSeparator - 2 );
+
+            MORIS_LOG_INFO( "%-28s %-48s %14lu %14.4e %14.4e %14.4e %7.2f%%",
+                    tKernel.c_str(),
+                    tType.c_str(),
+                    tTotalCalls[ iKernel ],
+                    tTotalTimes[ iKernel ],
+                    tMaxTimes[ iKernel ],
+                    tTotalExclusiveTimes[ iKernel ],
+                    tSumTime > 0.0 ? 100.0 * tTotalExclusiveTimes[ iKernel ] / tSumTime : 0.0 );
+
+            Json tEntry;
+            tEntry.put( "kernel", tKernel );
+            tEntry.put( "type", tType );
+            tEntry.put( "calls", tTotalCalls[ iKernel ] );
+            tEntry.put( "time", tTotalTimes[ iKernel ] );
+            tEntry.put( "max_time", tMaxTimes[ iKernel ] );
+            tEntry.put( "exclusive_time", tTotalExclusiveTimes[ iKernel ] );
+            tKernels.push_back( { "", tEntry } );
+        }
+
+        // append to previous reports and write all of them
+        Json tReport;
+        tReport.put( "label", aLabel );
+        tReport.put( "processors", tProcSize );
+        tReport.add_child( "kernels", tKernels );
+
+        gKernelProfilerReports.push_back( { "", tReport } );
+
+        Json tRoot;
+        tRoot.add_child( "reports", gKernelProfilerReports );
+
+        write_json( aFileName, tRoot );
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace moris
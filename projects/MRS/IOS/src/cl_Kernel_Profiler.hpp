@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Kernel_Profiler.hpp
+ *
+ */
+
+#ifndef MORIS_IOS_CL_KERNEL_PROFILER_HPP_
+#define MORIS_IOS_CL_KERNEL_PROFILER_HPP_
+
+#include <chrono>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "moris_typedefs.hpp"    // COR/src
+
+/*
+ * Kernel profiling is switched on at compile time with MORIS_USE_KERNEL_PROFILING. Otherwise
+ * MORIS_PROFILE_KERNEL expands to nothing and the hot paths are left untouched.
+ *
+ * Usage:
+ *
+ *    {
+ *        MORIS_PROFILE_KERNEL( "IWG::compute_residual", *tIWG );
+ *
+ *        tIWG->compute_residual( tWStar );
+ *    }
+ *
+ *    // at the end of a solve, on all processors
+ *    Kernel_Profiler::report( "Forward Analysis" );
+ */
+#ifdef MORIS_USE_KERNEL_PROFILING
+#define MORIS_PROFILE_KERNEL( aKernel, aObject ) moris::Kernel_Timer tKernelTimer( aKernel, typeid( aObject ) )
+#else
+#define MORIS_PROFILE_KERNEL( aKernel, aObject )
+#endif
+
+namespace moris
+{
+    //------------------------------------------------------------------------------
+
+    /**
+     * Calls and accumulated wall time of one kernel of one concrete type. The inclusive time contains the
+     * time of profiled kernels called from within the kernel, the exclusive time does not.
+     */
+    struct Kernel_Record
+    {
+        luint mCalls         = 0;
+        real  mTime          = 0.0;
+        real  mExclusiveTime = 0.0;
+    };
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * Registry of kernel timings on this processor. Kernels are identified by a name, which has to be
+     * a string literal, and the concrete type of the object they are evaluated on. The registry is not
+     * thread safe.
+     */
+    class Kernel_Profiler
+    {
+        //-------------------------------- PRIVATE --------------------------------//
+
+      private:
+        // key: kernel name and concrete type
+        using Key = std::pair< const char*, std::type_index >;
+
+        struct Key_Hash
+        {
+            size_t
+            operator()( const Key& aKey ) const
+            {
+                return std::hash< const void* >()( aKey.first ) ^ ( aKey.second.hash_code() << 1 );
+            }
+        };
+
+        inline static std::unordered_map< Key, Kernel_Record, Key_Hash > mRecords;
+
+        //-------------------------------- PUBLIC ---------------------------------//
+
+      public:
+        /**
+         * Adds one call of a kernel
+         *
+         * @param aKernel Kernel name, string literal
+         * @param aType Concrete type of the evaluated object
+         * @param aTime Wall time of the call in seconds
+         * @param aExclusiveTime Wall time of the call without nested kernels in seconds
+         */
+        static void
+        add(
+                const char*           aKernel,
+                const std::type_info& aType,
+                real                  aTime,
+                real                  aExclusiveTime )
+        {
+            Kernel_Record& tRecord = mRecords[ Key( aKernel, std::type_index( aType ) ) ];
+
+            tRecord.mCalls++;
+            tRecord.mTime += aTime;
+            tRecord.mExclusiveTime += aExclusiveTime;
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Removes all records on this processor
+         */
+        static void
+        reset()
+        {
+            mRecords.clear();
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * Reduces the records over all processors, logs a summary table and appends the records to a JSON file.
+         * Kernels are sorted by exclusive time, whose shares add up to the total profiled time.
+         * The records are reset afterwards. Has to be called on all processors.
+         *
+         * @param aLabel Label of the profiled section, e.g. the solve
+         * @param aFileName JSON file, rewritten with all reports so far
+         */
+        static void
+        report(
+                const std::string& aLabel,
+                const std::string& aFileName = "kernel_profile.json" );
+    };
+
+    //------------------------------------------------------------------------------
+
+    /**
+     * Times a kernel call from construction to destruction. Timers nest, e.g. constitutive models
+     * evaluated inside an IWG residual; the time of nested timers is subtracted from the exclusive time
+     * of the enclosing one.
+     */
+    class Kernel_Timer
+    {
+      private:
+        const char*                                          mKernel;
+        const std::type_info&                                mType;
+        std::chrono::time_point< std::chrono::steady_clock > mStart;
+
+        // enclosing timer on this thread and time spent in nested timers
+        Kernel_Timer* mParent;
+        real          mNestedTime = 0.0;
+
+        // innermost running timer on this thread
+        inline static thread_local Kernel_Timer* mActiveTimer = nullptr;
+
+      public:
+        Kernel_Timer(
+                const char*           aKernel,
+                const std::type_info& aType )
+                : mKernel( aKernel )
+                , mType( aType )
+                , mStart( std::chrono::steady_clock::now() )
+                , mParent( mActiveTimer )
+        {
+            mActiveTimer = this;
+        }
+
+        ~Kernel_Timer()
+        {
+            real tTime = std::chrono::duration< real >( std::chrono::steady_clock::now() - mStart ).count();
+
+            Kernel_Profiler::add( mKernel, mType, tTime, tTime - mNestedTime );
+
+            if ( mParent != nullptr )
+            {
+                mParent->mNestedTime += tTime;
+            }
+
+            mActiveTimer = mParent;
+        }
+    };
+
+    //------------------------------------------------------------------------------
+}    // namespace moris
+
+#endif /* MORIS_IOS_CL_KERNEL_PROFILER_HPP_ */
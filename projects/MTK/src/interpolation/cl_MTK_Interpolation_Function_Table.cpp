@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MTK_Interpolation_Function_Table.cpp
+ *
+ */
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "cl_MTK_Interpolation_Function_Table.hpp"    //MTK/src
+
+namespace moris::mtk
+{
+    //------------------------------------------------------------------------------
+
+    Interpolation_Function_Table::Interpolation_Function_Table(
+            const Interpolation_Function_Base* aInterpolationFunction,
+            const Matrix< DDRMat >&            aPoints )
+            : mPoints( aPoints )
+    {
+        MORIS_ASSERT( aPoints.n_rows() == aInterpolationFunction->get_number_of_param_dimensions(),
+                "Interpolation_Function_Table - points have %zu rows but interpolation function has %u param dimensions.",
+                aPoints.n_rows(),
+                aInterpolationFunction->get_number_of_param_dimensions() );
+
+        uint tNumPoints = aPoints.n_cols();
+
+        mN.resize( tNumPoints );
+        mdNdXi.resize( tNumPoints );
+        md2NdXi2.resize( tNumPoints );
+
+        // evaluate shape functions and derivatives at all points
+        for ( uint iPoint = 0; iPoint < tNumPoints; iPoint++ )
+        {
+            const Matrix< DDRMat > tXi = aPoints.get_column( iPoint );
+
+            aInterpolationFunction->eval_N( tXi, mN( iPoint ) );
+            aInterpolationFunction->eval_dNdXi( tXi, mdNdXi( iPoint ) );
+            aInterpolationFunction->eval_d2NdXi2( tXi, md2NdXi2( iPoint ) );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    const Interpolation_Function_Table*
+    Interpolation_Function_Table::get_table(
+            Geometry_Type                      aGeometryType,
+            const Interpolation_Function_Base* aInterpolationFunction,
+            const Matrix< DDRMat >&            aPoints )
+    {
+        // key: interpolation function and tabulated point coordinates
+        using Table_Key = std::tuple< Geometry_Type, Interpolation_Type, Interpolation_Order, uint, std::vector< real > >;
+
+        static std::map< Table_Key, std::unique_ptr< Interpolation_Function_Table > > sTables;
+        static std::mutex                                                                sTablesMutex;
+
+        std::vector< real > tCoordinates;
+        tCoordinates.reserve( aPoints.numel() );
+
+        for ( uint iPoint = 0; iPoint < aPoints.n_cols(); iPoint++ )
+        {
+            for ( uint iDim = 0; iDim < aPoints.n_rows(); iDim++ )
+            {
+                tCoordinates.push_back( aPoints( iDim, iPoint ) );
+            }
+        }
+
+        Table_Key tKey(
+                aGeometryType,
+                aInterpolationFunction->get_interpolation_type(),
+                aInterpolationFunction->get_interpolation_order(),
+                aPoints.n_rows(),
+                std::move( tCoordinates ) );
+
+        std::lock_guard< std::mutex > tLock( sTablesMutex );
+
+        std::unique_ptr< Interpolation_Function_Table >& tTable = sTables[ tKey ];
+
+        // build table on first request
+        if ( tTable == nullptr )
+        {
+            tTable = std::make_unique< Interpolation_Function_Table >( aInterpolationFunction, aPoints );
+        }
+
+        return tTable.get();
+    }
+
+    //------------------------------------------------------------------------------
+
+    sint
+    Interpolation_Function_Table::find_point(
+            const Matrix< DDRMat >& aXi,
+            uint                    aFirstGuess ) const
+    {
+        uint tNumPoints = mPoints.n_cols();
+
+        // check guess first, integration points are usually visited in order
+        if ( aFirstGuess < tNumPoints && this->is_point( aXi, aFirstGuess ) )
+        {
+            return aFirstGuess;
+        }
+
+        // search all other points
+        for ( uint iPoint = 0; iPoint < tNumPoints; iPoint++ )
+        {
+            if ( iPoint != aFirstGuess && this->is_point( aXi, iPoint ) )
+            {
+                return iPoint;
+            }
+        }
+
+        return -1;
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool
+    Interpolation_Function_Table::is_point(
+            const Matrix< DDRMat >& aXi,
+            uint                    aPointIndex ) const
+    {
+        for ( uint iDim = 0; iDim < mPoints.n_rows(); iDim++ )
+        {
+            if ( std::abs( aXi( iDim ) - mPoints( iDim, aPointIndex ) ) > Interpolation_Function_Table_Epsilon )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+}    // namespace moris::mtk
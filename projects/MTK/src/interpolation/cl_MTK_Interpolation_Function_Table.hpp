@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_MTK_Interpolation_Function_Table.hpp
+ *
+ */
+
+#ifndef SRC_MTK_CL_MTK_INTERPOLATION_FUNCTION_TABLE_HPP_
+#define SRC_MTK_CL_MTK_INTERPOLATION_FUNCTION_TABLE_HPP_
+
+#include "moris_typedefs.hpp"                        //MRS/COR/src
+#include "cl_Vector.hpp"                             //MRS/CNT/src
+#include "cl_Matrix.hpp"                             //LINALG/src
+#include "linalg_typedefs.hpp"                       //LINALG/src
+#include "cl_MTK_Enums.hpp"                          //MTK/src
+#include "cl_MTK_Interpolation_Function_Base.hpp"    //MTK/src
+
+// tolerance for matching an evaluation point with a tabulated point
+#define Interpolation_Function_Table_Epsilon 1e-12
+
+namespace moris::mtk
+{
+    //------------------------------------------------------------------------------
+    /**
+     * \brief shape functions and their first and second parametric derivatives
+     * tabulated at a fixed set of parametric points, e.g. the points of an integration rule
+     *
+     * Tables are immutable once built and shared between all interpolators using the same
+     * interpolation function and points. They are obtained through get_table(), which builds
+     * a table on first request and returns the stored one afterwards.
+     */
+    class Interpolation_Function_Table
+    {
+        // tabulated points, ( <number of param dimensions> x <number of points> )
+        Matrix< DDRMat > mPoints;
+
+        // shape functions and derivatives per point
+        Vector< Matrix< DDRMat > > mN;
+        Vector< Matrix< DDRMat > > mdNdXi;
+        Vector< Matrix< DDRMat > > md2NdXi2;
+
+      public:
+        //------------------------------------------------------------------------------
+        /**
+         * constructor, evaluates the interpolation function at all points
+         *
+         * @param[ in ] aInterpolationFunction interpolation function to tabulate
+         * @param[ in ] aPoints                parametric points
+         *                                     ( <number of param dimensions> x <number of points> )
+         */
+        Interpolation_Function_Table(
+                const Interpolation_Function_Base* aInterpolationFunction,
+                const Matrix< DDRMat >&            aPoints );
+
+        //------------------------------------------------------------------------------
+
+        ~Interpolation_Function_Table() = default;
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the table for an interpolation function and a set of points,
+         * the table is built on first request
+         *
+         * @param[ in ] aGeometryType          geometry type of the interpolation function
+         * @param[ in ] aInterpolationFunction interpolation function to tabulate
+         * @param[ in ] aPoints                parametric points
+         *                                     ( <number of param dimensions> x <number of points> )
+         */
+        static const Interpolation_Function_Table* get_table(
+                Geometry_Type                      aGeometryType,
+                const Interpolation_Function_Base* aInterpolationFunction,
+                const Matrix< DDRMat >&            aPoints );
+
+        //------------------------------------------------------------------------------
+        /**
+         * returns the index of the tabulated point matching a parametric point, -1 if none matches
+         *
+         * @param[ in ] aXi         parametric point ( <number of param dimensions> x 1 )
+         * @param[ in ] aFirstGuess index checked first, e.g. the point following the last match
+         */
+        sint find_point(
+                const Matrix< DDRMat >& aXi,
+                uint                    aFirstGuess ) const;
+
+        //------------------------------------------------------------------------------
+
+        uint
+        get_number_of_points() const
+        {
+            return mPoints.n_cols();
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * shape functions at a tabulated point ( 1 x <number of bases> )
+         */
+        const Matrix< DDRMat >&
+        N( uint aPointIndex ) const
+        {
+            return mN( aPointIndex );
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * first parametric derivatives at a tabulated point ( <number of param dimensions> x <number of bases> )
+         */
+        const Matrix< DDRMat >&
+        dNdXi( uint aPointIndex ) const
+        {
+            return mdNdXi( aPointIndex );
+        }
+
+        //------------------------------------------------------------------------------
+        /**
+         * second parametric derivatives at a tabulated point ( 3 or 6 x <number of bases> )
+         */
+        const Matrix< DDRMat >&
+        d2NdXi2( uint aPointIndex ) const
+        {
+            return md2NdXi2( aPointIndex );
+        }
+
+        //------------------------------------------------------------------------------
+
+      private:
+        //------------------------------------------------------------------------------
+        /**
+         * checks whether a parametric point matches a tabulated point
+         */
+        bool is_point(
+                const Matrix< DDRMat >& aXi,
+                uint                    aPointIndex ) const;
+
+        //------------------------------------------------------------------------------
+    };
+}    // namespace moris::mtk
+
+#endif /* SRC_MTK_CL_MTK_INTERPOLATION_FUNCTION_TABLE_HPP_ */
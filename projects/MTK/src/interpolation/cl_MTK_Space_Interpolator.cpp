@@ -208,6 +208,36 @@ namespace moris::mtk
 
     //------------------------------------------------------------------------------
 
+    void
+    Space_Interpolator::set_shape_function_table( const Matrix< DDRMat >& aParamPoints )
+    {
+        // check input size aParamPoints
+        MORIS_ASSERT( aParamPoints.n_rows() >= mNumSpaceParamDim,
+                "Space_Interpolator::set_shape_function_table - Wrong input size ( aParamPoints )." );
+
+        // get the shared table for the space interpolation function at these points
+        mShapeFunctionTable = Interpolation_Function_Table::get_table(
+                mGeometryType,
+                mSpaceInterpolation,
+                aParamPoints( { 0, mNumSpaceParamDim - 1 }, { 0, aParamPoints.n_cols() - 1 } ) );
+
+        mTablePointIndex = -1;
+    }
+
+    //------------------------------------------------------------------------------
+
+    void
+    Space_Interpolator::find_table_point()
+    {
+        if ( mShapeFunctionTable != nullptr )
+        {
+            // integration points are visited in order, try the next one first
+            mTablePointIndex = mShapeFunctionTable->find_point( mXiLocal, mTablePointIndex + 1 );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     void
     Space_Interpolator::set_space_time( const Matrix< DDRMat >& aParamPoint )
     {
@@ -215,6 +245,9 @@ namespace moris::mtk
         // set input values
         mXiLocal = aParamPoint( { 0, mNumSpaceParamDim - 1 }, { 0, 0 } );
 
+        // look up evaluation point in shape function table
+        this->find_table_point();
+
         // if no mapping required
         if ( !mMapFlag )
         {
@@ -248,6 +281,9 @@ namespace moris::mtk
         // set input values
         mXiLocal = aSpaceParamPoint;
 
+        // look up evaluation point in shape function table
+        this->find_table_point();
+
         // if no mapping required
         if ( !mMapFlag )
         {
@@ -288,6 +324,13 @@ namespace moris::mtk
         MORIS_ASSERT( mXiLocal.numel() > 0,
                 "Space_Interpolator::eval_NXi - mXiLocal is not set." );
 
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            mNXi = mShapeFunctionTable->N( mTablePointIndex );
+            return;
+        }
+
         // pass data through interpolation function
         mSpaceInterpolation->eval_N( mXiLocal, mNXi );
     }
@@ -320,6 +363,13 @@ namespace moris::mtk
         MORIS_ASSERT( mXiLocal.numel() > 0,
                 "Space_Interpolator::eval_dNdXi - mXiLocal is not set." );
 
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            mdNdXi = mShapeFunctionTable->dNdXi( mTablePointIndex );
+            return;
+        }
+
         // pass data through interpolation function
         mSpaceInterpolation->eval_dNdXi( mXiLocal, mdNdXi );
     }
@@ -352,6 +402,13 @@ namespace moris::mtk
         MORIS_ASSERT( mXiLocal.numel() > 0,
                 "Space_Interpolator::eval_d2NdXi2 - mXiLocal is not set." );
 
+        // use tabulated values if evaluation point is an integration point
+        if ( mTablePointIndex >= 0 )
+        {
+            md2NdXi2 = mShapeFunctionTable->d2NdXi2( mTablePointIndex );
+            return;
+        }
+
         // pass data through interpolation function
         mSpaceInterpolation->eval_d2NdXi2( mXiLocal, md2NdXi2 );
     }
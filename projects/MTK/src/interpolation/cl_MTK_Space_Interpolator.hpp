@@ -16,6 +16,7 @@
 // MTK/src
 #include "cl_MTK_Enums.hpp"
 #include "cl_MTK_Interpolation_Rule.hpp"
+#include "cl_MTK_Interpolation_Function_Table.hpp"
 // LINALG/src
 #include "linalg_typedefs.hpp"
 #include "cl_Matrix.hpp"
@@ -40,6 +41,10 @@ namespace moris::mtk
         // pointer to space interpolation function object
         Interpolation_Function_Base* mSpaceInterpolation = nullptr;
 
+        // shape functions tabulated at the integration points, index of the current point in the table
+        const Interpolation_Function_Table* mShapeFunctionTable = nullptr;
+        sint                                mTablePointIndex    = -1;
+
         // number of space bases, number of physical and parametric dimensions
         uint mNumSpaceBases;
         uint mNumSpaceDim;
@@ -346,6 +351,15 @@ namespace moris::mtk
             return mXiHat;
         }
 
+        //------------------------------------------------------------------------------
+        /**
+         * set the points at which the space shape functions and their derivatives are tabulated,
+         * evaluation points matching one of these points use the tabulated values
+         * @param[ in ] aParamPoints points in space and time, only the space rows are used
+         *                           ( <number of param dimensions> + 1 x <number of points> )
+         */
+        void set_shape_function_table( const Matrix< DDRMat >& aParamPoints );
+
         //------------------------------------------------------------------------------
         /**
          * set the parametric point where geometry is interpolated
@@ -672,6 +686,12 @@ namespace moris::mtk
          */
         void set_function_pointers();
 
+        //------------------------------------------------------------------------------
+        /**
+         * looks up the current evaluation point in the shape function table, if any
+         */
+        void find_table_point();
+
         //------------------------------------------------------------------------------
         /**
          * evaluate space detJ.
@@ -22,6 +22,7 @@ namespace moris::NLA
     ENUM_MACRO( NonlinearSolverType,
             NEWTON_SOLVER,
             NLBGS_SOLVER,
+            NEWTON_KRYLOV_SOLVER,
             ARC_LENGTH_SOLVER,
             END_ENUM )
 }
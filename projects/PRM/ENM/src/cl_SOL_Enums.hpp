@@ -25,7 +25,9 @@ namespace moris::sol
             PETSC,          //< Wrapper around Petsc Solver
             EIGEN_SOLVER,
             SLEPC_SOLVER,
-            ML,    //< Wrapper around ML Preconditioner as a solver
+            ML,        //< Wrapper around ML Preconditioner as a solver
+            NATIVE,    //< Built-in Krylov solvers on native CSR matrices
+            LOBPCG,    //< Built-in block eigen solver on distributed matrices
             END_ENUM )
 
     enum class EigSolMethod
@@ -42,7 +44,8 @@ namespace moris::sol
 
     ENUM_MACRO( MapType,
             Epetra,
-            Petsc )
+            Petsc,
+            Native )
 
     /**
      * SolverRelaxationType notes
@@ -89,12 +92,22 @@ namespace moris::sol
             Comsol                 // COMSOL ( see COMSOL_CFDModuleUsersGuide 6.0, page 92, 241)
     )
 
+    /**
+     * SolverAccelerationType notes
+     * None: No acceleration of fixed point iterations
+     * Anderson: Anderson mixing of previous iterates; with a damping of one, equivalent to IQN-ILS
+     */
+    ENUM_MACRO( SolverAccelerationType,
+            None,
+            Anderson )
+
     // enum for the type of preconditioner
     ENUM_MACRO( PreconditionerType,
             NONE,
             IFPACK,    // Ifpack
             ML,        // ML
             PETSC,     // Petsc
+            NATIVE,    // built-in Jacobi, ILU(0) and Chebyshev
             END_ENUM )
 
     enum class EiegnSolverType
@@ -321,6 +321,10 @@ namespace moris::prm
         // enum for finite difference perturbation strategy (relative, absolute)
         tParameterList.insert_enum( "finite_difference_perturbation_strategy", fem::Perturbation_Type_String::values );
 
+        // number of copies of the set evaluation state on which elements are evaluated concurrently during the
+        // threaded forward assembly, 0 uses one per OpenMP thread, 1 evaluates all elements of a set in sequence
+        tParameterList.insert( "number_of_evaluation_workspaces", 0u );
+
         return tParameterList;
     }
 
@@ -44,6 +44,14 @@ namespace moris::prm
         // User defined processor grid.  Decomp method must = 0.  Product of array must match number of processors used
         tParameterList.insert( "processor_dimensions", Vector< uint >() );
 
+        // Number of coarsest elements per processor slab, concatenated over all directions; uniform slabs if empty
+        tParameterList.insert( "processor_splits", Vector< uint >() );
+
+        // balance processor slabs by the cost of the refined mesh. The slabs are applied when HMR is rebuilt by the remeshing
+        // mini performer and when restarting on the same number of procs from the binary refinement pattern file, which stores
+        // them. A mesh refined from scratch within a run keeps the slabs it was created with.
+        tParameterList.insert( "processor_load_balancing", false );
+
         // Lagrange Meshes that are used as output meshes
         tParameterList.insert( "lagrange_output_meshes", "" );
 
@@ -95,6 +103,9 @@ namespace moris::prm
         // name of restart file - write
         tParameterList.insert( "write_refinement_pattern_file", false );
 
+        // write restart file also as binary file (.hmr) that can be read on any processor decomposition
+        tParameterList.insert( "write_binary_refinement_pattern_file", false );
+
         // name of restart file - load
         tParameterList.insert( "restart_refinement_pattern_file", "" );
 
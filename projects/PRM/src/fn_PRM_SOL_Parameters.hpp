@@ -25,7 +25,7 @@ namespace moris::prm
     {
         Parameter_List tSolverWarehouseList( "Solver Warehouse" );
 
-        // TPL type. can be epetra or petsc
+        // TPL type. can be epetra, petsc or native; the native backend runs on a single processor only
         tSolverWarehouseList.insert_enum( "SOL_TPL_Type", sol::MapType_String::values );
 
         // save operator to matlab file
@@ -63,6 +63,25 @@ namespace moris::prm
     //------------------------------------------------------------------------------
     // P R E C O N I T I O N E R   P A R A M E T E R L I S T //
 
+    // inserts the reuse parameters shared by all preconditioners
+    inline void
+    insert_preconditioner_reuse_parameters( Parameter_List& aParameterlist )
+    {
+        // Reuse of preconditioner
+        aParameterlist.insert( "prec_reuse", false );
+
+        // Reuse policy of preconditioner
+        aParameterlist.insert( "prec_reuse_policy", std::string( "default" ) );    // "default", "adaptive"
+
+        // Relative growth of the Krylov iterations, compared to the first solve after setup, which triggers a rebuild (adaptive policy)
+        aParameterlist.insert( "prec_rebuild_iteration_growth", 0.5 );
+
+        // Maximum number of reuses before a rebuild, 0 for unlimited (adaptive policy)
+        aParameterlist.insert( "prec_max_reuses", 0 );
+    }
+
+    //------------------------------------------------------------------------------
+
     static inline void
     create_ifpack_preconditioner_parameterlist( Parameter_List& aParameterlist )
     {
@@ -178,7 +197,7 @@ namespace moris::prm
         aParameterlist.insert( "krylov: zero starting solution", 0 );
 
         // Reuse of preconditioner
-        aParameterlist.insert( "prec_reuse", false );
+        insert_preconditioner_reuse_parameters( aParameterlist );
     }
 
     //------------------------------------------------------------------------------
@@ -217,6 +236,37 @@ namespace moris::prm
         aParameterlist.insert( "num_pde_equations", (sint)1 );
         aParameterlist.insert( "amg_type", "agg" );
         aParameterlist.insert( "use_gamg_defaults", true );
+
+        // Reuse of preconditioner
+        insert_preconditioner_reuse_parameters( aParameterlist );
+    }
+
+    //------------------------------------------------------------------------------
+
+    // creates a parameter list with default inputs
+    inline void
+    create_native_preconditioner_parameterlist( Parameter_List& aParameterlist )
+    {
+        aParameterlist.set( "Preconditioner_Implementation", sol::PreconditionerType::NATIVE );
+
+        // Set default preconditioner
+        aParameterlist.insert( "native_prec_type", std::string( "jacobi" ) );    // "jacobi", "ilu0", "chebyshev"
+
+        // Precision in which the preconditioner is computed and stored, single only for jacobi and ilu0;
+        // there is no single precision option for the direct solvers of Amesos and PETSc
+        aParameterlist.insert( "native_prec_precision", std::string( "double" ) );    // "double", "single"
+
+        // Degree of the Chebyshev polynomial
+        aParameterlist.insert( "chebyshev_degree", 3 );
+
+        // Ratio between the largest and the smallest eigenvalue targeted by the Chebyshev polynomial
+        aParameterlist.insert( "chebyshev_eigenvalue_ratio", 30.0 );
+
+        // Number of power iterations to estimate the largest eigenvalue
+        aParameterlist.insert( "chebyshev_power_iterations", 10 );
+
+        // Reuse of preconditioner
+        insert_preconditioner_reuse_parameters( aParameterlist );
     }
 
     //------------------------------------------------------------------------------
@@ -300,7 +350,7 @@ namespace moris::prm
         aParameterlist.insert( "null space: add default vectors", true );
 
         // Reuse of preconditioner
-        aParameterlist.insert( "prec_reuse", false );
+        insert_preconditioner_reuse_parameters( aParameterlist );
     }
 
     //------------------------------------------------------------------------------
@@ -580,6 +630,11 @@ namespace moris::prm
 
         tLinAlgorithmParameterList.insert( "ComputeConditionNumber", false );
 
+        // keep the factorization of the last forward solve and use it for transpose solves of the adjoint
+        // problem; only exact if the adjoint Jacobian is the transpose of the last factorized Jacobian,
+        // e.g. for linear problems with one Newton iteration per solve
+        tLinAlgorithmParameterList.insert( "reuse_factorization_for_adjoint", false );
+
         return tLinAlgorithmParameterList;
     }
 
@@ -611,7 +666,7 @@ namespace moris::prm
         // Maximum number of blocks in Krylov factorization
         tLinAlgorithmParameterList.insert( "Num Blocks", INT_MAX );
 
-        // Block size to be used by iterative solver
+        // Block size to be used by iterative solver, block solvers use the number of right hand sides by default
         tLinAlgorithmParameterList.insert( "Block Size", INT_MAX );
 
         // Allowable Belos solver iterations
@@ -629,6 +684,13 @@ namespace moris::prm
         // frequency of output
         tLinAlgorithmParameterList.insert( "Output Frequency", -1 );
 
+        // size of the recycled subspace of the Recycling GMRES and Recycling CG solvers
+        tLinAlgorithmParameterList.insert( "Num Recycled Blocks", INT_MAX );
+
+        // keep the recycled subspace of the Recycling GMRES and Recycling CG solvers between solves,
+        // e.g. over Newton iterations, time steps and adjoint solves
+        tLinAlgorithmParameterList.insert( "Keep Recycled Subspace", true );
+
         return tLinAlgorithmParameterList;
     }
 
@@ -684,11 +746,78 @@ namespace moris::prm
         // blocks in addtive Schwartz algorthim
         tLinAlgorithmParameterList.insert( "ASM_blocks_output_filename", "" );
 
+        // solve multiple right hand sides as one block with KSPMatSolve
+        tLinAlgorithmParameterList.insert( "block_solve_multiple_rhs", true );
+
         return tLinAlgorithmParameterList;
     }
 
     //------------------------------------------------------------------------------
 
+    // creates a parameter list with default inputs
+    // the native solver requires SOL_TPL_Type native and is restricted to serial runs
+    inline Parameter_List
+    create_linear_algorithm_parameter_list_native()
+    {
+        Parameter_List tLinAlgorithmParameterList = create_algorithm_parameter_list();
+
+        tLinAlgorithmParameterList.set( "Solver_Implementation", sol::SolverType::NATIVE );
+
+        // Set Krylov method
+        tLinAlgorithmParameterList.insert( "Krylov_Method", std::string( "gmres" ) );    // "gmres", "cg", "bicgstab", "refinement"
+
+        // Maximum number of iterations
+        tLinAlgorithmParameterList.insert( "Max_Iter", 1000 );
+
+        // Relative residual tolerance
+        tLinAlgorithmParameterList.insert( "Convergence_Tolerance", 1e-10 );
+
+        // Krylov subspace size after which GMRES is restarted
+        tLinAlgorithmParameterList.insert( "GMRES_Restart", 50 );
+
+        // Iterative refinement with the preconditioner, e.g. a single precision ilu0, is continued with GMRES
+        // once a step reduces the residual by less than this ratio
+        tLinAlgorithmParameterList.insert( "Refinement_Stall_Ratio", 0.9 );
+
+        // Frequency of residual output, no output if < 1
+        tLinAlgorithmParameterList.insert( "Output_Frequency", -1 );
+
+        return tLinAlgorithmParameterList;
+    }
+
+    //------------------------------------------------------------------------------
+
+    // creates a parameter list with default inputs
+    inline Parameter_List
+    create_lobpcg_algorithm_parameter_list()
+    {
+        Parameter_List tEigAlgoParameterList = create_algorithm_parameter_list();
+
+        tEigAlgoParameterList.set( "Solver_Implementation", sol::SolverType::LOBPCG );
+
+        // Number of smallest eigenvalues to be computed, equals block size
+        tEigAlgoParameterList.insert( "Num_Eig_Vals", 1 );
+
+        // Maximum number of iterations
+        tEigAlgoParameterList.insert( "Max_Iter", 500 );
+
+        // Residual tolerance relative to the norms of A x and lambda B x
+        tEigAlgoParameterList.insert( "Convergence_Tolerance", 1e-08 );
+
+        // Start from the eigenvectors of the previous solve if the number of dofs did not change
+        tEigAlgoParameterList.insert( "Warm_Start", true );
+
+        // Frequency of residual output, no output if < 1
+        tEigAlgoParameterList.insert( "Output_Frequency", -1 );
+
+        // Update flag for vismesh
+        tEigAlgoParameterList.insert( "Update_Flag", true );
+
+        return tEigAlgoParameterList;
+    }
+
+    //------------------------------------------------------------------------------
+
     inline Parameter_List
     create_linear_solver_parameter_list()
     {
@@ -831,6 +960,16 @@ namespace moris::prm
         // Time offsets for outputting pseudo time steps; if offset is zero no output is written
         tNonLinAlgorithmParameterList.insert( "NLA_pseudo_time_offset", 0.0 );
 
+        // Acceleration strategy for fixed point iterations of the NLBGS solver
+        tNonLinAlgorithmParameterList.insert_enum( "NLA_acceleration_strategy",
+                sol::SolverAccelerationType_String::values );
+
+        // Maximum number of previous iterates used for acceleration
+        tNonLinAlgorithmParameterList.insert( "NLA_acceleration_depth", 5 );
+
+        // Damping of the fixed point residual in the accelerated update
+        tNonLinAlgorithmParameterList.insert( "NLA_acceleration_damping", 1.0 );
+
         // Maximal number of linear solver restarts on fail
         tNonLinAlgorithmParameterList.insert( "NLA_hard_break", false );
 
@@ -840,6 +979,20 @@ namespace moris::prm
         // Determines if jacobian is rebuild for every nonlinear iteration
         tNonLinAlgorithmParameterList.insert( "NLA_rebuild_jacobian", true );
 
+        // Jacobian-free Newton-Krylov: number of Newton iterations between assemblies of the Jacobian used for
+        // preconditioning; 0 for no preconditioning. Use preconditioner reuse in the linear solver to build the
+        // preconditioner once per assembled Jacobian.
+        tNonLinAlgorithmParameterList.insert( "NLA_JFNK_jacobian_update", 5 );
+
+        // Jacobian-free Newton-Krylov: maximum number of GMRES iterations per Newton iteration, sets the memory used
+        tNonLinAlgorithmParameterList.insert( "NLA_JFNK_max_krylov_iter", 30 );
+
+        // Jacobian-free Newton-Krylov: required relative drop of the linear residual per Newton iteration
+        tNonLinAlgorithmParameterList.insert( "NLA_JFNK_forcing_term", 1e-2 );
+
+        // Jacobian-free Newton-Krylov: relative perturbation for finite differencing of the residual
+        tNonLinAlgorithmParameterList.insert( "NLA_JFNK_perturbation", 1e-7 );
+
         // Determines if linear solve should restart on fail
         tNonLinAlgorithmParameterList.insert( "NLA_combined_res_jac_assembly", true );
 
@@ -926,6 +1079,33 @@ namespace moris::prm
         // Time Frame
         tTimeAlgorithmParameterList.insert( "TSA_Time_Frame", 1.0 );
 
+        // Adaptive time stepping based on an estimate of the local error of each time slab;
+        // the initial time increment is given by the time frame and the number of time steps
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Time_Stepping", false );
+
+        // Tolerance for the relative local error estimate of a time slab
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Tolerance", 1.0e-3 );
+
+        // Minimum and maximum time increment
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Min_Time_Increment", 1.0e-6 );
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Max_Time_Increment", MORIS_REAL_MAX );
+
+        // Safety factor applied to the optimal time increment
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Safety_Factor", 0.9 );
+
+        // Maximum factor by which the time increment grows from one time slab to the next
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Max_Growth_Factor", 2.0 );
+
+        // Maximum number of consecutive rejections of a time slab before it is accepted anyway
+        tTimeAlgorithmParameterList.insert( "TSA_Adaptive_Max_Rejections", 10 );
+
+        // Number of state checkpoints kept for the sensitivity analysis; states between checkpoints are
+        // recomputed during the backward sweep. If zero, the states of all time slabs are kept.
+        tTimeAlgorithmParameterList.insert( "TSA_Adjoint_Checkpoints", 0 );
+
+        // Directory to which checkpoints are written by each processor; if empty, checkpoints are kept in memory
+        tTimeAlgorithmParameterList.insert( "TSA_Adjoint_Checkpoint_Directory", "" );
+
         return tTimeAlgorithmParameterList;
     }
 
@@ -979,6 +1159,9 @@ namespace moris::prm
             case sol::SolverType::PETSC:
                 tParameterList = create_linear_algorithm_parameter_list_petsc();
                 break;
+            case sol::SolverType::NATIVE:
+                tParameterList = create_linear_algorithm_parameter_list_native();
+                break;
             case sol::SolverType::EIGEN_SOLVER:
                 tParameterList = create_eigen_algorithm_parameter_list();
                 break;
@@ -995,6 +1178,9 @@ namespace moris::prm
                 tParameterList = create_slepc_algorithm_parameter_list();
                 break;
             }
+            case sol::SolverType::LOBPCG:
+                tParameterList = create_lobpcg_algorithm_parameter_list();
+                break;
 
             default:
                 MORIS_ERROR( false, "Parameter list for this solver not implemented yet" );
@@ -1064,6 +1250,9 @@ namespace moris::prm
             case sol::PreconditionerType::PETSC:
                 create_petsc_preconditioner_parameterlist( tParameterList );
                 break;
+            case sol::PreconditionerType::NATIVE:
+                create_native_preconditioner_parameterlist( tParameterList );
+                break;
             default:
                 MORIS_ERROR( false, "Parameter list for this solver not implemented yet" );
                 break;
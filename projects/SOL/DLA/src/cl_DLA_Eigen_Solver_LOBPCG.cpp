@@ -0,0 +1,689 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Eigen_Solver_LOBPCG.cpp
+ *
+ */
+
+#include <cmath>
+
+#include "cl_DLA_Eigen_Solver_LOBPCG.hpp"
+#include "cl_DLA_Preconditioner_Native.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+
+#include "fn_eig_sym.hpp"
+#include "fn_trans.hpp"
+#include "op_times.hpp"
+
+#include "moris_openmp.hpp"
+#include "cl_Stopwatch.hpp"    //CHR/src
+#include "cl_Communication_Tools.hpp"
+
+// detailed logging
+#include "cl_Tracer.hpp"
+
+using namespace moris;
+using namespace dla;
+
+namespace
+{
+    //----------------------------------------------------------------------------------------
+
+    // aGram( aRowOffset + i, aColOffset + j ) = x_i^T y_j for the local parts of two blocks of aNumCols vectors
+    void
+    set_local_inner_products(
+            sint              aLength,
+            uint              aNumCols,
+            const real*       aX,
+            const real*       aY,
+            Matrix< DDRMat >& aGram,
+            uint              aRowOffset,
+            uint              aColOffset )
+    {
+        for ( uint i = 0; i < aNumCols; i++ )
+        {
+            for ( uint j = 0; j < aNumCols; j++ )
+            {
+                const real* tX = aX + i * aLength;
+                const real* tY = aY + j * aLength;
+
+                real tSum = 0.0;
+
+                MORIS_OMP_PRAGMA( omp parallel for simd reduction( + : tSum ) )
+                for ( sint Ik = 0; Ik < aLength; Ik++ )
+                {
+                    tSum += tX[ Ik ] * tY[ Ik ];
+                }
+
+                aGram( aRowOffset + i, aColOffset + j ) = tSum;
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------------------
+
+    // aY = aX * aCoefficients( aRowOffset + k, j ) + aBeta * aY for blocks of aNumCols vectors
+    void
+    add_block_product(
+            sint                    aLength,
+            uint                    aNumCols,
+            const real*             aX,
+            const Matrix< DDRMat >& aCoefficients,
+            uint                    aRowOffset,
+            real                    aBeta,
+            real*                   aY )
+    {
+        for ( uint j = 0; j < aNumCols; j++ )
+        {
+            real* tY = aY + j * aLength;
+
+            MORIS_OMP_PRAGMA( omp parallel for simd )
+            for ( sint Ik = 0; Ik < aLength; Ik++ )
+            {
+                real tSum = aBeta * tY[ Ik ];
+
+                for ( uint k = 0; k < aNumCols; k++ )
+                {
+                    tSum += aX[ k * aLength + Ik ] * aCoefficients( aRowOffset + k, j );
+                }
+
+                tY[ Ik ] = tSum;
+            }
+        }
+    }
+
+    //----------------------------------------------------------------------------------------
+}    // namespace
+
+//----------------------------------------------------------------------------------------
+
+Eigen_Solver_LOBPCG::Eigen_Solver_LOBPCG( const moris::Parameter_List& aParameterlist )
+        : Linear_Solver_Algorithm( aParameterlist )
+{
+    mNumEigenValues  = mParameterList.get< sint >( "Num_Eig_Vals" );
+    mMaxIter         = mParameterList.get< sint >( "Max_Iter" );
+    mTolerance       = mParameterList.get< real >( "Convergence_Tolerance" );
+    mOutputFrequency = mParameterList.get< sint >( "Output_Frequency" );
+    mWarmStart       = mParameterList.get< bool >( "Warm_Start" );
+
+    MORIS_ERROR( mNumEigenValues > 0,
+            "Eigen_Solver_LOBPCG::Eigen_Solver_LOBPCG - number of eigenvalues has to be positive." );
+}
+
+//----------------------------------------------------------------------------------------
+
+Eigen_Solver_LOBPCG::~Eigen_Solver_LOBPCG()
+{
+    this->delete_blocks();
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::set_preconditioner( Preconditioner* aPreconditioner )
+{
+    mPreconditioner = dynamic_cast< Preconditioner_Native* >( aPreconditioner );
+
+    MORIS_ERROR( aPreconditioner == nullptr || mPreconditioner != nullptr,
+            "Eigen_Solver_LOBPCG::set_preconditioner - LOBPCG requires a native preconditioner." );
+}
+
+//----------------------------------------------------------------------------------------
+
+moris::sint
+Eigen_Solver_LOBPCG::solve_linear_system()
+{
+    MORIS_ERROR( mLinearSystem != nullptr,
+            "Eigen_Solver_LOBPCG::solve_linear_system - no linear problem set." );
+
+    return this->solve_linear_system( mLinearSystem, 1 );
+}
+
+//----------------------------------------------------------------------------------------
+
+moris::sint
+Eigen_Solver_LOBPCG::solve_linear_system(
+        Linear_Problem*   aLinearSystem,
+        const moris::sint aIter )
+{
+    Tracer tTracer( "LinearSolver", "LOBPCG", "Solve" );
+
+    // set linear system
+    mLinearSystem    = aLinearSystem;
+    mSolverInterface = aLinearSystem->get_solver_input();
+
+    this->set_operators( aLinearSystem );
+
+    // build preconditioner, approximates the inverse of the linear system matrix
+    if ( mPreconditioner )
+    {
+        mPreconditioner->build( aLinearSystem, aIter );
+    }
+
+    this->create_blocks( aLinearSystem );
+
+    MORIS_ERROR( (sint)mNumEigenValues <= mBlocks( 0 )( X_BLOCK )->vec_global_length(),
+            "Eigen_Solver_LOBPCG::solve_linear_system - more eigenvalues requested than dofs." );
+
+    // start timer
+    tic tTimer;
+
+    // B-orthonormalize initial iterate by Rayleigh-Ritz on its span
+    this->initialize_iterate();
+    this->apply_operators( X_BLOCK );
+
+    Matrix< DDRMat > tCoefficients;
+
+    bool tIsIndependent = this->rayleigh_ritz( 1, tCoefficients );
+
+    MORIS_ERROR( tIsIndependent,
+            "Eigen_Solver_LOBPCG::solve_linear_system - initial vectors are linearly dependent." );
+
+    this->update_blocks( 1, tCoefficients );
+
+    bool tHasSearchDirection = false;
+    bool tConverged          = false;
+
+    sint iIter = 0;
+
+    real tMaxResidual = 0.0;
+
+    while ( true )
+    {
+        tMaxResidual = this->compute_residuals();
+
+        if ( mOutputFrequency > 0 && iIter % mOutputFrequency == 0 )
+        {
+            MORIS_LOG_INFO( "LOBPCG iteration %d: maximum relative residual %e", iIter, tMaxResidual );
+        }
+
+        if ( tMaxResidual <= mTolerance )
+        {
+            tConverged = true;
+            break;
+        }
+
+        if ( iIter >= mMaxIter )
+        {
+            break;
+        }
+
+        this->apply_preconditioner();
+        this->apply_operators( W_BLOCK );
+
+        uint tNumBlocks = tHasSearchDirection ? 3 : 2;
+
+        // restart without search direction if the basis has become linearly dependent
+        if ( !this->rayleigh_ritz( tNumBlocks, tCoefficients ) )
+        {
+            tNumBlocks = 2;
+
+            if ( !this->rayleigh_ritz( tNumBlocks, tCoefficients ) )
+            {
+                MORIS_LOG_WARNING( "Eigen_Solver_LOBPCG - basis is linearly dependent, stopping in iteration %d.", iIter );
+                break;
+            }
+        }
+
+        this->update_blocks( tNumBlocks, tCoefficients );
+
+        tHasSearchDirection = true;
+
+        iIter++;
+    }
+
+    mSolNumIters     = iIter;
+    mSolTrueResidual = tMaxResidual;
+    mSolTime         = tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+    // report iterations to the preconditioner reuse policy
+    if ( mPreconditioner )
+    {
+        mPreconditioner->register_solve( mSolNumIters, max_all( mSolTime ) );
+    }
+
+    MORIS_LOG_SPEC( "EigenSolverIterations", mSolNumIters );
+
+    if ( !tConverged )
+    {
+        MORIS_LOG_WARNING( "Eigen_Solver_LOBPCG - not converged after %d iterations, maximum relative residual %e.", iIter, tMaxResidual );
+    }
+
+    this->store_solution( aLinearSystem );
+
+    return tConverged ? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::set_operators( Linear_Problem* aLinearSystem )
+{
+    std::string tRHSType = aLinearSystem->get_rhs_matrix_type();
+
+    mIsBucklingProblem = false;
+
+    if ( tRHSType == "" || tRHSType == "IdentityMat" )
+    {
+        mOperatorA = aLinearSystem->get_matrix();
+        mOperatorB = nullptr;
+    }
+    else if ( tRHSType == "MassMat" )
+    {
+        aLinearSystem->assemble_rhs_matrix();
+
+        mOperatorA = aLinearSystem->get_matrix();
+        mOperatorB = aLinearSystem->get_mass_matrix();
+    }
+    else if ( tRHSType == "GeomStiffMat" )
+    {
+        aLinearSystem->assemble_rhs_matrix();
+
+        // -G x = theta K x, the stiffness matrix is positive definite
+        mOperatorA = aLinearSystem->get_mass_matrix();
+        mOperatorB = aLinearSystem->get_matrix();
+
+        mIsBucklingProblem = true;
+    }
+    else
+    {
+        MORIS_ERROR( false, "Eigen_Solver_LOBPCG::set_operators - right hand side matrix type %s not recognized.", tRHSType.c_str() );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::create_blocks( Linear_Problem* aLinearSystem )
+{
+    this->delete_blocks();
+
+    sol::Matrix_Vector_Factory tVecFactory( aLinearSystem->get_tpl_type() );
+
+    sol::Dist_Map* tMap = aLinearSystem->get_free_solver_LHS()->get_map();
+
+    // vectors, products with A and products with B
+    uint tNumFamilies = mOperatorB != nullptr ? 3 : 2;
+
+    mBlocks.resize( tNumFamilies );
+
+    for ( auto& tFamily : mBlocks )
+    {
+        tFamily.resize( TEMP_BLOCK + 1, nullptr );
+
+        for ( auto& tBlock : tFamily )
+        {
+            tBlock = tVecFactory.create_vector( tMap, mNumEigenValues );
+        }
+    }
+
+    mLength = mBlocks( 0 )( X_BLOCK )->vec_local_length();
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::delete_blocks()
+{
+    for ( auto& tFamily : mBlocks )
+    {
+        for ( auto& tBlock : tFamily )
+        {
+            delete tBlock;
+        }
+    }
+
+    mBlocks.clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+sol::Dist_Vector*
+Eigen_Solver_LOBPCG::get_b_block( Block_Index aBlock )
+{
+    return mOperatorB != nullptr ? mBlocks( 2 )( aBlock ) : mBlocks( 0 )( aBlock );
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::initialize_iterate()
+{
+    sol::Dist_Vector* tX = mBlocks( 0 )( X_BLOCK );
+
+    bool tUsePrevious = mWarmStart
+                     && mPreviousEigenVectors.n_rows() == (uint)mLength
+                     && mPreviousEigenVectors.n_cols() == mNumEigenValues;
+
+    // all processors have to start from the same kind of initial guess
+    if ( min_all( (uint)tUsePrevious ) == 1 )
+    {
+        std::copy( mPreviousEigenVectors.data(),
+                mPreviousEigenVectors.data() + mLength * mNumEigenValues,
+                tX->get_values_pointer() );
+
+        MORIS_LOG_INFO( "LOBPCG: warm start from eigenvectors of previous solve" );
+    }
+    else
+    {
+        tX->random();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::apply_operators( Block_Index aBlock )
+{
+    sol::Dist_Vector* tVectors = mBlocks( 0 )( aBlock );
+    sol::Dist_Vector* tProduct = mBlocks( 1 )( aBlock );
+
+    mOperatorA->mat_vec_product( *tVectors, *tProduct, false );
+
+    if ( mIsBucklingProblem )
+    {
+        real* tValues = tProduct->get_values_pointer();
+
+        for ( sint Ik = 0; Ik < mLength * (sint)mNumEigenValues; Ik++ )
+        {
+            tValues[ Ik ] = -tValues[ Ik ];
+        }
+    }
+
+    if ( mOperatorB != nullptr )
+    {
+        mOperatorB->mat_vec_product( *tVectors, *mBlocks( 2 )( aBlock ), false );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+real
+Eigen_Solver_LOBPCG::compute_residuals()
+{
+    const real* tAX = mBlocks( 1 )( X_BLOCK )->get_values_pointer();
+    const real* tBX = this->get_b_block( X_BLOCK )->get_values_pointer();
+    real*       tR  = mBlocks( 0 )( W_BLOCK )->get_values_pointer();
+
+    // squared norms of residual, A x and B x for each Ritz pair
+    Matrix< DDRMat > tNorms( 3, mNumEigenValues, 0.0 );
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        real tLambda = mRitzValues( j );
+
+        sint tOffset = j * mLength;
+
+        real tResidual = 0.0;
+        real tNormAX   = 0.0;
+        real tNormBX   = 0.0;
+
+        MORIS_OMP_PRAGMA( omp parallel for simd reduction( + : tResidual, tNormAX, tNormBX ) )
+        for ( sint Ik = tOffset; Ik < tOffset + mLength; Ik++ )
+        {
+            tR[ Ik ] = tAX[ Ik ] - tLambda * tBX[ Ik ];
+
+            tResidual += tR[ Ik ] * tR[ Ik ];
+            tNormAX += tAX[ Ik ] * tAX[ Ik ];
+            tNormBX += tBX[ Ik ] * tBX[ Ik ];
+        }
+
+        tNorms( 0, j ) = tResidual;
+        tNorms( 1, j ) = tNormAX;
+        tNorms( 2, j ) = tNormBX;
+    }
+
+    tNorms = sum_all_matrix( tNorms );
+
+    real tMaxResidual = 0.0;
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        real tScale = std::sqrt( tNorms( 1, j ) ) + std::abs( mRitzValues( j ) ) * std::sqrt( tNorms( 2, j ) );
+
+        real tResidual = tScale > 0.0 ? std::sqrt( tNorms( 0, j ) ) / tScale : std::sqrt( tNorms( 0, j ) );
+
+        tMaxResidual = std::max( tMaxResidual, tResidual );
+    }
+
+    return tMaxResidual;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::apply_preconditioner()
+{
+    if ( mPreconditioner == nullptr || !mPreconditioner->exists() )
+    {
+        return;
+    }
+
+    const real* tR = mBlocks( 0 )( W_BLOCK )->get_values_pointer();
+    real*       tW = mBlocks( 0 )( TEMP_BLOCK )->get_values_pointer();
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        mPreconditioner->apply( tR + j * mLength, tW + j * mLength );
+    }
+
+    std::swap( mBlocks( 0 )( W_BLOCK ), mBlocks( 0 )( TEMP_BLOCK ) );
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Eigen_Solver_LOBPCG::rayleigh_ritz(
+        uint              aNumBlocks,
+        Matrix< DDRMat >& aCoefficients )
+{
+    uint tSize = aNumBlocks * mNumEigenValues;
+
+    // Gram matrices S^T A S and S^T B S, side by side to be summed at once
+    Matrix< DDRMat > tGram( tSize, 2 * tSize, 0.0 );
+
+    for ( uint iBlock = 0; iBlock < aNumBlocks; iBlock++ )
+    {
+        const real* tS = mBlocks( 0 )( iBlock )->get_values_pointer();
+
+        for ( uint jBlock = 0; jBlock < aNumBlocks; jBlock++ )
+        {
+            set_local_inner_products(
+                    mLength,
+                    mNumEigenValues,
+                    tS,
+                    mBlocks( 1 )( jBlock )->get_values_pointer(),
+                    tGram,
+                    iBlock * mNumEigenValues,
+                    jBlock * mNumEigenValues );
+
+            set_local_inner_products(
+                    mLength,
+                    mNumEigenValues,
+                    tS,
+                    this->get_b_block( static_cast< Block_Index >( jBlock ) )->get_values_pointer(),
+                    tGram,
+                    iBlock * mNumEigenValues,
+                    tSize + jBlock * mNumEigenValues );
+        }
+    }
+
+    tGram = sum_all_matrix( tGram );
+
+    Matrix< DDRMat > tGramA( tSize, tSize );
+    Matrix< DDRMat > tGramB( tSize, tSize );
+
+    for ( uint i = 0; i < tSize; i++ )
+    {
+        for ( uint j = 0; j < tSize; j++ )
+        {
+            tGramA( i, j ) = 0.5 * ( tGram( i, j ) + tGram( j, i ) );
+            tGramB( i, j ) = 0.5 * ( tGram( i, tSize + j ) + tGram( j, tSize + i ) );
+        }
+    }
+
+    // basis of the subspace which is orthonormal with respect to B, dropping nearly dependent directions
+    Matrix< DDRMat > tValuesB;
+    Matrix< DDRMat > tVectorsB;
+    eig_sym( tValuesB, tVectorsB, tGramB );
+
+    real tThreshold = 1.0e-12 * tValuesB( tSize - 1 );
+
+    uint tRank = 0;
+
+    for ( uint i = 0; i < tSize; i++ )
+    {
+        tRank += tValuesB( i ) > tThreshold ? 1 : 0;
+    }
+
+    if ( tRank < mNumEigenValues )
+    {
+        return false;
+    }
+
+    Matrix< DDRMat > tBasis( tSize, tRank );
+
+    for ( uint j = 0; j < tRank; j++ )
+    {
+        uint tIndex = tSize - tRank + j;
+
+        for ( uint i = 0; i < tSize; i++ )
+        {
+            tBasis( i, j ) = tVectorsB( i, tIndex ) / std::sqrt( tValuesB( tIndex ) );
+        }
+    }
+
+    // standard eigen problem in the reduced basis, eigenvalues in ascending order
+    Matrix< DDRMat > tReduced = trans( tBasis ) * tGramA * tBasis;
+
+    for ( uint i = 0; i < tRank; i++ )
+    {
+        for ( uint j = i + 1; j < tRank; j++ )
+        {
+            tReduced( i, j ) = 0.5 * ( tReduced( i, j ) + tReduced( j, i ) );
+            tReduced( j, i ) = tReduced( i, j );
+        }
+    }
+
+    Matrix< DDRMat > tValues;
+    Matrix< DDRMat > tVectors;
+    eig_sym( tValues, tVectors, tReduced );
+
+    Matrix< DDRMat > tLowest( tRank, mNumEigenValues );
+
+    mRitzValues.set_size( mNumEigenValues, 1 );
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        mRitzValues( j ) = tValues( j );
+
+        for ( uint i = 0; i < tRank; i++ )
+        {
+            tLowest( i, j ) = tVectors( i, j );
+        }
+    }
+
+    aCoefficients = tBasis * tLowest;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::update_blocks(
+        uint                    aNumBlocks,
+        const Matrix< DDRMat >& aCoefficients )
+{
+    for ( auto& tFamily : mBlocks )
+    {
+        real* tTemp = tFamily( TEMP_BLOCK )->get_values_pointer();
+
+        if ( aNumBlocks == 1 )
+        {
+            // X = X C_x
+            add_block_product( mLength, mNumEigenValues, tFamily( X_BLOCK )->get_values_pointer(), aCoefficients, 0, 0.0, tTemp );
+
+            std::swap( tFamily( X_BLOCK ), tFamily( TEMP_BLOCK ) );
+
+            continue;
+        }
+
+        // P = W C_w + P C_p, assembled in work block
+        add_block_product( mLength, mNumEigenValues, tFamily( W_BLOCK )->get_values_pointer(), aCoefficients, mNumEigenValues, 0.0, tTemp );
+
+        if ( aNumBlocks == 3 )
+        {
+            add_block_product( mLength, mNumEigenValues, tFamily( P_BLOCK )->get_values_pointer(), aCoefficients, 2 * mNumEigenValues, 1.0, tTemp );
+        }
+
+        // X = X C_x + P, assembled in W block which is not needed anymore
+        real* tNewX = tFamily( W_BLOCK )->get_values_pointer();
+
+        add_block_product( mLength, mNumEigenValues, tFamily( X_BLOCK )->get_values_pointer(), aCoefficients, 0, 0.0, tNewX );
+
+        for ( sint Ik = 0; Ik < mLength * (sint)mNumEigenValues; Ik++ )
+        {
+            tNewX[ Ik ] += tTemp[ Ik ];
+        }
+
+        std::swap( tFamily( X_BLOCK ), tFamily( W_BLOCK ) );
+        std::swap( tFamily( P_BLOCK ), tFamily( TEMP_BLOCK ) );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Eigen_Solver_LOBPCG::store_solution( Linear_Problem* aLinearSystem )
+{
+    sol::Dist_Vector* tX = mBlocks( 0 )( X_BLOCK );
+
+    mEigenValues.resize( mNumEigenValues );
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        mEigenValues( j ) = mIsBucklingProblem ? -1.0 / mRitzValues( j ) : mRitzValues( j );
+
+        MORIS_LOG_INFO( "EigenValue %d: %.15e", j, mEigenValues( j ) );
+    }
+
+    // keep eigenvectors for warm start
+    if ( mWarmStart )
+    {
+        mPreviousEigenVectors.set_size( mLength, mNumEigenValues );
+
+        std::copy( tX->get_values_pointer(),
+                tX->get_values_pointer() + mLength * mNumEigenValues,
+                mPreviousEigenVectors.data() );
+    }
+
+    if ( !mParameterList.get< bool >( "Update_Flag" ) )
+    {
+        return;
+    }
+
+    std::shared_ptr< Vector< real > >& tEigenValues = mSolverInterface->get_eigen_values();
+
+    tEigenValues->clear();
+
+    for ( uint j = 0; j < mNumEigenValues; j++ )
+    {
+        tEigenValues->push_back( mEigenValues( j ) );
+    }
+
+    sol::Dist_Vector* tEigenVectors = mSolverInterface->get_eigen_solution_vector();
+
+    MORIS_ERROR( tEigenVectors->get_num_vectors() == (sint)mNumEigenValues,
+            "Eigen_Solver_LOBPCG::store_solution - number of eigen vectors and eigen values in parameter list should be the same." );
+
+    tEigenVectors->import_local_to_global( *tX );
+}
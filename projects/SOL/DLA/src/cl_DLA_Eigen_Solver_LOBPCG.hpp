@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Eigen_Solver_LOBPCG.hpp
+ *
+ */
+
+#pragma once
+
+#include "cl_DLA_Linear_Solver_Algorithm.hpp"
+#include "fn_PRM_SOL_Parameters.hpp"
+
+namespace moris
+{
+    namespace sol
+    {
+        class Dist_Matrix;
+        class Dist_Vector;
+    }    // namespace sol
+
+    namespace dla
+    {
+        class Linear_Problem;
+        class Preconditioner_Native;
+
+        /**
+         * @brief locally optimal block preconditioned conjugate gradient (LOBPCG) eigen solver
+         *
+         * Computes the smallest eigenvalues of K x = lambda x or K x = lambda M x using only products of the
+         * distributed matrices with blocks of distributed vectors, the preconditioner and small dense
+         * Rayleigh-Ritz problems. For buckling problems, K x = lambda G x, the smallest eigenvalues of
+         * -G x = theta K x are computed and lambda = -1 / theta is returned.
+         *
+         * The eigenvectors of a solve are kept as initial guess for the next solve with the same number of dofs,
+         * such that repeated solves with slowly changing matrices, e.g. within an optimization, need few iterations.
+         */
+        class Eigen_Solver_LOBPCG : public Linear_Solver_Algorithm
+        {
+          private:
+            // indices of vector blocks: iterate, preconditioned residual, search direction and work block
+            enum Block_Index : uint
+            {
+                X_BLOCK,
+                W_BLOCK,
+                P_BLOCK,
+                TEMP_BLOCK
+            };
+
+            Preconditioner_Native* mPreconditioner = nullptr;
+
+            // operators of current solve, no B operator for standard eigen problems
+            sol::Dist_Matrix* mOperatorA = nullptr;
+            sol::Dist_Matrix* mOperatorB = nullptr;
+
+            // A operator is negated and eigenvalues are inverted for buckling problems
+            bool mIsBucklingProblem = false;
+
+            uint mNumEigenValues;
+            sint mMaxIter;
+            real mTolerance;
+            sint mOutputFrequency;
+            bool mWarmStart;
+
+            // local length of vectors
+            sint mLength = 0;
+
+            // blocks of vectors, their products with A and, if present, their products with B
+            Vector< Vector< sol::Dist_Vector* > > mBlocks;
+
+            // current Ritz values
+            Matrix< DDRMat > mRitzValues;
+
+            // local values of eigenvectors of previous solve
+            Matrix< DDRMat > mPreviousEigenVectors;
+
+            // eigenvalues of last solve
+            Vector< real > mEigenValues;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief selects A and B operator based on the right hand side matrix type of the linear problem
+             */
+            void set_operators( Linear_Problem* aLinearSystem );
+
+            //------------------------------------------------------------------------------
+
+            void create_blocks( Linear_Problem* aLinearSystem );
+
+            void delete_blocks();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief block holding the products of a block with B, the block itself for standard eigen problems
+             */
+            sol::Dist_Vector* get_b_block( Block_Index aBlock );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief sets initial block from previous eigenvectors or random values
+             */
+            void initialize_iterate();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief computes products of a block with A and B
+             */
+            void apply_operators( Block_Index aBlock );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief computes residuals of current Ritz pairs in W block
+             *
+             * @return maximum relative residual
+             */
+            real compute_residuals();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief applies the preconditioner to the W block if a preconditioner is set
+             */
+            void apply_preconditioner();
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief Rayleigh-Ritz procedure on the subspace spanned by the first blocks
+             *
+             * @param[ in ]  aNumBlocks    number of blocks spanning the subspace: X, W and P
+             * @param[ out ] aCoefficients coefficients of the new iterate with respect to the blocks
+             *
+             * @return false if the subspace has less dimensions than eigenvalues requested
+             */
+            bool rayleigh_ritz(
+                    uint              aNumBlocks,
+                    Matrix< DDRMat >& aCoefficients );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief updates iterate and search direction and their products with A and B
+             */
+            void update_blocks(
+                    uint                    aNumBlocks,
+                    const Matrix< DDRMat >& aCoefficients );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief stores eigenvalues and eigenvectors in solver interface and for warm start
+             */
+            void store_solution( Linear_Problem* aLinearSystem );
+
+          public:
+            //------------------------------------------------------------------------------
+
+            Eigen_Solver_LOBPCG( const moris::Parameter_List& aParameterlist = prm::create_lobpcg_algorithm_parameter_list() );
+
+            //------------------------------------------------------------------------------
+
+            ~Eigen_Solver_LOBPCG() override;
+
+            //------------------------------------------------------------------------------
+
+            moris::sint solve_linear_system() override;
+
+            //------------------------------------------------------------------------------
+
+            moris::sint solve_linear_system(
+                    Linear_Problem*   aLinearSystem,
+                    const moris::sint aIter = 1 ) override;
+
+            //------------------------------------------------------------------------------
+
+            void set_preconditioner( Preconditioner* aPreconditioner ) override;
+
+            //------------------------------------------------------------------------------
+
+            Vector< real > const &
+            get_eigenvalues() const
+            {
+                return mEigenValues;
+            }
+        };
+    }    // namespace dla
+}    // namespace moris
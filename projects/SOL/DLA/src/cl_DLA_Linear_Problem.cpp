@@ -22,6 +22,16 @@
 
 namespace moris::dla
 {
+    //----------------------------------------------------------------------------------------
+    uint
+    Linear_Problem::create_operator_id()
+    {
+        // linear problems are constructed by the serial solver setup; zero is kept for "no operator"
+        static uint sNumOperators = 0;
+
+        return ++sNumOperators;
+    }
+
     //----------------------------------------------------------------------------------------
     sol::Dist_Vector*
     Linear_Problem::get_full_solver_LHS()
@@ -38,6 +38,12 @@ namespace moris
         class Linear_Problem
         {
           private:
+            //! Identity of the operator of this problem, unique among all linear problems of a run
+            const uint mOperatorId = Linear_Problem::create_operator_id();
+
+            //------------------------------------------------------------------
+
+            static uint create_operator_id();
 
           protected:
             sol::Dist_Matrix* mMat            = nullptr;
@@ -152,6 +158,20 @@ namespace moris
 
             //------------------------------------------------------------------
 
+            /**
+             * @brief Returns an identity of the operator of this problem. Unlike the address of the matrix it is never
+             * reused by a later linear problem and can be used to decide whether a preconditioner may be kept.
+             *
+             * @return operator identity, larger than zero
+             */
+            uint
+            get_operator_id() const
+            {
+                return mOperatorId;
+            }
+
+            //------------------------------------------------------------------
+
             sol::Dist_Matrix*
             get_mass_matrix()
             {
@@ -207,6 +227,14 @@ namespace moris
             {
                 return mRHSMatType;
             }
+
+            //------------------------------------------------------------------
+
+            enum sol::MapType
+            get_tpl_type() const
+            {
+                return mTplType;
+            }
         };
     }    // namespace dla
 }    // namespace moris
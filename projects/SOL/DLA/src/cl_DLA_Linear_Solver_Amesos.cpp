@@ -8,14 +8,19 @@
  *
  */
 
+#include <algorithm>
+
 #include "cl_DLA_Linear_Solver_Amesos.hpp"
 #include "cl_DLA_Linear_Problem.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_SOL_Dist_Matrix.hpp"
 
 #include "Amesos_Umfpack.h"
 
 #include "cl_Tracer.hpp"
+#include "cl_Logger.hpp"
+#include "cl_Stopwatch.hpp"
 
 using namespace moris;
 using namespace dla;
@@ -108,6 +113,25 @@ Linear_Solver_Amesos::solve_linear_system(
 
     mLinearSystem = aLinearSystem;
 
+    bool tIsForwardAnalysis = aLinearSystem->get_solver_input()->is_forward_analysis();
+
+    // adjoint solve: use factorization kept from forward solve if possible
+    if ( !tIsForwardAnalysis && mAmesosSolver != nullptr )
+    {
+        bool tIsSolved = this->solve_with_forward_factorization( aLinearSystem );
+
+        // the forward factorization is used for at most one adjoint solve
+        this->delete_factorization();
+
+        if ( tIsSolved )
+        {
+            return 0;
+        }
+    }
+
+    // delete factorization kept from previous forward solve
+    this->delete_factorization();
+
     mEpetraProblem.SetOperator( aLinearSystem->get_matrix()->get_matrix() );
     mEpetraProblem.SetRHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_solver_RHS() )->get_epetra_vector() );
     mEpetraProblem.SetLHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector() );
@@ -184,10 +208,98 @@ Linear_Solver_Amesos::solve_linear_system(
     mSymFactTime = endSymFactTime - startSymFactTime;
     mNumFactTime = endNumFactTime - startNumFactTime;
 
+    // keep factorization of forward solve for the adjoint solve of the same time slab
+    if ( tIsForwardAnalysis && mParameterList.get< bool >( "reuse_factorization_for_adjoint" ) )
+    {
+        const Epetra_CrsMatrix* tMatrix = aLinearSystem->get_matrix()->get_matrix();
+
+        mFactorizedSystemSize = tMatrix->NumGlobalRows64();
+        mFactorizedRowMap     = std::make_unique< Epetra_Map >( tMatrix->RowMap() );
+        mFactorizedTime       = aLinearSystem->get_solver_input()->get_time();
+    }
+    else
+    {
+        this->delete_factorization();
+    }
+
+    return error;
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+Linear_Solver_Amesos::solve_with_forward_factorization( Linear_Problem* aLinearSystem )
+{
+    Epetra_CrsMatrix* tMatrix = aLinearSystem->get_matrix()->get_matrix();
+
+    // the adjoint system has to have the size and the distribution of the factorized forward system
+    if ( tMatrix->NumGlobalRows64() != mFactorizedSystemSize || !tMatrix->RowMap().SameAs( *mFactorizedRowMap ) )
+    {
+        return false;
+    }
+
+    // the forward Jacobian has to be of the time slab of the adjoint solve, e.g. not the last
+    // Jacobian of a forward sweep for an earlier time slab of the adjoint sweep
+    Matrix< DDRMat > tTime = aLinearSystem->get_solver_input()->get_time();
+
+    if ( tTime.numel() != mFactorizedTime.numel() || !std::equal( tTime.data(), tTime.data() + tTime.numel(), mFactorizedTime.data() ) )
+    {
+        return false;
+    }
+
+    // not all Amesos solvers support transpose solves
+    if ( mAmesosSolver->SetUseTranspose( true ) != 0 )
+    {
+        MORIS_LOG_INFO( "Amesos: Solver does not support transpose solves, adjoint system will be factorized." );
+        return false;
+    }
+
+    MORIS_LOG_INFO( "Amesos: Solving adjoint system with transposed factorization of forward system." );
+
+    // start timer
+    tic tTimer;
+
+    // the forward matrix may have been freed, the problem refers to the adjoint matrix with the same layout
+    mEpetraProblem.SetOperator( tMatrix );
+
+    // all adjoint right hand sides are solved with one back substitution
+    mEpetraProblem.SetRHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_solver_RHS() )->get_epetra_vector() );
+    mEpetraProblem.SetLHS( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_free_solver_LHS() )->get_epetra_vector() );
+
+    sint error = mAmesosSolver->Solve();
+    MORIS_ERROR( error == 0, "Error in solving adjoint linear system with Amesos" );
+
+    mAmesosSolver->SetUseTranspose( false );
+
+    // compute exact residuals
+    if ( mParameterList.get< bool >( "ComputeTrueResidual" ) )
+    {
+        Matrix< DDRMat > tRelativeResidualNorm = aLinearSystem->compute_residual_of_linear_system();
+
+        for ( uint i = 0; i < tRelativeResidualNorm.numel(); i++ )
+        {
+            MORIS_LOG_SPEC( "LinearResidualNorm_RHS_" + std::to_string( i ), tRelativeResidualNorm( i ) );
+        }
+    }
+
+    mSolTime     = tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+    mSymFactTime = 0.0;
+    mNumFactTime = 0.0;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void
+Linear_Solver_Amesos::delete_factorization()
+{
     delete mAmesosSolver;
     mAmesosSolver = nullptr;
 
-    return error;
+    mFactorizedSystemSize = -1;
+    mFactorizedRowMap.reset();
+    mFactorizedTime.set_size( 0, 0 );
 }
 
 //-----------------------------------------------------------------------------
@@ -10,8 +10,11 @@
 
 #pragma once
 
+#include <memory>
+
 // TPL header files
 #include "Epetra_ConfigDefs.h"
+#include "Epetra_Map.h"
 #include "Amesos_ConfigDefs.h"
 
 #include "cl_DLA_Linear_Solver_Algorithm_Trilinos.hpp"
@@ -22,6 +25,8 @@
 
 namespace moris::dla
 {
+    // direct solvers of Amesos on Epetra matrices; the factorizations are computed in double precision only,
+    // a single precision preconditioner with iterative refinement is available with the native solver
     class Linear_Solver_Amesos : public Linear_Solver_Algorithm_Trilinos
     {
       private:
@@ -31,6 +36,11 @@ namespace moris::dla
 
         bool mIsPastFirstSolve;
 
+        // global size, row map and time slab of the forward system whose factorization is kept for one adjoint solve
+        long long                     mFactorizedSystemSize = -1;
+        std::unique_ptr< Epetra_Map > mFactorizedRowMap;
+        Matrix< DDRMat >              mFactorizedTime;
+
       protected:
 
       public:
@@ -48,5 +58,20 @@ namespace moris::dla
         moris::sint solve_linear_system( Linear_Problem* aLinearSystem, moris::sint aIter ) override;
 
         void set_solver_internal_parameters();
+
+        /**
+         * Solves an adjoint system with the transposed factorization of the last forward solve. The factorization
+         * is only used if the adjoint system has the row map and the time slab of the factorized forward system,
+         * and it is deleted after this solve.
+         *
+         * @param aLinearSystem adjoint linear problem
+         * @return false if the factorization cannot be used, e.g. because the solver does not support transpose solves
+         */
+        bool solve_with_forward_factorization( Linear_Problem* aLinearSystem );
+
+        /**
+         * Deletes the Amesos solver and its factorization
+         */
+        void delete_factorization();
     };
 }    // namespace moris::dla
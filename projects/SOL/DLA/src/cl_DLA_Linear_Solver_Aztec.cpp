@@ -23,6 +23,8 @@
 #include "Teuchos_RCPDecl.hpp"
 #include "Teuchos_ParameterList.hpp"
 
+#include "cl_Communication_Tools.hpp"
+
 // detailed logging
 #include "cl_Tracer.hpp"
 
@@ -125,6 +127,12 @@ Linear_Solver_Aztec::solve_linear_system()
     mSolScaledResidual = mAztecSolver->ScaledResidual();
     mSolTime           = mAztecSolver->SolveTime();
 
+    // report iterations to the preconditioner reuse policy
+    if ( tPreconditionerIsBuilt )
+    {
+        mPreconditioner->register_solve( mSolNumIters, max_all( mSolTime ) );
+    }
+
     // log linear solver iterations
     MORIS_LOG_SPEC( "LinearSolverIterations", mSolNumIters );
 
@@ -230,6 +238,12 @@ Linear_Solver_Aztec::solve_linear_system(
         MORIS_LOG_SPEC( "Condition Number of Operator: ", tStatus[ AZ_condnum ] );
     }
 
+    // report iterations to the preconditioner reuse policy
+    if ( tPreconditionerIsBuilt )
+    {
+        mPreconditioner->register_solve( mSolNumIters, max_all( mSolTime ) );
+    }
+
     // log linear solver iterations
     MORIS_LOG_SPEC( "LinearSolverIterations", mSolNumIters );
 
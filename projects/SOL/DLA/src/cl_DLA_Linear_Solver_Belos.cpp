@@ -17,6 +17,8 @@
 
 #include "cl_Tracer.hpp"
 #include "cl_Logger.hpp"
+#include "cl_Stopwatch.hpp"
+#include "cl_Communication_Tools.hpp"
 
 #include <Epetra_MultiVector.h>
 #include <Epetra_Operator.h>
@@ -90,6 +92,15 @@ Linear_Solver_Belos::solve_linear_system(
     RCP< Epetra_MultiVector > B =
             rcp( dynamic_cast< Vector_Epetra* >( aLinearSystem->get_solver_RHS() )->get_epetra_vector(), false );
 
+    // solve all right hand sides, e.g. of an adjoint analysis, in one block with block Krylov solvers
+    const std::string& tSolverType = mParameterList.get< std::string >( "Solver Type" );
+
+    if ( mParameterList.get< moris::sint >( "Block Size" ) == INT_MAX
+            && ( tSolverType == "Block GMRES" || tSolverType == "Block CG" || tSolverType == "Flexible GMRES" ) )
+    {
+        mMyPl->set( "Block Size", B->NumVectors() );
+    }
+
     // create linear problem
     RCP< Belos::LinearProblem< double, Epetra_MultiVector, Epetra_Operator > > problem =
             rcp( new Belos::LinearProblem< double, Epetra_MultiVector, Epetra_Operator >( A, X, B ) );
@@ -108,20 +119,50 @@ Linear_Solver_Belos::solve_linear_system(
     MORIS_ERROR( problem->setProblem(),
             "Linear_Solver_Belos::solve_linear_system - LinearProblem is not correctly set up.\n" );
 
-    // Create iterative solver.
-    SolverFactory< double, Epetra_MultiVector, Epetra_Operator > factory;
+    RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > solver;
+
+    // keep recycling solver and its subspace if the size and the distribution of the system have not changed
+    bool tKeepSubspace = this->uses_recycling_solver() && mParameterList.get< bool >( "Keep Recycled Subspace" );
+
+    if ( tKeepSubspace && !mRecyclingSolver.is_null() && A->NumGlobalRows64() == mRecycledSystemSize
+            && A->RowMap().SameAs( *mRecycledRowMap ) )
+    {
+        solver = mRecyclingSolver;
+
+        // apply the parameters of this solve, e.g. an updated block size
+        solver->setParameters( mMyPl );
 
-    RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > solver =
-            factory.create(
-                    mParameterList.get< std::string >( "Solver Type" ),
-                    mMyPl );
+        MORIS_LOG_INFO( "Belos: Reusing recycled subspace of previous solve." );
+    }
+    else
+    {
+        // Create iterative solver.
+        SolverFactory< double, Epetra_MultiVector, Epetra_Operator > factory;
+
+        solver = factory.create(
+                mParameterList.get< std::string >( "Solver Type" ),
+                mMyPl );
+
+        if ( tKeepSubspace )
+        {
+            mRecyclingSolver    = solver;
+            mRecycledSystemSize = A->NumGlobalRows64();
+            mRecycledRowMap     = rcp( new Epetra_Map( A->RowMap() ) );
+        }
+    }
 
     // Tell the solver what problem you want to solve.
     solver->setProblem( problem );
 
+    // start timer
+    tic tTimer;
+
     // Solve problem
     Belos::ReturnType tSolverConvergence = solver->solve();
 
+    // report iterations to the preconditioner reuse policy
+    mPreconditioner->register_solve( solver->getNumIters(), max_all( tTimer.toc< moris::chronos::milliseconds >().wall ) / 1000.0 );
+
     MORIS_LOG_SPEC( "IterativeSolverConverged", tSolverConvergence );
 
     // Ask the solver how many iterations the last solve() took.
@@ -178,4 +219,19 @@ Linear_Solver_Belos::set_solver_internal_parameters()
     {
         mMyPl->set( "Output Frequency", mParameterList.get< moris::real >( "Output Frequency" ) );
     }
+
+    if ( this->uses_recycling_solver() && mParameterList.get< moris::sint >( "Num Recycled Blocks" ) != INT_MAX )
+    {
+        mMyPl->set( "Num Recycled Blocks", mParameterList.get< moris::sint >( "Num Recycled Blocks" ) );
+    }
+}
+
+//---------------------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Belos::uses_recycling_solver()
+{
+    const std::string& tSolverType = mParameterList.get< std::string >( "Solver Type" );
+
+    return tSolverType == "Recycling GMRES" || tSolverType == "GCRODR" || tSolverType == "Recycling CG" || tSolverType == "RCG";
 }
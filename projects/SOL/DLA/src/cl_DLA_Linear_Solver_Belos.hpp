@@ -13,6 +13,7 @@
 
 // TPL header files
 #include "Epetra_ConfigDefs.h"
+#include "Epetra_Map.h"
 
 #include "cl_DLA_Linear_Solver_Algorithm_Trilinos.hpp"
 #include "fn_PRM_SOL_Parameters.hpp"
@@ -32,6 +33,13 @@ private:
 
     Teuchos::RCP< Teuchos::ParameterList > mMyPl;
 
+    // recycling solver kept alive between solves, holds the recycled subspace
+    Teuchos::RCP< Belos::SolverManager< double, Epetra_MultiVector, Epetra_Operator > > mRecyclingSolver;
+
+    // global size and row map of the linear systems the recycled subspace has been built for
+    long long                   mRecycledSystemSize = -1;
+    Teuchos::RCP< Epetra_Map > mRecycledRowMap;
+
 protected:
 public:
     Linear_Solver_Belos( const moris::Parameter_List& aParameterlist = prm::create_linear_algorithm_parameter_list_belos() );
@@ -48,6 +56,11 @@ public:
                                      const moris::sint     aIter ) override;
 
     void set_solver_internal_parameters();
+
+    /**
+     * returns true if the solver type recycles a subspace between solves
+     */
+    bool uses_recycling_solver();
 };
 }
 
@@ -0,0 +1,690 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Linear_Solver_Native.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "cl_DLA_Linear_Solver_Native.hpp"
+#include "cl_DLA_Preconditioner_Native.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_Sparse_Matrix_Native.hpp"
+#include "cl_Vector_Native.hpp"
+
+#include "moris_openmp.hpp"
+#include "cl_Stopwatch.hpp"    //CHR/src
+#include "cl_Communication_Tools.hpp"
+
+// detailed logging
+#include "cl_Tracer.hpp"
+
+using namespace moris;
+using namespace dla;
+
+namespace
+{
+    //----------------------------------------------------------------------------------------
+
+    real
+    norm(
+            sint        aLength,
+            const real* aX )
+    {
+        return std::sqrt( Vector_Native::local_dot( aLength, aX, aX ) );
+    }
+
+    //----------------------------------------------------------------------------------------
+
+    // aY = aAlpha * aX + aBeta * aY
+    void
+    axpby(
+            sint        aLength,
+            real        aAlpha,
+            const real* aX,
+            real        aBeta,
+            real*       aY )
+    {
+        MORIS_OMP_PRAGMA( omp parallel for simd )
+        for ( sint Ik = 0; Ik < aLength; Ik++ )
+        {
+            aY[ Ik ] = aAlpha * aX[ Ik ] + aBeta * aY[ Ik ];
+        }
+    }
+
+    //----------------------------------------------------------------------------------------
+
+    // aR = aB - aAX
+    void
+    residual(
+            sint        aLength,
+            const real* aB,
+            const real* aAX,
+            real*       aR )
+    {
+        MORIS_OMP_PRAGMA( omp parallel for simd )
+        for ( sint Ik = 0; Ik < aLength; Ik++ )
+        {
+            aR[ Ik ] = aB[ Ik ] - aAX[ Ik ];
+        }
+    }
+
+    //----------------------------------------------------------------------------------------
+}    // namespace
+
+//----------------------------------------------------------------------------------------
+
+Linear_Solver_Native::Linear_Solver_Native( const moris::Parameter_List& aParameterlist )
+        : Linear_Solver_Algorithm( aParameterlist )
+{
+    mMaxIter         = mParameterList.get< sint >( "Max_Iter" );
+    mTolerance       = mParameterList.get< real >( "Convergence_Tolerance" );
+    mOutputFrequency = mParameterList.get< sint >( "Output_Frequency" );
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Linear_Solver_Native::set_preconditioner( Preconditioner* aPreconditioner )
+{
+    mPreconditioner = dynamic_cast< Preconditioner_Native* >( aPreconditioner );
+
+    MORIS_ERROR( aPreconditioner == nullptr || mPreconditioner != nullptr,
+            "Linear_Solver_Native::set_preconditioner - native solvers require a native preconditioner." );
+}
+
+//----------------------------------------------------------------------------------------
+
+moris::sint
+Linear_Solver_Native::solve_linear_system()
+{
+    MORIS_ERROR( mLinearSystem != nullptr,
+            "Linear_Solver_Native::solve_linear_system - no linear problem set." );
+
+    return this->solve_linear_system( mLinearSystem, 1 );
+}
+
+//----------------------------------------------------------------------------------------
+
+moris::sint
+Linear_Solver_Native::solve_linear_system(
+        Linear_Problem*   aLinearSystem,
+        const moris::sint aIter )
+{
+    Tracer tTracer( "LinearSolver", "Native", "Solve" );
+
+    // set linear system
+    mLinearSystem = aLinearSystem;
+
+    mMatrix = dynamic_cast< Sparse_Matrix_Native* >( mLinearSystem->get_matrix() );
+
+    MORIS_ERROR( mMatrix != nullptr,
+            "Linear_Solver_Native::solve_linear_system - native solvers require a native matrix." );
+
+    // Get LHS and RHS vectors
+    sol::Dist_Vector* tRHS = mLinearSystem->get_solver_RHS();
+    sol::Dist_Vector* tLHS = mLinearSystem->get_free_solver_LHS();
+
+    // Determine the number of RHS and LHS
+    uint tNumRHS = tRHS->get_num_vectors();
+    uint tNumLHS = tLHS->get_num_vectors();
+
+    MORIS_ERROR( tNumRHS == tNumLHS, "Number of LHS does not match number of RHS" );
+
+    // build preconditioner, reused for all RHS
+    if ( mPreconditioner )
+    {
+        mPreconditioner->build( mLinearSystem, aIter );
+    }
+
+    std::string tMethod = mParameterList.get< std::string >( "Krylov_Method" );
+
+    sint tLength = tRHS->vec_local_length();
+
+    // start timer
+    tic tTimer;
+
+    // initialize error flag
+    moris::sint tError = 0;
+
+    // Loop over all RHS
+    for ( uint iRHS = 0; iRHS < tNumRHS; ++iRHS )
+    {
+        const real* tB = tRHS->get_values_pointer() + iRHS * tLength;
+        real*       tX = tLHS->get_values_pointer() + iRHS * tLength;
+
+        bool tConverged = this->solve( tMethod, tB, tX );
+
+        // fall back to double precision preconditioner, kept for the remaining RHS
+        if ( !tConverged && mPreconditioner && mPreconditioner->recompute_in_double_precision() )
+        {
+            MORIS_LOG_INFO( "Native %s did not converge with single precision preconditioner, repeating solve in double precision",
+                    tMethod.c_str() );
+
+            uint tNumItersSingle = mSolNumIters;
+
+            tConverged = this->solve( tMethod, tB, tX );
+
+            mSolNumIters += tNumItersSingle;
+        }
+
+        if ( !tConverged )
+        {
+            tError++;
+        }
+    }
+
+    mSolTime = tTimer.toc< moris::chronos::milliseconds >().wall / 1000.0;
+
+    // report iterations to the preconditioner reuse policy
+    if ( mPreconditioner )
+    {
+        mPreconditioner->register_solve( mSolNumIters, max_all( mSolTime ) );
+    }
+
+    // log linear solver iterations
+    MORIS_LOG_SPEC( "LinearSolverIterations", mSolNumIters );
+
+    // compute exact residuals
+    Matrix< DDRMat > tRelativeResidualNorm = mLinearSystem->compute_residual_of_linear_system();
+
+    for ( uint i = 0; i < tRelativeResidualNorm.numel(); i++ )
+    {
+        MORIS_LOG_SPEC( "LinearResidualNorm", tRelativeResidualNorm( i ) );
+    }
+
+    return tError;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Native::solve(
+        const std::string& aMethod,
+        const real*        aB,
+        real*              aX )
+{
+    if ( aMethod == "cg" )
+    {
+        return this->solve_cg( aB, aX );
+    }
+    else if ( aMethod == "bicgstab" )
+    {
+        return this->solve_bicgstab( aB, aX );
+    }
+    else if ( aMethod == "gmres" )
+    {
+        return this->solve_gmres( aB, aX );
+    }
+    else if ( aMethod == "refinement" )
+    {
+        return this->solve_refinement( aB, aX );
+    }
+
+    MORIS_ERROR( false, "Linear_Solver_Native - unknown Krylov method %s.", aMethod.c_str() );
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Linear_Solver_Native::apply_preconditioner(
+        const real* aX,
+        real*       aY ) const
+{
+    if ( mPreconditioner != nullptr && mPreconditioner->exists() )
+    {
+        mPreconditioner->apply( aX, aY );
+        return;
+    }
+
+    sint tLength = mMatrix->get_num_rows();
+
+    std::copy( aX, aX + tLength, aY );
+}
+
+//----------------------------------------------------------------------------------------
+
+void
+Linear_Solver_Native::log_residual(
+        uint aIter,
+        real aRelativeResidual ) const
+{
+    if ( mOutputFrequency > 0 && aIter % mOutputFrequency == 0 )
+    {
+        MORIS_LOG_INFO( "Native %s iteration %u: relative residual %e",
+                mParameterList.get< std::string >( "Krylov_Method" ).c_str(),
+                aIter,
+                aRelativeResidual );
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Native::solve_cg(
+        const real* aB,
+        real*       aX )
+{
+    sint tLength = mMatrix->get_num_rows();
+
+    Vector< real > tR( tLength );
+    Vector< real > tZ( tLength );
+    Vector< real > tP( tLength );
+    Vector< real > tAP( tLength );
+
+    real tNormB = norm( tLength, aB );
+
+    // zero RHS has zero solution
+    if ( tNormB == 0.0 )
+    {
+        std::fill( aX, aX + tLength, 0.0 );
+        mSolNumIters     = 0;
+        mSolTrueResidual = 0.0;
+        return true;
+    }
+
+    // r = b - A x
+    mMatrix->multiply( aX, tAP.memptr() );
+    residual( tLength, aB, tAP.memptr(), tR.memptr() );
+
+    this->apply_preconditioner( tR.memptr(), tZ.memptr() );
+
+    std::copy( tZ.begin(), tZ.end(), tP.begin() );
+
+    real tRZ = Vector_Native::local_dot( tLength, tR.memptr(), tZ.memptr() );
+
+    real tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+    sint iIter = 0;
+
+    while ( tRelRes > mTolerance && iIter < mMaxIter )
+    {
+        mMatrix->multiply( tP.memptr(), tAP.memptr() );
+
+        real tAlpha = tRZ / Vector_Native::local_dot( tLength, tP.memptr(), tAP.memptr() );
+
+        axpby( tLength, tAlpha, tP.memptr(), 1.0, aX );
+        axpby( tLength, -tAlpha, tAP.memptr(), 1.0, tR.memptr() );
+
+        iIter++;
+
+        tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+        this->log_residual( iIter, tRelRes );
+
+        if ( tRelRes <= mTolerance )
+        {
+            break;
+        }
+
+        this->apply_preconditioner( tR.memptr(), tZ.memptr() );
+
+        real tRZNew = Vector_Native::local_dot( tLength, tR.memptr(), tZ.memptr() );
+
+        axpby( tLength, 1.0, tZ.memptr(), tRZNew / tRZ, tP.memptr() );
+
+        tRZ = tRZNew;
+    }
+
+    mSolNumIters     = iIter;
+    mSolTrueResidual = tRelRes;
+
+    return tRelRes <= mTolerance;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Native::solve_bicgstab(
+        const real* aB,
+        real*       aX )
+{
+    sint tLength = mMatrix->get_num_rows();
+
+    Vector< real > tR( tLength );
+    Vector< real > tR0( tLength );
+    Vector< real > tP( tLength, 0.0 );
+    Vector< real > tV( tLength, 0.0 );
+    Vector< real > tPHat( tLength );
+    Vector< real > tSHat( tLength );
+    Vector< real > tT( tLength );
+
+    real tNormB = norm( tLength, aB );
+
+    // zero RHS has zero solution
+    if ( tNormB == 0.0 )
+    {
+        std::fill( aX, aX + tLength, 0.0 );
+        mSolNumIters     = 0;
+        mSolTrueResidual = 0.0;
+        return true;
+    }
+
+    // r = b - A x
+    mMatrix->multiply( aX, tT.memptr() );
+    residual( tLength, aB, tT.memptr(), tR.memptr() );
+
+    std::copy( tR.begin(), tR.end(), tR0.begin() );
+
+    real tRho   = 1.0;
+    real tAlpha = 1.0;
+    real tOmega = 1.0;
+
+    real tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+    sint iIter = 0;
+
+    while ( tRelRes > mTolerance && iIter < mMaxIter )
+    {
+        real tRhoNew = Vector_Native::local_dot( tLength, tR0.memptr(), tR.memptr() );
+
+        // breakdown
+        if ( tRhoNew == 0.0 )
+        {
+            break;
+        }
+
+        real tBeta = ( tRhoNew / tRho ) * ( tAlpha / tOmega );
+
+        // p = r + beta ( p - omega v )
+        axpby( tLength, -tOmega, tV.memptr(), 1.0, tP.memptr() );
+        axpby( tLength, 1.0, tR.memptr(), tBeta, tP.memptr() );
+
+        this->apply_preconditioner( tP.memptr(), tPHat.memptr() );
+
+        mMatrix->multiply( tPHat.memptr(), tV.memptr() );
+
+        tAlpha = tRhoNew / Vector_Native::local_dot( tLength, tR0.memptr(), tV.memptr() );
+
+        // s = r - alpha v, stored in r
+        axpby( tLength, -tAlpha, tV.memptr(), 1.0, tR.memptr() );
+
+        iIter++;
+
+        tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+        if ( tRelRes <= mTolerance )
+        {
+            axpby( tLength, tAlpha, tPHat.memptr(), 1.0, aX );
+
+            this->log_residual( iIter, tRelRes );
+            break;
+        }
+
+        this->apply_preconditioner( tR.memptr(), tSHat.memptr() );
+
+        mMatrix->multiply( tSHat.memptr(), tT.memptr() );
+
+        tOmega = Vector_Native::local_dot( tLength, tT.memptr(), tR.memptr() ) / Vector_Native::local_dot( tLength, tT.memptr(), tT.memptr() );
+
+        // x = x + alpha phat + omega shat
+        axpby( tLength, tAlpha, tPHat.memptr(), 1.0, aX );
+        axpby( tLength, tOmega, tSHat.memptr(), 1.0, aX );
+
+        // r = s - omega t
+        axpby( tLength, -tOmega, tT.memptr(), 1.0, tR.memptr() );
+
+        tRho = tRhoNew;
+
+        tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+        this->log_residual( iIter, tRelRes );
+
+        // breakdown
+        if ( tOmega == 0.0 )
+        {
+            break;
+        }
+    }
+
+    mSolNumIters     = iIter;
+    mSolTrueResidual = tRelRes;
+
+    return tRelRes <= mTolerance;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Native::solve_gmres(
+        const real* aB,
+        real*       aX )
+{
+    sint tLength  = mMatrix->get_num_rows();
+    sint tRestart = mParameterList.get< sint >( "GMRES_Restart" );
+
+    // Krylov basis and Hessenberg matrix
+    Vector< Vector< real > > tBasis( tRestart + 1, Vector< real >( tLength ) );
+
+    Matrix< DDRMat > tHessenberg( tRestart + 1, tRestart, 0.0 );
+    Matrix< DDRMat > tCos( tRestart, 1, 0.0 );
+    Matrix< DDRMat > tSin( tRestart, 1, 0.0 );
+    Matrix< DDRMat > tG( tRestart + 1, 1, 0.0 );
+    Matrix< DDRMat > tY( tRestart, 1, 0.0 );
+
+    Vector< real > tW( tLength );
+    Vector< real > tZ( tLength );
+
+    real tNormB = norm( tLength, aB );
+
+    // zero RHS has zero solution
+    if ( tNormB == 0.0 )
+    {
+        std::fill( aX, aX + tLength, 0.0 );
+        mSolNumIters     = 0;
+        mSolTrueResidual = 0.0;
+        return true;
+    }
+
+    real tRelRes = 1.0;
+
+    sint iIter = 0;
+
+    while ( iIter < mMaxIter )
+    {
+        // r = b - A x
+        mMatrix->multiply( aX, tW.memptr() );
+        residual( tLength, aB, tW.memptr(), tBasis( 0 ).memptr() );
+
+        real tBeta = norm( tLength, tBasis( 0 ).memptr() );
+
+        tRelRes = tBeta / tNormB;
+
+        if ( tRelRes <= mTolerance )
+        {
+            break;
+        }
+
+        for ( sint Ik = 0; Ik < tLength; Ik++ )
+        {
+            tBasis( 0 )( Ik ) /= tBeta;
+        }
+
+        tG.fill( 0.0 );
+        tG( 0 ) = tBeta;
+
+        sint tNumVectors = 0;
+
+        for ( sint j = 0; j < tRestart && iIter < mMaxIter; j++ )
+        {
+            // w = A M^-1 v_j
+            this->apply_preconditioner( tBasis( j ).memptr(), tZ.memptr() );
+            mMatrix->multiply( tZ.memptr(), tW.memptr() );
+
+            // modified Gram-Schmidt
+            for ( sint i = 0; i <= j; i++ )
+            {
+                tHessenberg( i, j ) = Vector_Native::local_dot( tLength, tW.memptr(), tBasis( i ).memptr() );
+                axpby( tLength, -tHessenberg( i, j ), tBasis( i ).memptr(), 1.0, tW.memptr() );
+            }
+
+            tHessenberg( j + 1, j ) = norm( tLength, tW.memptr() );
+
+            if ( tHessenberg( j + 1, j ) != 0.0 )
+            {
+                axpby( tLength, 1.0 / tHessenberg( j + 1, j ), tW.memptr(), 0.0, tBasis( j + 1 ).memptr() );
+            }
+
+            // apply previous Givens rotations to new column
+            for ( sint i = 0; i < j; i++ )
+            {
+                real tUpper = tHessenberg( i, j );
+                real tLower = tHessenberg( i + 1, j );
+
+                tHessenberg( i, j )     = tCos( i ) * tUpper + tSin( i ) * tLower;
+                tHessenberg( i + 1, j ) = -tSin( i ) * tUpper + tCos( i ) * tLower;
+            }
+
+            // new rotation eliminating the subdiagonal entry
+            real tDenominator = std::hypot( tHessenberg( j, j ), tHessenberg( j + 1, j ) );
+
+            tCos( j ) = tDenominator != 0.0 ? tHessenberg( j, j ) / tDenominator : 1.0;
+            tSin( j ) = tDenominator != 0.0 ? tHessenberg( j + 1, j ) / tDenominator : 0.0;
+
+            tHessenberg( j, j )     = tDenominator;
+            tHessenberg( j + 1, j ) = 0.0;
+
+            tG( j + 1 ) = -tSin( j ) * tG( j );
+            tG( j )     = tCos( j ) * tG( j );
+
+            iIter++;
+            tNumVectors++;
+
+            tRelRes = std::abs( tG( j + 1 ) ) / tNormB;
+
+            this->log_residual( iIter, tRelRes );
+
+            if ( tRelRes <= mTolerance )
+            {
+                break;
+            }
+        }
+
+        // solve upper triangular system H y = g
+        for ( sint i = tNumVectors - 1; i >= 0; i-- )
+        {
+            real tSum = tG( i );
+
+            for ( sint k = i + 1; k < tNumVectors; k++ )
+            {
+                tSum -= tHessenberg( i, k ) * tY( k );
+            }
+
+            tY( i ) = tSum / tHessenberg( i, i );
+        }
+
+        // x = x + M^-1 V y
+        std::fill( tW.begin(), tW.end(), 0.0 );
+
+        for ( sint i = 0; i < tNumVectors; i++ )
+        {
+            axpby( tLength, tY( i ), tBasis( i ).memptr(), 1.0, tW.memptr() );
+        }
+
+        this->apply_preconditioner( tW.memptr(), tZ.memptr() );
+
+        axpby( tLength, 1.0, tZ.memptr(), 1.0, aX );
+
+        if ( tRelRes <= mTolerance )
+        {
+            break;
+        }
+    }
+
+    mSolNumIters     = iIter;
+    mSolTrueResidual = tRelRes;
+
+    return tRelRes <= mTolerance;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool
+Linear_Solver_Native::solve_refinement(
+        const real* aB,
+        real*       aX )
+{
+    sint tLength = mMatrix->get_num_rows();
+
+    real tStallRatio = mParameterList.get< real >( "Refinement_Stall_Ratio" );
+
+    Vector< real > tR( tLength );
+    Vector< real > tD( tLength );
+    Vector< real > tAX( tLength );
+
+    real tNormB = norm( tLength, aB );
+
+    // zero RHS has zero solution
+    if ( tNormB == 0.0 )
+    {
+        std::fill( aX, aX + tLength, 0.0 );
+        mSolNumIters     = 0;
+        mSolTrueResidual = 0.0;
+        return true;
+    }
+
+    // r = b - A x
+    mMatrix->multiply( aX, tAX.memptr() );
+    residual( tLength, aB, tAX.memptr(), tR.memptr() );
+
+    real tRelRes = norm( tLength, tR.memptr() ) / tNormB;
+
+    sint iIter = 0;
+
+    while ( tRelRes > mTolerance && iIter < mMaxIter )
+    {
+        // correction with the preconditioner, residual with the double precision matrix
+        this->apply_preconditioner( tR.memptr(), tD.memptr() );
+
+        axpby( tLength, 1.0, tD.memptr(), 1.0, aX );
+
+        mMatrix->multiply( aX, tAX.memptr() );
+        residual( tLength, aB, tAX.memptr(), tR.memptr() );
+
+        iIter++;
+
+        real tRelResNew = norm( tLength, tR.memptr() ) / tNormB;
+
+        this->log_residual( iIter, tRelResNew );
+
+        if ( tRelResNew <= mTolerance || tRelResNew <= tStallRatio * tRelRes )
+        {
+            tRelRes = tRelResNew;
+            continue;
+        }
+
+        // discard a correction which increased the residual
+        if ( tRelResNew > tRelRes )
+        {
+            axpby( tLength, -1.0, tD.memptr(), 1.0, aX );
+        }
+
+        MORIS_LOG_INFO( "Native refinement stalled after %d iterations, continuing with GMRES", iIter );
+
+        // GMRES with the remaining iterations on the double precision matrix
+        sint tMaxIter = mMaxIter;
+        mMaxIter      = std::max< sint >( tMaxIter - iIter, 1 );
+
+        bool tConverged = this->solve_gmres( aB, aX );
+
+        mMaxIter = tMaxIter;
+
+        mSolNumIters += iIter;
+
+        return tConverged;
+    }
+
+    mSolNumIters     = iIter;
+    mSolTrueResidual = tRelRes;
+
+    return tRelRes <= mTolerance;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Linear_Solver_Native.hpp
+ *
+ */
+
+#pragma once
+
+#include "cl_DLA_Linear_Solver_Algorithm.hpp"
+#include "fn_PRM_SOL_Parameters.hpp"
+
+namespace moris
+{
+    class Sparse_Matrix_Native;
+
+    namespace dla
+    {
+        class Linear_Problem;
+        class Preconditioner_Native;
+
+        /**
+         * @brief Krylov solvers of the built-in linear algebra backend
+         *
+         * Provides preconditioned CG, right-preconditioned BiCGStab and restarted GMRES on
+         * native CSR matrices. Multiple right hand sides are solved one after another.
+         *
+         * Mixed precision solves combine a single precision preconditioner with residuals of the double
+         * precision matrix, either within the Krylov methods or by iterative refinement, which continues
+         * with GMRES if it stalls. If a solve fails with a single precision preconditioner, the
+         * preconditioner is recomputed in double precision and the solve is repeated.
+         *
+         * Mixed precision is restricted to this backend, i.e. to serial runs with the Jacobi and ILU(0)
+         * preconditioners. The direct solvers of Amesos and PETSc always factorize in double precision, as
+         * Epetra and our PETSc builds only provide double precision scalars.
+         */
+        class Linear_Solver_Native : public Linear_Solver_Algorithm
+        {
+          private:
+            Preconditioner_Native* mPreconditioner = nullptr;
+
+            // operator of current solve
+            const Sparse_Matrix_Native* mMatrix = nullptr;
+
+            sint mMaxIter;
+            real mTolerance;
+            sint mOutputFrequency;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief applies the preconditioner or copies if none is set
+             */
+            void apply_preconditioner(
+                    const real* aX,
+                    real*       aY ) const;
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief Krylov methods on raw arrays of local length
+             *
+             * @param[ in ]    aB RHS
+             * @param[ inout ] aX initial guess on input, solution on output
+             *
+             * @return true if converged
+             */
+            bool solve_cg(
+                    const real* aB,
+                    real*       aX );
+
+            bool solve_bicgstab(
+                    const real* aB,
+                    real*       aX );
+
+            bool solve_gmres(
+                    const real* aB,
+                    real*       aX );
+
+            bool solve_refinement(
+                    const real* aB,
+                    real*       aX );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * @brief solves with the Krylov method given in the parameter list
+             *
+             * @return true if converged
+             */
+            bool solve(
+                    const std::string& aMethod,
+                    const real*        aB,
+                    real*              aX );
+
+            //------------------------------------------------------------------------------
+
+            void log_residual(
+                    uint aIter,
+                    real aRelativeResidual ) const;
+
+          public:
+            //------------------------------------------------------------------------------
+
+            Linear_Solver_Native( const moris::Parameter_List& aParameterlist = prm::create_linear_algorithm_parameter_list_native() );
+
+            //------------------------------------------------------------------------------
+
+            ~Linear_Solver_Native() override = default;
+
+            //------------------------------------------------------------------------------
+
+            moris::sint solve_linear_system() override;
+
+            //------------------------------------------------------------------------------
+
+            moris::sint solve_linear_system(
+                    Linear_Problem*   aLinearSystem,
+                    const moris::sint aIter = 1 ) override;
+
+            //------------------------------------------------------------------------------
+
+            void set_preconditioner( Preconditioner* aPreconditioner ) override;
+        };
+    }    // namespace dla
+}    // namespace moris
@@ -18,8 +18,11 @@
 #include "petscmat.h"
 
 #include <string>
+#include <algorithm>
 
 #include "cl_Tracer.hpp"
+#include "cl_Stopwatch.hpp"    // CHR/src
+#include "cl_Communication_Tools.hpp"    // COM/src
 
 #ifdef MORIS_HAVE_SLEPC
 #include <slepceps.h>
@@ -54,8 +57,10 @@ Linear_Solver_PETSc::Linear_Solver_PETSc( Linear_Problem *aLinearSystem )
 //----------------------------------------------------------------------------------------
 Linear_Solver_PETSc::~Linear_Solver_PETSc()
 {
-    // KSPDestroy(&mPetscKSPProblem);
-    //    PCDestroy(&mpc);
+    if ( mKSPIsSetUp )
+    {
+        KSPDestroy( &mPetscKSPProblem );
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -75,19 +80,51 @@ Linear_Solver_PETSc::solve_linear_system(
 {
     Tracer tTracer( "LinearSolver", "PETSc", "Solve" );
 
-    // Create KSP
-    KSPCreate( PETSC_COMM_WORLD, &mPetscKSPProblem );
-
-    // Set matrices for linear system and for preconditioner
-    KSPSetOperators( mPetscKSPProblem,
-            aLinearSystem->get_matrix()->get_petsc_matrix(),
-            aLinearSystem->get_matrix()->get_petsc_matrix() );
+    Mat tOperator = aLinearSystem->get_matrix()->get_petsc_matrix();
 
     // set solver interface (used by preconditioners)
     mSolverInterface = aLinearSystem->get_solver_input();
 
-    // construct solver and preconditioner
-    this->construct_solver_and_preconditioner( aLinearSystem );
+    // check whether solver and preconditioner of the previous solve can be reused; the matrix address is not
+    // used as the key since a new linear problem may get the address of a destroyed one
+    uint tOperatorId = aLinearSystem->get_operator_id();
+
+    bool tReusePreconditioner = mPreconditioner != nullptr
+                             && mPreconditioner->get_update_type( aIter, mKSPIsSetUp && tOperatorId == mOperatorId ) == Preconditioner_Update::REUSE;
+
+    if ( tReusePreconditioner )
+    {
+        // bind the current operator, but skip the numeric setup of the preconditioner
+        KSPSetOperators( mPetscKSPProblem, tOperator, tOperator );
+        KSPSetReusePreconditioner( mPetscKSPProblem, PETSC_TRUE );
+    }
+    else
+    {
+        if ( mKSPIsSetUp )
+        {
+            KSPDestroy( &mPetscKSPProblem );
+        }
+
+        tic tTimer;
+
+        // Create KSP
+        KSPCreate( PETSC_COMM_WORLD, &mPetscKSPProblem );
+
+        // Set matrices for linear system and for preconditioner
+        KSPSetOperators( mPetscKSPProblem, tOperator, tOperator );
+
+        // construct solver and preconditioner
+        this->construct_solver_and_preconditioner( aLinearSystem );
+
+        mKSPIsSetUp = true;
+        mOperatorId = tOperatorId;
+
+        if ( mPreconditioner != nullptr )
+        {
+            real tElapsedTime = tTimer.toc< moris::chronos::milliseconds >().wall;
+            mPreconditioner->set_setup_time( max_all( tElapsedTime ) / 1000.0 );
+        }
+    }
 
     // for debugging: print matrix, rhs, and lhs
     // MatView( aLinearSystem->get_matrix()->get_petsc_matrix(), PETSC_VIEWER_STDOUT_WORLD );
@@ -99,7 +136,30 @@ Linear_Solver_PETSc::solve_linear_system(
     Mat tRHSVecs = static_cast< MultiVector_PETSc* >( aLinearSystem->get_solver_RHS() )->get_petsc_vector();
     Mat tLHSVecs = static_cast< MultiVector_PETSc* >( aLinearSystem->get_free_solver_LHS() )->get_petsc_vector();
 
-    for ( uint iNumRHS = 0; iNumRHS < mSolverInterface->get_num_rhs(); iNumRHS++ )
+    tic tSolveTimer;
+
+    PetscInt tNumIterations = 0;
+
+    uint tNumRHS = mSolverInterface->get_num_rhs();
+
+    // solve multiple right hand sides, e.g. of an adjoint analysis, as one block; direct solvers perform
+    // a single multi right hand side back substitution, block Krylov methods share the Krylov space
+    if ( tNumRHS > 1 && mParameterList.get< bool >( "block_solve_multiple_rhs" ) )
+    {
+        MatAssemblyBegin( tRHSVecs, MAT_FINAL_ASSEMBLY );
+        MatAssemblyEnd( tRHSVecs, MAT_FINAL_ASSEMBLY );
+        MatAssemblyBegin( tLHSVecs, MAT_FINAL_ASSEMBLY );
+        MatAssemblyEnd( tLHSVecs, MAT_FINAL_ASSEMBLY );
+
+        KSPMatSolve( mPetscKSPProblem, tRHSVecs, tLHSVecs );
+
+        KSPGetIterationNumber( mPetscKSPProblem, &tNumIterations );
+
+        // all right hand sides have been solved
+        tNumRHS = 0;
+    }
+
+    for ( uint iNumRHS = 0; iNumRHS < tNumRHS; iNumRHS++ )
     {
         Vec tRHSVec, tLHSVec;
         MatDenseGetColumnVec( tRHSVecs, iNumRHS, &tRHSVec );
@@ -111,6 +171,11 @@ Linear_Solver_PETSc::solve_linear_system(
         VecAssemblyEnd( tLHSVec );
 
         KSPSolve( mPetscKSPProblem,tRHSVec,tLHSVec );
+
+        PetscInt tRHSIterations;
+        KSPGetIterationNumber( mPetscKSPProblem, &tRHSIterations );
+        tNumIterations = std::max( tNumIterations, tRHSIterations );
+
         MatDenseRestoreColumnVec( tRHSVecs, iNumRHS, &tRHSVec );
         MatDenseRestoreColumnVec( tLHSVecs, iNumRHS, &tLHSVec );
     }
@@ -120,7 +185,17 @@ Linear_Solver_PETSc::solve_linear_system(
 
     mSolverInterface = nullptr;
 
-    KSPDestroy( &mPetscKSPProblem );
+    if ( mPreconditioner != nullptr && mPreconditioner->uses_adaptive_reuse() )
+    {
+        real tSolveTime = tSolveTimer.toc< moris::chronos::milliseconds >().wall;
+        mPreconditioner->register_solve( tNumIterations, max_all( tSolveTime ) / 1000.0 );
+    }
+    else
+    {
+        // solver is only kept alive for the adaptive reuse of the preconditioner
+        KSPDestroy( &mPetscKSPProblem );
+        mKSPIsSetUp = false;
+    }
 
     return 0;
 }
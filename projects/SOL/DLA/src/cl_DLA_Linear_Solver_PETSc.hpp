@@ -30,6 +30,12 @@ namespace moris::dla
       private:
         KSP mPetscKSPProblem;
 
+        // solver is kept alive between solves if the preconditioner is reused
+        bool mKSPIsSetUp = false;
+
+        // identity of the linear problem operator the preconditioner has been set up for
+        uint mOperatorId = 0;
+
         Vector< KSP > tKSPBlock;
 
       protected:
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Linear_System_Native.cpp
+ *
+ */
+
+#include "cl_DLA_Linear_System_Native.hpp"
+#include "cl_DLA_Linear_Solver_Native.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_SOL_Enums.hpp"
+
+#include "cl_Stopwatch.hpp"    //CHR/src
+
+// detailed logging package
+#include "cl_Tracer.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//----------------------------------------------------------------------------------------
+
+Linear_System_Native::Linear_System_Native( Solver_Interface* aInput )
+        : moris::dla::Linear_Problem( aInput )
+{
+    mTplType = sol::MapType::Native;
+
+    MORIS_ERROR( par_size() == 1,
+            "Linear_System_Native - the native linear algebra backend does not support parallel runs." );
+
+    MORIS_ERROR( aInput->get_matrix_market_path() == nullptr,
+            "Linear_System_Native - reading linear systems from matrix market files is not supported." );
+
+    sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Native );
+
+    // create map object
+    mMapFree = tMatFactory.create_map(
+            aInput->get_my_local_global_map(),
+            aInput->get_constrained_Ids() );
+
+    mMap = tMatFactory.create_full_map(
+            aInput->get_my_local_global_map(),
+            aInput->get_my_local_global_overlapping_map() );
+
+    mMapFree->build_dof_translator( aInput->get_my_local_global_overlapping_map(), false );
+
+    // Build matrix
+    mMat = tMatFactory.create_matrix( aInput, mMapFree, true, true );
+
+    uint tNumRHS = aInput->get_num_rhs();
+
+    // Build RHS/LHS vector
+    mFreeVectorLHS = tMatFactory.create_vector( aInput, mMapFree, tNumRHS );
+
+    mPointVectorRHS = tMatFactory.create_vector( aInput, mMapFree, tNumRHS, true );
+    mPointVectorLHS = tMatFactory.create_vector( aInput, mMapFree, tNumRHS, true );
+
+    mFullVectorLHS = tMatFactory.create_vector( aInput, mMap, tNumRHS );
+
+    // start timer
+    tic tTimer;
+
+    mSolverInterface->build_graph( mMat );
+
+    real tElapsedTime = tTimer.toc< moris::chronos::milliseconds >().wall;
+    MORIS_LOG_INFO( "Building matrix graph on processor %u took %5.3f seconds.", (uint)par_rank(), (double)tElapsedTime / 1000 );
+}
+
+//----------------------------------------------------------------------------------------
+
+Linear_System_Native::Linear_System_Native(
+        Solver_Interface*   aInput,
+        sol::SOL_Warehouse* aSolverWarehouse,
+        sol::Dist_Map*      aFreeMap,
+        sol::Dist_Map*      aFullMap )
+        : moris::dla::Linear_Problem( aInput )
+{
+    mTplType         = sol::MapType::Native;
+
+    MORIS_ERROR( par_size() == 1,
+            "Linear_System_Native - the native linear algebra backend does not support parallel runs." );
+    mSolverWarehouse = aSolverWarehouse;
+    sol::Matrix_Vector_Factory tMatFactory( mTplType );
+
+    aFreeMap->build_dof_translator( aInput->get_my_local_global_overlapping_map(), false );
+
+    // Build matrix
+    mMat = tMatFactory.create_matrix( aInput, aFreeMap, true, true );
+
+    uint tNumRHS = aInput->get_num_rhs();
+
+    // Build RHS/LHS vector
+    mFreeVectorLHS = tMatFactory.create_vector( aInput, aFreeMap, tNumRHS );
+
+    mPointVectorRHS = tMatFactory.create_vector( aInput, aFreeMap, tNumRHS, true );
+    mPointVectorLHS = tMatFactory.create_vector( aInput, aFreeMap, tNumRHS, true );
+
+    mFullVectorLHS = tMatFactory.create_vector( aInput, aFullMap, tNumRHS );
+
+    // start timer
+    tic tTimer;
+
+    mSolverInterface->build_graph( mMat );
+
+    real tElapsedTime = tTimer.toc< moris::chronos::milliseconds >().wall;
+    MORIS_LOG_INFO( "Building matrix graph on processor %u took %5.3f seconds.", (uint)par_rank(), (double)tElapsedTime / 1000 );
+}
+
+//----------------------------------------------------------------------------------------
+
+Linear_System_Native::~Linear_System_Native()
+{
+    delete mMat;
+    mMat = nullptr;
+
+    delete mMassMat;
+    mMassMat = nullptr;
+
+    delete mFreeVectorLHS;
+    mFreeVectorLHS = nullptr;
+
+    delete mFullVectorLHS;
+    mFullVectorLHS = nullptr;
+
+    delete mPointVectorLHS;
+    mPointVectorLHS = nullptr;
+
+    delete mPointVectorRHS;
+    mPointVectorRHS = nullptr;
+
+    delete mMap;
+    delete mMapFree;
+}
+
+//------------------------------------------------------------------------------------------
+
+moris::sint
+Linear_System_Native::solve_linear_system()
+{
+    // solve with default GMRES settings
+    Linear_Solver_Native tSolver;
+
+    return tSolver.solve_linear_system( this );
+}
+
+//------------------------------------------------------------------------------------------
+
+void
+Linear_System_Native::get_solution( Matrix< DDRMat >& LHSValues )
+{
+    mPointVectorLHS->extract_copy( LHSValues );
+}
+
+//------------------------------------------------------------------------------------------
+
+void
+Linear_System_Native::construct_rhs_matrix()
+{
+    // delete the previous mass matrix if it exits
+    if ( mMassMat != nullptr )
+    {
+        delete mMassMat;
+        mMassMat = nullptr;
+    }
+
+    sol::Matrix_Vector_Factory tMatFactory( mSolverWarehouse->get_tpl_type() );
+
+    // Build matrix
+    mMassMat = tMatFactory.create_matrix( mSolverInterface, mMat->get_map(), true, true );
+
+    mSolverInterface->build_graph( mMassMat );
+}
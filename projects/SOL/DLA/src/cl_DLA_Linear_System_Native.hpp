@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Linear_System_Native.hpp
+ *
+ */
+
+#pragma once
+
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_SOL_Dist_Map.hpp"
+#include "cl_SOL_Warehouse.hpp"
+
+namespace moris::dla
+{
+    /**
+     * @brief linear problem assembled into the built-in CSR matrix and vectors
+     *
+     * The native backend is single-rank; construction fails when running on more than one processor.
+     */
+    class Linear_System_Native : public Linear_Problem
+    {
+      public:
+        Linear_System_Native( Solver_Interface* aInput );
+
+        Linear_System_Native(
+                Solver_Interface*   aInput,
+                sol::SOL_Warehouse* aSolverWarehouse,
+                sol::Dist_Map*      aMap,
+                sol::Dist_Map*      aFullMap );
+
+        ~Linear_System_Native() override;
+
+        moris::sint solve_linear_system() override;
+
+        void get_solution( Matrix< DDRMat >& LHSValues ) override;
+
+        void construct_rhs_matrix() override;
+    };
+}    // namespace moris::dla
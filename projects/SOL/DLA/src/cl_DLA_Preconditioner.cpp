@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include "cl_DLA_Preconditioner.hpp"
+#include "cl_Logger.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//-------------------------------------------------------------------------------
+
+Preconditioner_Update
+Preconditioner::get_update_type(
+        sint aIter,
+        bool aIsBuilt )
+{
+    // default policy: rebuild in first nonlinear iteration, then recompute or rebuild
+    if ( !this->uses_adaptive_reuse() )
+    {
+        if ( !aIsBuilt || aIter == 1 || !mParameterList.get< bool >( "prec_reuse" ) )
+        {
+            return Preconditioner_Update::REBUILD;
+        }
+
+        return Preconditioner_Update::RECOMPUTE;
+    }
+
+    // adaptive policy: keep the preconditioner until the reuse criteria request a rebuild
+    if ( !aIsBuilt || mRebuildRequested )
+    {
+        return Preconditioner_Update::REBUILD;
+    }
+
+    MORIS_LOG_INFO( "SOL: Reusing preconditioner, %u solves since last setup.", mNumSolvesSinceSetup );
+
+    return Preconditioner_Update::REUSE;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner::set_setup_time( real aSetupTime )
+{
+    mSetupTime           = aSetupTime;
+    mExcessSolveTime     = 0.0;
+    mReferenceIterations = 0;
+    mNumSolvesSinceSetup = 0;
+    mRebuildRequested    = false;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner::register_solve(
+        uint aNumIterations,
+        real aSolveTime )
+{
+    if ( !this->uses_adaptive_reuse() )
+    {
+        return;
+    }
+
+    mNumSolvesSinceSetup++;
+
+    // the first solve after a setup defines the reference iteration count
+    if ( mNumSolvesSinceSetup == 1 )
+    {
+        mReferenceIterations = std::max( aNumIterations, 1u );
+        return;
+    }
+
+    // accumulate the time spent on iterations beyond the reference
+    if ( aNumIterations > mReferenceIterations )
+    {
+        mExcessSolveTime += aSolveTime * ( aNumIterations - mReferenceIterations ) / aNumIterations;
+    }
+
+    real tIterationGrowth = mParameterList.get< real >( "prec_rebuild_iteration_growth" );
+    sint tMaxReuses       = mParameterList.get< sint >( "prec_max_reuses" );
+
+    if ( aNumIterations > ( 1.0 + tIterationGrowth ) * mReferenceIterations )
+    {
+        MORIS_LOG_INFO( "SOL: Krylov iterations grew from %u to %u, preconditioner will be rebuilt.",
+                mReferenceIterations,
+                aNumIterations );
+
+        mRebuildRequested = true;
+    }
+    else if ( mExcessSolveTime > mSetupTime )
+    {
+        MORIS_LOG_INFO( "SOL: Additional Krylov iterations took %5.3f seconds, more than the setup (%5.3f seconds), preconditioner will be rebuilt.",
+                mExcessSolveTime,
+                mSetupTime );
+
+        mRebuildRequested = true;
+    }
+    else if ( tMaxReuses > 0 && mNumSolvesSinceSetup > (uint)tMaxReuses )
+    {
+        MORIS_LOG_INFO( "SOL: Preconditioner has been reused %u times, preconditioner will be rebuilt.",
+                mNumSolvesSinceSetup - 1 );
+
+        mRebuildRequested = true;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+bool
+Preconditioner::uses_adaptive_reuse() const
+{
+    const std::string& tPolicy = mParameterList.get< std::string >( "prec_reuse_policy" );
+
+    MORIS_ERROR( tPolicy == "default" || tPolicy == "adaptive",
+            "Preconditioner::uses_adaptive_reuse - unknown reuse policy %s, use default or adaptive.\n",
+            tPolicy.c_str() );
+
+    return tPolicy == "adaptive";
+}
+
+//-------------------------------------------------------------------------------
@@ -15,6 +15,15 @@
 
 namespace moris::dla
 {
+    /**
+     * Action to take on the preconditioner before a linear solve
+     */
+    enum class Preconditioner_Update
+    {
+        REBUILD,      // initialize and compute the preconditioner from scratch
+        RECOMPUTE,    // keep the structure, recompute the preconditioner for the current matrix values
+        REUSE         // keep the preconditioner of a previous solve as is
+    };
 
     class Preconditioner
     {
@@ -23,6 +32,20 @@ namespace moris::dla
         Linear_Problem* mLinearSystem = nullptr;
         const Parameter_List& mParameterList;
 
+      private:
+        // adaptive reuse: Krylov iterations of the first solve after the last setup
+        uint mReferenceIterations = 0;
+
+        // adaptive reuse: number of solves the current setup has been used for
+        uint mNumSolvesSinceSetup = 0;
+
+        // adaptive reuse: wall time of the last setup and solve time spent on additional iterations since then
+        real mSetupTime       = 0.0;
+        real mExcessSolveTime = 0.0;
+
+        // adaptive reuse: flag that the setup has to be rebuilt before the next solve
+        bool mRebuildRequested = true;
+
       public:
 
         /**
@@ -55,5 +78,46 @@ namespace moris::dla
         virtual bool exists() { return mIsInitialized; };
 
         //-------------------------------------------------------------------------------
+
+        /**
+         * Determines what has to be done with the preconditioner before the next solve. With the default
+         * policy, the preconditioner is rebuilt in the first iteration of a nonlinear solve and recomputed
+         * or rebuilt in later iterations, depending on "prec_reuse". With the adaptive policy, an existing
+         * preconditioner is reused across Newton iterations and time steps until register_solve()
+         * detects that the Krylov iterations have grown too much.
+         *
+         * @param aIter nonlinear iteration index
+         * @param aIsBuilt whether a preconditioner for the current operator exists
+         * @return update to perform
+         */
+        Preconditioner_Update get_update_type( sint aIter, bool aIsBuilt );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Stores the wall time of a setup, has to be called after each rebuild
+         *
+         * @param aSetupTime setup time in seconds, maximum over all processors
+         */
+        void set_setup_time( real aSetupTime );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * Feeds the result of a linear solve with this preconditioner back to the reuse policy
+         *
+         * @param aNumIterations number of Krylov iterations
+         * @param aSolveTime solve time in seconds, maximum over all processors
+         */
+        void register_solve( uint aNumIterations, real aSolveTime );
+
+        //-------------------------------------------------------------------------------
+
+        /**
+         * returns true if the adaptive reuse policy is used
+         */
+        bool uses_adaptive_reuse() const;
+
+        //-------------------------------------------------------------------------------
     };
-}    // namespace dla
+}    // namespace moris::dla
@@ -0,0 +1,498 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_Native.cpp
+ *
+ */
+
+#include <cmath>
+
+#include "cl_DLA_Preconditioner_Native.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+#include "cl_Sparse_Matrix_Native.hpp"
+
+#include "moris_openmp.hpp"
+#include "cl_Tracer.hpp"
+#include "cl_Stopwatch.hpp"
+#include "cl_Communication_Tools.hpp"
+
+using namespace moris;
+using namespace dla;
+
+//-------------------------------------------------------------------------------
+
+Preconditioner_Native::Preconditioner_Native( const Parameter_List& aParameterList )
+        : Preconditioner( aParameterList )
+{
+    std::string tType = mParameterList.get< std::string >( "native_prec_type" );
+
+    // no preconditioner defined
+    if ( tType.empty() )
+    {
+        mIsInitialized = false;
+        return;
+    }
+
+    if ( tType == "jacobi" )
+    {
+        mType = Native_Prec_Type::JACOBI;
+    }
+    else if ( tType == "ilu0" )
+    {
+        mType = Native_Prec_Type::ILU0;
+    }
+    else if ( tType == "chebyshev" )
+    {
+        mType = Native_Prec_Type::CHEBYSHEV;
+    }
+    else
+    {
+        MORIS_ERROR( false, "Preconditioner_Native - unknown preconditioner type %s.", tType.c_str() );
+    }
+
+    std::string tPrecision = mParameterList.get< std::string >( "native_prec_precision" );
+
+    MORIS_ERROR( tPrecision == "double" || tPrecision == "single",
+            "Preconditioner_Native - unknown precision %s.", tPrecision.c_str() );
+
+    mRequestSinglePrecision = tPrecision == "single";
+
+    MORIS_ERROR( !mRequestSinglePrecision || mType != Native_Prec_Type::CHEBYSHEV,
+            "Preconditioner_Native - single precision is only supported for jacobi and ilu0." );
+
+    mIsInitialized = true;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Native::build( Linear_Problem* aProblem, const sint& aIter )
+{
+    // check if preconditioner is initialized; if not do nothing
+    if ( !mIsInitialized )
+    {
+        return;
+    }
+
+    mLinearSystem = aProblem;
+
+    const Sparse_Matrix_Native* tMatrix = dynamic_cast< Sparse_Matrix_Native* >( aProblem->get_matrix() );
+
+    MORIS_ERROR( tMatrix != nullptr,
+            "Preconditioner_Native::build - native preconditioners require a native matrix." );
+
+    // a preconditioner can only be kept for the operator of the same linear problem
+    uint tOperatorId = aProblem->get_operator_id();
+
+    bool tIsBuilt = mOperatorId != 0 && tOperatorId == mOperatorId;
+
+    // always refer to the current matrix, e.g. for a later recompute in double precision
+    mMatrix = tMatrix;
+
+    // keep preconditioner of previous solve if reuse is requested; native preconditioners have no
+    // separate symbolic setup, so a recompute keeps the previous preconditioner as well
+    if ( this->get_update_type( aIter, tIsBuilt ) != Preconditioner_Update::REBUILD )
+    {
+        return;
+    }
+
+    Tracer tTracer( "Preconditioner", "Native", "Build" );
+
+    // start timer
+    tic tTimer;
+
+    mOperatorId = tOperatorId;
+
+    mSinglePrecision = mRequestSinglePrecision;
+
+    this->compute();
+
+    // store setup time for reuse policy
+    this->set_setup_time( max_all( tTimer.toc< moris::chronos::milliseconds >().wall ) / 1000.0 );
+}
+
+//-------------------------------------------------------------------------------
+
+bool
+Preconditioner_Native::recompute_in_double_precision()
+{
+    if ( !mSinglePrecision || mMatrix == nullptr )
+    {
+        return false;
+    }
+
+    Tracer tTracer( "Preconditioner", "Native", "Recompute" );
+
+    mSinglePrecision = false;
+
+    this->compute();
+
+    return true;
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Native::compute()
+{
+    // only keep the factors of the current precision
+    if ( mSinglePrecision )
+    {
+        mInvDiagonal.clear();
+        mFactorValues.clear();
+
+        this->build_jacobi( mInvDiagonalSingle );
+    }
+    else
+    {
+        mInvDiagonalSingle.clear();
+        mFactorValuesSingle.clear();
+
+        this->build_jacobi( mInvDiagonal );
+    }
+
+    switch ( mType )
+    {
+        case Native_Prec_Type::JACOBI:
+            break;
+        case Native_Prec_Type::ILU0:
+            if ( mSinglePrecision )
+            {
+                this->build_ilu0( mFactorValuesSingle );
+            }
+            else
+            {
+                this->build_ilu0( mFactorValues );
+            }
+            break;
+        case Native_Prec_Type::CHEBYSHEV:
+            this->build_chebyshev();
+            break;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+template< typename T >
+void
+Preconditioner_Native::build_jacobi( Vector< T >& aInvDiagonal )
+{
+    uint tNumRows = mMatrix->get_num_rows();
+
+    const Vector< sint >& tDiagonal = mMatrix->get_diagonal_positions();
+    const Vector< real >& tValues   = mMatrix->get_values();
+
+    aInvDiagonal.resize( tNumRows );
+
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        real tDiag = tDiagonal( iRow ) >= 0 ? tValues( tDiagonal( iRow ) ) : 0.0;
+
+        // rows without diagonal entry are not scaled
+        aInvDiagonal( iRow ) = static_cast< T >( tDiag != 0.0 ? 1.0 / tDiag : 1.0 );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+template< typename T >
+void
+Preconditioner_Native::build_ilu0( Vector< T >& aFactorValues )
+{
+    uint tNumRows = mMatrix->get_num_rows();
+
+    const Vector< uint >& tOffsets  = mMatrix->get_row_offsets();
+    const Vector< sint >& tColumns  = mMatrix->get_columns();
+    const Vector< sint >& tDiagonal = mMatrix->get_diagonal_positions();
+    const Vector< real >& tValues   = mMatrix->get_values();
+
+    // factorization is computed in the precision of the factors
+    aFactorValues.resize( tValues.size() );
+
+    for ( uint tPos = 0; tPos < tValues.size(); tPos++ )
+    {
+        aFactorValues( tPos ) = static_cast< T >( tValues( tPos ) );
+    }
+
+    // position of each column in the current row, -1 if not in pattern
+    Vector< sint > tMarker( tNumRows, -1 );
+
+    // IKJ variant restricted to the sparsity pattern
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        MORIS_ERROR( tDiagonal( iRow ) >= 0,
+                "Preconditioner_Native::build_ilu0 - row %u has no diagonal entry.", iRow );
+
+        for ( uint tPos = tOffsets( iRow ); tPos < tOffsets( iRow + 1 ); tPos++ )
+        {
+            tMarker( tColumns( tPos ) ) = tPos;
+        }
+
+        for ( uint tPos = tOffsets( iRow ); tPos < tOffsets( iRow + 1 ); tPos++ )
+        {
+            sint tK = tColumns( tPos );
+
+            // columns are sorted, lower part ends at the diagonal
+            if ( tK >= (sint)iRow )
+            {
+                break;
+            }
+
+            T tPivot = aFactorValues( tDiagonal( tK ) );
+
+            MORIS_ERROR( tPivot != 0.0,
+                    "Preconditioner_Native::build_ilu0 - zero pivot in row %d.", tK );
+
+            aFactorValues( tPos ) /= tPivot;
+
+            T tFactor = aFactorValues( tPos );
+
+            // update upper part of row iRow with row tK
+            for ( uint tKPos = tDiagonal( tK ) + 1; tKPos < tOffsets( tK + 1 ); tKPos++ )
+            {
+                sint tTarget = tMarker( tColumns( tKPos ) );
+
+                if ( tTarget >= 0 )
+                {
+                    aFactorValues( tTarget ) -= tFactor * aFactorValues( tKPos );
+                }
+            }
+        }
+
+        for ( uint tPos = tOffsets( iRow ); tPos < tOffsets( iRow + 1 ); tPos++ )
+        {
+            tMarker( tColumns( tPos ) ) = -1;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Native::build_chebyshev()
+{
+    mChebyshevDegree = mParameterList.get< sint >( "chebyshev_degree" );
+
+    real tRatio              = mParameterList.get< real >( "chebyshev_eigenvalue_ratio" );
+    uint tNumPowerIterations = mParameterList.get< sint >( "chebyshev_power_iterations" );
+
+    uint tNumRows = mMatrix->get_num_rows();
+
+    mWorkResidual.resize( tNumRows );
+    mWorkDirection.resize( tNumRows );
+    mWorkProduct.resize( tNumRows );
+
+    // estimate largest eigenvalue of D^-1 A by power iteration
+    Vector< real >& tV  = mWorkDirection;
+    Vector< real >& tAV = mWorkProduct;
+
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        // deterministic start vector which is not an eigenvector of the usual stencils
+        tV( iRow ) = 1.0 + 0.1 * std::sin( (real)iRow );
+    }
+
+    mLambdaMax = 0.0;
+
+    for ( uint iIter = 0; iIter < tNumPowerIterations; iIter++ )
+    {
+        real tNorm = 0.0;
+
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tNorm += tV( iRow ) * tV( iRow );
+        }
+
+        tNorm = std::sqrt( tNorm );
+
+        if ( tNorm == 0.0 )
+        {
+            break;
+        }
+
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tV( iRow ) /= tNorm;
+        }
+
+        mMatrix->multiply( tV.memptr(), tAV.memptr() );
+
+        real tRayleigh = 0.0;
+
+        for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tAV( iRow ) *= mInvDiagonal( iRow );
+            tRayleigh += tV( iRow ) * tAV( iRow );
+        }
+
+        mLambdaMax = tRayleigh;
+
+        std::swap( tV, tAV );
+    }
+
+    // power iteration underestimates the largest eigenvalue
+    mLambdaMax *= 1.1;
+    mLambdaMin = mLambdaMax / tRatio;
+
+    MORIS_ERROR( mLambdaMax > 0.0,
+            "Preconditioner_Native::build_chebyshev - estimated largest eigenvalue is not positive." );
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Native::apply(
+        const real* aX,
+        real*       aY ) const
+{
+    switch ( mType )
+    {
+        case Native_Prec_Type::JACOBI:
+            if ( mSinglePrecision )
+            {
+                this->apply_jacobi( mInvDiagonalSingle, aX, aY );
+            }
+            else
+            {
+                this->apply_jacobi( mInvDiagonal, aX, aY );
+            }
+            break;
+        case Native_Prec_Type::ILU0:
+            if ( mSinglePrecision )
+            {
+                this->apply_ilu0( mFactorValuesSingle, aX, aY );
+            }
+            else
+            {
+                this->apply_ilu0( mFactorValues, aX, aY );
+            }
+            break;
+        case Native_Prec_Type::CHEBYSHEV:
+            this->apply_chebyshev( aX, aY );
+            break;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+template< typename T >
+void
+Preconditioner_Native::apply_jacobi(
+        const Vector< T >& aInvDiagonal,
+        const real*        aX,
+        real*              aY ) const
+{
+    sint     tNumRows     = aInvDiagonal.size();
+    const T* tInvDiagonal = aInvDiagonal.memptr();
+
+    MORIS_OMP_PRAGMA( omp parallel for simd )
+    for ( sint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        aY[ iRow ] = tInvDiagonal[ iRow ] * aX[ iRow ];
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+template< typename T >
+void
+Preconditioner_Native::apply_ilu0(
+        const Vector< T >& aFactorValues,
+        const real*        aX,
+        real*              aY ) const
+{
+    uint tNumRows = mMatrix->get_num_rows();
+
+    const Vector< uint >& tOffsets  = mMatrix->get_row_offsets();
+    const Vector< sint >& tColumns  = mMatrix->get_columns();
+    const Vector< sint >& tDiagonal = mMatrix->get_diagonal_positions();
+
+    // substitutions are accumulated in double precision, only the factors are stored in T
+
+    // forward substitution with unit lower factor
+    for ( uint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        real tSum = aX[ iRow ];
+
+        for ( sint tPos = tOffsets( iRow ); tPos < tDiagonal( iRow ); tPos++ )
+        {
+            tSum -= aFactorValues( tPos ) * aY[ tColumns( tPos ) ];
+        }
+
+        aY[ iRow ] = tSum;
+    }
+
+    // backward substitution with upper factor
+    for ( sint iRow = tNumRows - 1; iRow >= 0; iRow-- )
+    {
+        real tSum = aY[ iRow ];
+
+        for ( uint tPos = tDiagonal( iRow ) + 1; tPos < tOffsets( iRow + 1 ); tPos++ )
+        {
+            tSum -= aFactorValues( tPos ) * aY[ tColumns( tPos ) ];
+        }
+
+        aY[ iRow ] = tSum / aFactorValues( tDiagonal( iRow ) );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void
+Preconditioner_Native::apply_chebyshev(
+        const real* aX,
+        real*       aY ) const
+{
+    sint tNumRows = mMatrix->get_num_rows();
+
+    real tTheta = 0.5 * ( mLambdaMax + mLambdaMin );
+    real tDelta = 0.5 * ( mLambdaMax - mLambdaMin );
+    real tSigma = tTheta / tDelta;
+    real tRho   = 1.0 / tSigma;
+
+    real*       tR    = mWorkResidual.memptr();
+    real*       tD    = mWorkDirection.memptr();
+    real*       tAD   = mWorkProduct.memptr();
+    const real* tInvD = mInvDiagonal.memptr();
+
+    // Chebyshev iteration on D^-1 A y = D^-1 x starting from y = 0
+    MORIS_OMP_PRAGMA( omp parallel for simd )
+    for ( sint iRow = 0; iRow < tNumRows; iRow++ )
+    {
+        tR[ iRow ] = tInvD[ iRow ] * aX[ iRow ];
+        tD[ iRow ] = tR[ iRow ] / tTheta;
+        aY[ iRow ] = 0.0;
+    }
+
+    for ( uint iDegree = 0; iDegree < mChebyshevDegree; iDegree++ )
+    {
+        MORIS_OMP_PRAGMA( omp parallel for simd )
+        for ( sint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            aY[ iRow ] += tD[ iRow ];
+        }
+
+        if ( iDegree + 1 == mChebyshevDegree )
+        {
+            break;
+        }
+
+        mMatrix->multiply( tD, tAD );
+
+        real tRhoNew = 1.0 / ( 2.0 * tSigma - tRho );
+        real tScaleD = tRhoNew * tRho;
+        real tScaleR = 2.0 * tRhoNew / tDelta;
+
+        MORIS_OMP_PRAGMA( omp parallel for simd )
+        for ( sint iRow = 0; iRow < tNumRows; iRow++ )
+        {
+            tR[ iRow ] -= tInvD[ iRow ] * tAD[ iRow ];
+            tD[ iRow ] = tScaleD * tD[ iRow ] + tScaleR * tR[ iRow ];
+        }
+
+        tRho = tRhoNew;
+    }
+}
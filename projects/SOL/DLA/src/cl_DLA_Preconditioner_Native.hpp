@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_DLA_Preconditioner_Native.hpp
+ *
+ */
+
+#pragma once
+
+#include "cl_Vector.hpp"
+#include "cl_DLA_Preconditioner.hpp"
+
+namespace moris
+{
+    class Sparse_Matrix_Native;
+
+    namespace dla
+    {
+        class Linear_Problem;
+
+        /**
+         * @brief preconditioners of the built-in linear algebra backend
+         *
+         * Supported types are point Jacobi, ILU(0) on the sparsity pattern of the matrix, and
+         * a Chebyshev polynomial of the Jacobi-scaled matrix. Only the Jacobi and Chebyshev
+         * applications are threaded, the ILU(0) triangular solves are sequential.
+         *
+         * Jacobi and ILU(0) can be computed and stored in single precision, which halves the memory
+         * and bandwidth of the factors. Solvers recover double precision accuracy through the residual
+         * of the double precision matrix and can fall back to a double precision preconditioner.
+         */
+        class Preconditioner_Native : public Preconditioner
+        {
+          private:
+            enum class Native_Prec_Type
+            {
+                JACOBI,
+                ILU0,
+                CHEBYSHEV
+            };
+
+            Native_Prec_Type mType = Native_Prec_Type::JACOBI;
+
+            // matrix of the current linear problem
+            const Sparse_Matrix_Native* mMatrix = nullptr;
+
+            // identity of the linear problem operator the preconditioner was built for
+            uint mOperatorId = 0;
+
+            // precision requested in the parameter list and precision of the current preconditioner
+            bool mRequestSinglePrecision = false;
+            bool mSinglePrecision        = false;
+
+            // inverse of matrix diagonal
+            Vector< real >  mInvDiagonal;
+            Vector< float > mInvDiagonalSingle;
+
+            // ILU(0) factors stored on the sparsity pattern of the matrix
+            Vector< real >  mFactorValues;
+            Vector< float > mFactorValuesSingle;
+
+            // Chebyshev parameters
+            uint mChebyshevDegree = 3;
+            real mLambdaMax       = 0.0;
+            real mLambdaMin       = 0.0;
+
+            // work vectors of Chebyshev iteration
+            mutable Vector< real > mWorkResidual;
+            mutable Vector< real > mWorkDirection;
+            mutable Vector< real > mWorkProduct;
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * @brief computes the preconditioner for the current matrix in the current precision
+             */
+            void compute();
+
+            //-------------------------------------------------------------------------------
+
+            template< typename T >
+            void build_jacobi( Vector< T >& aInvDiagonal );
+
+            template< typename T >
+            void build_ilu0( Vector< T >& aFactorValues );
+
+            void build_chebyshev();
+
+            //-------------------------------------------------------------------------------
+
+            template< typename T >
+            void apply_jacobi(
+                    const Vector< T >& aInvDiagonal,
+                    const real*        aX,
+                    real*              aY ) const;
+
+            template< typename T >
+            void apply_ilu0(
+                    const Vector< T >& aFactorValues,
+                    const real*        aX,
+                    real*              aY ) const;
+
+            void apply_chebyshev(
+                    const real* aX,
+                    real*       aY ) const;
+
+          public:
+            //-------------------------------------------------------------------------------
+
+            Preconditioner_Native( const Parameter_List& aParameterList );
+
+            //-------------------------------------------------------------------------------
+
+            ~Preconditioner_Native() override = default;
+
+            //-------------------------------------------------------------------------------
+
+            /*
+             * build and compute preconditioner
+             *
+             *  @param[in] iteration index - preconditioner is rebuilt if 1 or if reuse is disabled
+             */
+            void build( Linear_Problem* aProblem, const sint& aIter = 1 ) override;
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * @brief applies the preconditioner, aY = M^-1 aX
+             *
+             * @param[ in ]  aX input values of local length
+             * @param[ out ] aY preconditioned values of local length
+             */
+            void apply(
+                    const real* aX,
+                    real*       aY ) const;
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * @brief whether the current preconditioner is stored in single precision
+             */
+            bool
+            is_single_precision() const
+            {
+                return mSinglePrecision;
+            }
+
+            //-------------------------------------------------------------------------------
+
+            /**
+             * @brief recomputes a single precision preconditioner in double precision for the current matrix,
+             * used as fallback if a solve with the single precision preconditioner fails. The requested
+             * precision is restored at the next rebuild.
+             *
+             * @return true if the preconditioner was recomputed
+             */
+            bool recompute_in_double_precision();
+
+            //-------------------------------------------------------------------------------
+        };
+    }    // namespace dla
+}    // namespace moris
@@ -82,12 +82,26 @@ void Preconditioner_Trilinos::build( Linear_Problem* aProblem, const sint& aIter
     MORIS_ERROR( mLinearSystem,
             "Preconditioner_Trilinos::build - Preconditioner has not been initialized.\n" );
 
+    // determine whether the preconditioner needs to be rebuilt, recomputed or can be reused;
+    // a preconditioner built for the operator of a different linear problem cannot be used
+    uint tOperatorId = mLinearSystem->get_operator_id();
+
+    Preconditioner_Update tUpdate = this->get_update_type( aIter, this->exists() && tOperatorId == mOperatorId );
+
+    if ( tUpdate == Preconditioner_Update::REUSE )
+    {
+        return;
+    }
+
+    // start timer
+    tic tTimer;
+
     // build Ifpack preconditioner
     if ( !mParameterList.get< std::string >( "ifpack_prec_type" ).empty() )
     {
         // initialize and build, and compute preconditioner in first iteration
         // or if preconditioner should not be reused
-        if ( aIter == 1 || mParameterList.get< bool >( "prec_reuse" ) == false )
+        if ( tUpdate == Preconditioner_Update::REBUILD )
         {
             this->build_ifpack_preconditioner();
             this->compute_ifpack_preconditioner();
@@ -103,7 +117,7 @@ void Preconditioner_Trilinos::build( Linear_Problem* aProblem, const sint& aIter
     {
         // initialize and build, and compute preconditioner in first iteration
         // or if preconditioner should not be reused
-        if ( aIter == 1 || mParameterList.get< bool >( "prec_reuse" ) == false )
+        if ( tUpdate == Preconditioner_Update::REBUILD )
         {
             this->build_ml_preconditioner();
             this->compute_ml_preconditioner();
@@ -114,6 +128,14 @@ void Preconditioner_Trilinos::build( Linear_Problem* aProblem, const sint& aIter
             this->compute_ml_preconditioner( true );
         }
     }
+
+    // store operator and setup time for reuse policy
+    if ( tUpdate == Preconditioner_Update::REBUILD )
+    {
+        mOperatorId = tOperatorId;
+
+        this->set_setup_time( max_all( tTimer.toc< moris::chronos::milliseconds >().wall ) / 1000.0 );
+    }
 }
 
 //-------------------------------------------------------------------------------
@@ -35,6 +35,9 @@ namespace moris::dla
         Teuchos::RCP< Ifpack_Preconditioner >               mIfPackPrec;
         Teuchos::RCP< ML_Epetra::MultiLevelPreconditioner > mMlPrec;
 
+        // identity of the linear problem operator the preconditioner has been built for
+        uint mOperatorId = 0;
+
         //-------------------------------------------------------------------------------
 
         moris::sint build_ifpack_preconditioner();
@@ -17,6 +17,9 @@
 #include "cl_DLA_Linear_Solver_ML.hpp"
 
 #include "cl_DLA_Linear_System_Trilinos.hpp"
+#include "cl_DLA_Linear_System_Native.hpp"
+#include "cl_DLA_Linear_Solver_Native.hpp"
+#include "cl_DLA_Eigen_Solver_LOBPCG.hpp"
 
 #ifdef MORIS_HAVE_PETSC
 #include "cl_DLA_Linear_System_PETSc.hpp"
@@ -28,6 +31,7 @@
 
 #include "cl_DLA_Linear_Solver_Algorithm.hpp"
 #include "cl_DLA_Preconditioner_Trilinos.hpp"
+#include "cl_DLA_Preconditioner_Native.hpp"
 
 using namespace moris;
 using namespace dla;
@@ -62,6 +66,8 @@ Solver_Factory::create_preconditioner( const Parameter_List& aParameterList )
             MORIS_ERROR( false, "MORIS is configured with out PETSC support." );
             return nullptr;
 #endif
+        case ( sol::PreconditionerType::NATIVE ):
+            return new Preconditioner_Native( aParameterList );
         default:
             MORIS_ERROR( false, "No solver type specified" );
             return nullptr;
@@ -103,6 +109,12 @@ Solver_Factory::create_solver(
         case ( sol::SolverType::ML ):
             tLinSol = std::make_shared< Linear_Solver_ML >( aParameterlist );
             break;
+        case ( sol::SolverType::NATIVE ):
+            tLinSol = std::make_shared< Linear_Solver_Native >( aParameterlist );
+            break;
+        case ( sol::SolverType::LOBPCG ):
+            tLinSol = std::make_shared< Eigen_Solver_LOBPCG >( aParameterlist );
+            break;
         case ( sol::SolverType::SLEPC_SOLVER ):
 #ifdef MORIS_HAVE_SLEPC
             tLinSol = std::make_shared< Eigen_Solver_SLEPc >( aParameterlist );
@@ -135,6 +147,9 @@ Solver_Factory::create_linear_system(
         case ( sol::MapType::Epetra ):
             tLinSys = new Linear_System_Trilinos( aSolverInterface, aSolverWarehouse, aMap, aFullMap );
             break;
+        case ( sol::MapType::Native ):
+            tLinSys = new Linear_System_Native( aSolverInterface, aSolverWarehouse, aMap, aFullMap );
+            break;
         case ( sol::MapType::Petsc ):
 #ifdef MORIS_HAVE_PETSC
             tLinSys = new Linear_System_PETSc(
@@ -170,6 +185,9 @@ Solver_Factory::create_linear_system(
         case ( sol::MapType::Epetra ):
             tLinSys = new Linear_System_Trilinos( aSolverInterface );
             break;
+        case ( sol::MapType::Native ):
+            tLinSys = new Linear_System_Native( aSolverInterface );
+            break;
         case ( sol::MapType::Petsc ):
 #ifdef MORIS_HAVE_PETSC
             tLinSys = new Linear_System_PETSc( aSolverInterface, aNotCreatedByNonLinSolver );
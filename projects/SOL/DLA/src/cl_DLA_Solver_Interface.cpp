@@ -8,13 +8,79 @@
 
 */
 
+#include <algorithm>
+
 #include "cl_DLA_Solver_Interface.hpp"
 #include "cl_SOL_Dist_Matrix.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
 #include "cl_SOL_Warehouse.hpp"
+#include "moris_openmp.hpp"
 
 using namespace moris;
 
+namespace
+{
+    //---------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief thread-local storage for one equation object contribution
+     * The element evaluation writes into a buffer, the scatter task reads from it. Buffers are
+     * recycled in a ring such that the evaluation of the next equation objects can proceed while
+     * previous contributions are summed into the distributed matrix and vector.
+     */
+    struct Element_Assembly_Buffer
+    {
+        moris::Matrix< DDSMat >           mTopology;
+        moris::Matrix< DDRMat >           mMatrix;
+        Vector< moris::Matrix< DDRMat > > mRHS;
+    };
+
+    // minimum number of element buffers in flight during hybrid assembly
+    const moris::uint gNumAssemblyBuffers = 8;
+
+    //---------------------------------------------------------------------------------------------------------
+
+    /**
+     * @brief clears an element buffer before it is reused for the next equation object, such that an
+     * evaluation that does not write all contributions does not leave those of a previous equation object
+     */
+    void
+    reset_assembly_buffer( Element_Assembly_Buffer& aBuffer )
+    {
+        aBuffer.mTopology.set_size( 0, 0 );
+        aBuffer.mMatrix.set_size( 0, 0 );
+        aBuffer.mRHS.clear();
+    }
+}    // namespace
+
+//---------------------------------------------------------------------------------------------------------
+
+uint Solver_Interface::get_max_number_of_evaluation_workspaces()
+{
+    uint tMaxNumWorkspaces = 1;
+
+    for ( uint iSet = 0; iSet < this->get_num_sets(); iSet++ )
+    {
+        tMaxNumWorkspaces = std::max( tMaxNumWorkspaces, this->get_number_of_evaluation_workspaces( iSet ) );
+    }
+
+    // no more workspaces than threads are used concurrently
+    return std::min( tMaxNumWorkspaces, static_cast< uint >( omp_max_threads() ) );
+}
+
+//---------------------------------------------------------------------------------------------------------
+
+void Solver_Interface::set_forward_recomputation( bool aIsForwardRecomputation )
+{
+    mIsForwardAnalysis = aIsForwardRecomputation;
+
+    // requested IWGs and IQIs, assembly maps and buffer sizes of the sets depend on the type of analysis
+    for ( uint iSet = 0; iSet < this->get_num_sets(); iSet++ )
+    {
+        this->initialize_set( iSet );
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------
 
 void Solver_Interface::build_graph(
@@ -116,45 +182,76 @@ void Solver_Interface::assemble_RHS(
 
     moris::uint tNumRHS = this->get_num_rhs();
 
-    Vector< Matrix< DDRMat > > tElementRHS;
-    Matrix< DDSMat >           tElementTopology;
+    // workspaces evaluating equation objects concurrently
+    uint const tNumWorkspaces = this->get_max_number_of_evaluation_workspaces();
 
-    // Loop over all local elements to build matrix graph
-    for ( moris::uint Ii = 0; Ii < tNumSets; Ii++ )
-    {
-        moris::uint tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
+    // ring of element buffers shared between evaluation and scatter tasks
+    Vector< Element_Assembly_Buffer > tBuffers( std::max( gNumAssemblyBuffers, 2 * tNumWorkspaces ) );
 
-        this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
+    // dependency tokens ordering set initialization, evaluation on a workspace and the scatter (distributed vector)
+    [[maybe_unused]] char tSetToken     = 0;
+    [[maybe_unused]] char tScatterToken = 0;
+    Vector< char >        tWorkspaceTokens( tNumWorkspaces, 0 );
 
-        for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+    // number of equation objects with a wrong number of RHS, checked outside of the tasks
+    uint tNumRHSMismatch = 0;
+
+    MORIS_OMP_PRAGMA( omp parallel default( shared ) )
+    MORIS_OMP_PRAGMA( omp single )
+    {
+        // Loop over all local elements to build matrix graph
+        for ( moris::uint Ii = 0; Ii < tNumSets; Ii++ )
         {
-            this->get_element_topology( Ii, Ik, tElementTopology );
+            moris::uint tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
 
-            // compute RHS
-            this->get_equation_object_rhs( Ii, Ik, tElementRHS );
+            uint const tNumSetWorkspaces = std::min( tNumWorkspaces, this->get_number_of_evaluation_workspaces( Ii ) );
 
-            // Fill elementRHS in distributed RHS
-            if ( tElementRHS.size() > 0 )
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( Ii ) )
+            this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
+
+            for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
             {
-                MORIS_ASSERT( tElementRHS.size() == tNumRHS,
-                        "Number of RHS does not match cell with RHS vectors.\n" );
+                Element_Assembly_Buffer* tBuffer    = &tBuffers( Ik % tBuffers.size() );
+                uint const               tWorkspace = Ik % tNumSetWorkspaces;
+                char*                    tToken     = &tWorkspaceTokens( tWorkspace );
 
-                for ( moris::uint Ia = 0; Ia < tNumRHS; Ia++ )
+                // compute RHS, equation objects on different workspaces are evaluated concurrently
+                MORIS_OMP_PRAGMA( omp task depend( in : tSetToken ) depend( inout : tToken[ 0 ] ) depend( inout : tBuffer[ 0 ] ) firstprivate( Ii, Ik, tBuffer, tWorkspace ) )
                 {
-                    if ( tElementRHS( Ia ).numel() > 0 )
+                    reset_assembly_buffer( *tBuffer );
+
+                    this->get_element_topology( Ii, Ik, tBuffer->mTopology );
+
+                    this->get_equation_object_rhs_on_workspace( Ii, Ik, tBuffer->mRHS, tWorkspace );
+                }
+
+                // Fill elementRHS in distributed RHS
+                MORIS_OMP_PRAGMA( omp task depend( inout : tScatterToken ) depend( in : tBuffer[ 0 ] ) firstprivate( tBuffer ) )
+                if ( tBuffer->mRHS.size() > 0 )
+                {
+                    tNumRHSMismatch += tBuffer->mRHS.size() != tNumRHS;
+
+                    for ( moris::uint Ia = 0; Ia < std::min( tNumRHS, (uint)tBuffer->mRHS.size() ); Ia++ )
                     {
-                        aVectorRHS->sum_into_global_values(
-                                tElementTopology,
-                                tElementRHS( Ia ),
-                                Ia );
+                        if ( tBuffer->mRHS( Ia ).numel() > 0 )
+                        {
+                            aVectorRHS->sum_into_global_values(
+                                    tBuffer->mTopology,
+                                    tBuffer->mRHS( Ia ),
+                                    Ia );
+                        }
                     }
                 }
             }
-        }
 
-        this->free_block_memory( Ii );
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( Ii ) )
+            this->free_block_memory( Ii );
+        }
     }
 
+    MORIS_ASSERT( tNumRHSMismatch == 0,
+            "Number of RHS does not match cell with RHS vectors.\n" );
+
     // global assembly to switch entries to the right processor
     aVectorRHS->vector_global_assembly();
 }
@@ -275,35 +372,62 @@ void Solver_Interface::assemble_jacobian(
     // Get local number of elements
     moris::uint tNumSets = this->get_num_sets();
 
-    Matrix< DDSMat > tElementTopology;
-    Matrix< DDRMat > tElementMatrix;
+    // workspaces evaluating equation objects concurrently
+    uint const tNumWorkspaces = this->get_max_number_of_evaluation_workspaces();
 
-    this->report_beginning_of_assembly();
+    // ring of element buffers shared between evaluation and scatter tasks
+    Vector< Element_Assembly_Buffer > tBuffers( std::max( gNumAssemblyBuffers, 2 * tNumWorkspaces ) );
 
-    // Loop over all local elements to build matrix graph
-    for ( uint Ii = 0; Ii < tNumSets; Ii++ )
-    {
-        uint const tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
+    // dependency tokens ordering set initialization, evaluation on a workspace and the scatter (distributed matrix)
+    [[maybe_unused]] char tSetToken     = 0;
+    [[maybe_unused]] char tScatterToken = 0;
+    Vector< char >        tWorkspaceTokens( tNumWorkspaces, 0 );
 
-        this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
+    this->report_beginning_of_assembly();
 
-        for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
+    MORIS_OMP_PRAGMA( omp parallel default( shared ) )
+    MORIS_OMP_PRAGMA( omp single )
+    {
+        // Loop over all local elements to build matrix graph
+        for ( uint Ii = 0; Ii < tNumSets; Ii++ )
         {
-            this->get_element_topology( Ii, Ik, tElementTopology );
+            uint const tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( Ii );
+
+            uint const tNumSetWorkspaces = std::min( tNumWorkspaces, this->get_number_of_evaluation_workspaces( Ii ) );
 
-            this->get_equation_object_operator( Ii, Ik, tElementMatrix );
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( Ii ) )
+            this->initialize_set( Ii, false, aTimeContinuityOnlyFlag );
 
-            // Fill element in distributed matrix
-            if ( tElementMatrix.numel() > 0 )
+            for ( moris::uint Ik = 0; Ik < tNumEquationObjectOnSet; Ik++ )
             {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
+                Element_Assembly_Buffer* tBuffer    = &tBuffers( Ik % tBuffers.size() );
+                uint const               tWorkspace = Ik % tNumSetWorkspaces;
+                char*                    tToken     = &tWorkspaceTokens( tWorkspace );
+
+                // equation objects on different workspaces are evaluated concurrently
+                MORIS_OMP_PRAGMA( omp task depend( in : tSetToken ) depend( inout : tToken[ 0 ] ) depend( inout : tBuffer[ 0 ] ) firstprivate( Ii, Ik, tBuffer, tWorkspace ) )
+                {
+                    reset_assembly_buffer( *tBuffer );
+
+                    this->get_element_topology( Ii, Ik, tBuffer->mTopology );
+
+                    this->get_equation_object_operator_on_workspace( Ii, Ik, tBuffer->mMatrix, tWorkspace );
+                }
+
+                // Fill element in distributed matrix
+                MORIS_OMP_PRAGMA( omp task depend( inout : tScatterToken ) depend( in : tBuffer[ 0 ] ) firstprivate( tBuffer ) )
+                if ( tBuffer->mMatrix.numel() > 0 )
+                {
+                    aMat->fill_matrix(
+                            tBuffer->mTopology.length(),
+                            tBuffer->mMatrix,
+                            tBuffer->mTopology );
+                }
             }
-        }
 
-        this->free_block_memory( Ii );
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( Ii ) )
+            this->free_block_memory( Ii );
+        }
     }
 
     // global assembly to switch entries to the right processor
@@ -323,54 +447,88 @@ void Solver_Interface::fill_matrix_and_RHS(
     uint const tNumSets = this->get_num_sets();
     uint const tNumRHS  = this->get_num_rhs();
 
-    // Loop over all local elements to build matrix graph
-    for ( uint iSet = 0; iSet < tNumSets; iSet++ )
-    {
-        this->initialize_set( iSet );
+    // workspaces evaluating equation objects concurrently
+    uint const tNumWorkspaces = this->get_max_number_of_evaluation_workspaces();
+
+    // ring of element buffers shared between evaluation and scatter tasks
+    Vector< Element_Assembly_Buffer > tBuffers( std::max( gNumAssemblyBuffers, 2 * tNumWorkspaces ) );
 
-        uint const tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( iSet );
+    // dependency tokens ordering set initialization, evaluation on a workspace and the scatter (distributed matrix and vector)
+    [[maybe_unused]] char tSetToken     = 0;
+    [[maybe_unused]] char tScatterToken = 0;
+    Vector< char >        tWorkspaceTokens( tNumWorkspaces, 0 );
 
-        for ( moris::uint iEquationObject = 0; iEquationObject < tNumEquationObjectOnSet; iEquationObject++ )
+    // number of equation objects with a wrong number of RHS, checked outside of the tasks
+    uint tNumRHSMismatch = 0;
+
+    MORIS_OMP_PRAGMA( omp parallel default( shared ) )
+    MORIS_OMP_PRAGMA( omp single )
+    {
+        // Loop over all local elements to build matrix graph
+        for ( uint iSet = 0; iSet < tNumSets; iSet++ )
         {
-            Matrix< DDSMat > tElementTopology;
-            this->get_element_topology( iSet, iEquationObject, tElementTopology );
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( iSet ) )
+            this->initialize_set( iSet );
 
-            Matrix< DDRMat >           tElementMatrix;
-            Vector< Matrix< DDRMat > > tElementRHS;
-            this->get_equation_object_operator_and_rhs( iSet, iEquationObject, tElementMatrix, tElementRHS );
+            uint const tNumEquationObjectOnSet = this->get_num_equation_objects_on_set( iSet );
 
-            // Fill element in distributed matrix
-            if ( tElementMatrix.numel() > 0 )
-            {
-                aMat->fill_matrix(
-                        tElementTopology.length(),
-                        tElementMatrix,
-                        tElementTopology );
-            }
+            uint const tNumSetWorkspaces = std::min( tNumWorkspaces, this->get_number_of_evaluation_workspaces( iSet ) );
 
-            // Loop over all RHS vectors
-            if ( tElementRHS.size() > 0 )
+            for ( moris::uint iEquationObject = 0; iEquationObject < tNumEquationObjectOnSet; iEquationObject++ )
             {
-                MORIS_ASSERT( tElementRHS.size() == tNumRHS,
-                        "Number of RHS does not match cell with RHS vectors.\n" );
+                Element_Assembly_Buffer* tBuffer    = &tBuffers( iEquationObject % tBuffers.size() );
+                uint const               tWorkspace = iEquationObject % tNumSetWorkspaces;
+                char*                    tToken     = &tWorkspaceTokens( tWorkspace );
 
-                for ( moris::uint Ia = 0; Ia < tNumRHS; Ia++ )
+                // equation objects on different workspaces are evaluated concurrently
+                MORIS_OMP_PRAGMA( omp task depend( in : tSetToken ) depend( inout : tToken[ 0 ] ) depend( inout : tBuffer[ 0 ] ) firstprivate( iSet, iEquationObject, tBuffer, tWorkspace ) )
                 {
-                    if ( tElementRHS( Ia ).numel() > 0 )
+                    reset_assembly_buffer( *tBuffer );
+
+                    this->get_element_topology( iSet, iEquationObject, tBuffer->mTopology );
+
+                    this->get_equation_object_operator_and_rhs_on_workspace( iSet, iEquationObject, tBuffer->mMatrix, tBuffer->mRHS, tWorkspace );
+                }
+
+                MORIS_OMP_PRAGMA( omp task depend( inout : tScatterToken ) depend( in : tBuffer[ 0 ] ) firstprivate( tBuffer ) )
+                {
+                    // Fill element in distributed matrix
+                    if ( tBuffer->mMatrix.numel() > 0 )
                     {
-                        // Fill elementRHS in distributed RHS
-                        aVectorRHS->sum_into_global_values(
-                                tElementTopology,
-                                tElementRHS( Ia ),
-                                Ia );
+                        aMat->fill_matrix(
+                                tBuffer->mTopology.length(),
+                                tBuffer->mMatrix,
+                                tBuffer->mTopology );
+                    }
+
+                    // Loop over all RHS vectors
+                    if ( tBuffer->mRHS.size() > 0 )
+                    {
+                        tNumRHSMismatch += tBuffer->mRHS.size() != tNumRHS;
+
+                        for ( moris::uint Ia = 0; Ia < std::min( tNumRHS, (uint)tBuffer->mRHS.size() ); Ia++ )
+                        {
+                            if ( tBuffer->mRHS( Ia ).numel() > 0 )
+                            {
+                                // Fill elementRHS in distributed RHS
+                                aVectorRHS->sum_into_global_values(
+                                        tBuffer->mTopology,
+                                        tBuffer->mRHS( Ia ),
+                                        Ia );
+                            }
+                        }
                     }
                 }
             }
-        }
 
-        this->free_block_memory( iSet );
+            MORIS_OMP_PRAGMA( omp task depend( inout : tSetToken ) firstprivate( iSet ) )
+            this->free_block_memory( iSet );
+        }
     }
 
+    MORIS_ASSERT( tNumRHSMismatch == 0,
+            "Number of RHS does not match cell with RHS vectors.\n" );
+
     // global assembly to switch entries to the right processor
     aMat->matrix_global_assembly();
     aVectorRHS->vector_global_assembly();
@@ -49,6 +49,13 @@ namespace moris
         bool mIsForwardAnalysis            = true;
         bool mIsAdjointSensitivityAnalysis = true;
 
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief maximum number of evaluation workspaces over all sets, limited by the number of threads
+         */
+        uint get_max_number_of_evaluation_workspaces();
+
       protected:
         Vector< moris_id > mNonZeroDigonal;
         Vector< moris_id > mNonZeroOffDigonal;
@@ -89,6 +96,15 @@ namespace moris
             return mIsForwardAnalysis;
         };
 
+        //------------------------------------------------------------------------------
+        /**
+         * temporarily switches to forward analysis during the sensitivity analysis,
+         * e.g. to recompute forward states from checkpoints, and re-initializes all sets
+         * for the current requested dof types and type of analysis
+         * @param[ in ] aIsForwardRecomputation true to switch to forward analysis, false to switch back
+         */
+        virtual void set_forward_recomputation( bool aIsForwardRecomputation );
+
         //------------------------------------------------------------------------------
 
         virtual void
@@ -448,6 +464,73 @@ namespace moris
                 moris::Matrix< DDRMat >&    aElementMatrix,
                 Vector< Matrix< DDRMat > >& aElementRHS ) = 0;
 
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief number of independent evaluation states (e.g. per-thread copies of the set state)
+         * an equation set provides. Equation objects evaluated on different workspaces may run
+         * concurrently during the threaded assembly; the default of one serializes the evaluation.
+         *
+         * @param aMyEquSetInd index of equation set
+         */
+        virtual uint
+        get_number_of_evaluation_workspaces( const moris::uint aMyEquSetInd )
+        {
+            return 1;
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief evaluates the operator of an equation object using the state of a given workspace
+         *
+         * @param aWorkspace index of workspace, smaller than get_number_of_evaluation_workspaces()
+         */
+        virtual void
+        get_equation_object_operator_on_workspace(
+                const moris::uint&       aMyEquSetInd,
+                const moris::uint&       aMyElementInd,
+                moris::Matrix< DDRMat >& aElementMatrix,
+                const moris::uint        aWorkspace )
+        {
+            this->get_equation_object_operator( aMyEquSetInd, aMyElementInd, aElementMatrix );
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief evaluates the RHS of an equation object using the state of a given workspace
+         *
+         * @param aWorkspace index of workspace, smaller than get_number_of_evaluation_workspaces()
+         */
+        virtual void
+        get_equation_object_rhs_on_workspace(
+                const moris::uint&          aMyEquSetInd,
+                const moris::uint&          aMyElementInd,
+                Vector< Matrix< DDRMat > >& aElementRHS,
+                const moris::uint           aWorkspace )
+        {
+            this->get_equation_object_rhs( aMyEquSetInd, aMyElementInd, aElementRHS );
+        }
+
+        //------------------------------------------------------------------------------
+
+        /**
+         * @brief evaluates operator and RHS of an equation object using the state of a given workspace
+         *
+         * @param aWorkspace index of workspace, smaller than get_number_of_evaluation_workspaces()
+         */
+        virtual void
+        get_equation_object_operator_and_rhs_on_workspace(
+                const moris::uint&          aMyEquSetInd,
+                const moris::uint&          aMyElementInd,
+                moris::Matrix< DDRMat >&    aElementMatrix,
+                Vector< Matrix< DDRMat > >& aElementRHS,
+                const moris::uint           aWorkspace )
+        {
+            this->get_equation_object_operator_and_rhs( aMyEquSetInd, aMyElementInd, aElementMatrix, aElementRHS );
+        }
+
         //------------------------------------------------------------
 
         virtual void
@@ -563,6 +646,17 @@ namespace moris
 
         //---------------------------------------------------------------------------------------------------------
 
+        /**
+         * @brief assembles the jacobian and the residual(s) set by set
+         * If moris is built with OpenMP, the evaluation of the equation objects and the summation into
+         * the distributed matrix and vector run as tasks on different threads. Equation objects of a set
+         * are evaluated concurrently on the workspaces the set provides (see
+         * get_number_of_evaluation_workspaces()); the scatter stays serial and in element order to keep
+         * results reproducible.
+         *
+         * @param aMat distributed matrix to assemble into
+         * @param aVectorRHS distributed vector to assemble into
+         */
         void fill_matrix_and_RHS(
                 moris::sol::Dist_Matrix* aMat,
                 moris::sol::Dist_Vector* aVectorRHS );
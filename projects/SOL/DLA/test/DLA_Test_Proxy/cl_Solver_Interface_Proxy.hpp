@@ -41,6 +41,8 @@ namespace moris
 
         uint mSwitchToEigenProblem = 0;
 
+        uint mNumEvaluationWorkspaces = 1;    // workspaces used to evaluate elements concurrently
+
         sol::Dist_Vector*                 mEigVector;
         std::shared_ptr< Vector< real > > mEigenValues = std::make_shared< Vector< real > >();
 
@@ -289,6 +291,22 @@ namespace moris
 
         // ----------------------------------------------------------------------------------------------
 
+        uint
+        get_number_of_evaluation_workspaces( const uint aMyEquSetInd ) override
+        {
+            return mNumEvaluationWorkspaces;
+        }
+
+        // ----------------------------------------------------------------------------------------------
+
+        void
+        set_number_of_evaluation_workspaces( uint aNumWorkspaces )
+        {
+            mNumEvaluationWorkspaces = aNumWorkspaces;
+        }
+
+        // ----------------------------------------------------------------------------------------------
+
         void
         use_matrix_market_files() override
         {
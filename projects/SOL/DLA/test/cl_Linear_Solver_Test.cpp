@@ -24,6 +24,7 @@
 
 #include "cl_Communication_Manager.hpp"      // COM/src/
 #include "cl_Communication_Tools.hpp"        // COM/src/
+#include "moris_openmp.hpp"                  // COR/src/
 #include "cl_DLA_Linear_Solver_Aztec.hpp"    // DLA/src/
 
 #include "cl_SOL_Matrix_Vector_Factory.hpp"    // DLA/src/
@@ -256,6 +257,40 @@ namespace moris::dla
         }
     }
 
+    TEST_CASE( "Linear System threaded assembly", "[Linear Solver threaded assembly],[Linear Solver],[DistLinAlg]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // assemble with 4 threads evaluating elements on 4 workspaces
+            int tNumThreads = omp_max_threads();
+            omp_set_max_threads( 4 );
+
+            Solver_Interface_Proxy* tSolverInterface = new Solver_Interface_Proxy( 1 );
+            tSolverInterface->set_number_of_evaluation_workspaces( 4 );
+
+            Solver_Factory tSolFactory;
+
+            Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Epetra );
+
+            tLinProblem->assemble_residual_and_jacobian();
+
+            tLinProblem->solve_linear_system();
+
+            omp_set_max_threads( tNumThreads );
+
+            // get solution vector (here: solution vector has only unconstrained dofs)
+            moris::Matrix< DDRMat > tSol;
+            tLinProblem->get_solution( tSol );
+
+            // solution does not depend on the number of threads and workspaces
+            CHECK( equal_to( tSol( 5, 0 ), -0.0138889, 1.0e+08 ) );
+            CHECK( equal_to( tSol( 12, 0 ), -0.00694444, 1.0e+08 ) );
+
+            delete ( tSolverInterface );
+            delete ( tLinProblem );
+        }
+    }
+
 #ifdef MORIS_HAVE_PETSC
     TEST_CASE( "Linear System PETSc single RHS", "[Linear Solver single RHS],[Linear Solver],[DistLinAlg]" )
     {
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Native_Linear_Solver_Test.cpp
+ *
+ */
+
+#include "catch.hpp"
+#include "fn_equal_to.hpp"       // ALG/src
+#include "moris_typedefs.hpp"    // COR/src
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "fn_eig_sym.hpp"
+
+#include "cl_Communication_Tools.hpp"    // COM/src/
+
+#include "cl_SOL_Matrix_Vector_Factory.hpp"    // DLA/src/
+#include "cl_SOL_Dist_Vector.hpp"              // DLA/src/
+#include "cl_SOL_Dist_Matrix.hpp"              // DLA/src/
+#include "cl_SOL_Dist_Map.hpp"                 // DLA/src/
+#include "cl_DLA_Solver_Factory.hpp"           // DLA/src/
+#include "cl_DLA_Linear_Problem.hpp"           // DLA/src/
+#include "cl_DLA_Preconditioner.hpp"           // DLA/src/
+#include "cl_DLA_Eigen_Solver_LOBPCG.hpp"      // DLA/src/
+
+#include "cl_Solver_Interface_Proxy.hpp"    // DLA/src/
+
+#include "fn_PRM_SOL_Parameters.hpp"
+
+namespace moris::dla
+{
+    TEST_CASE( "Native Matrix Vector Product", "[Native Linear Solver],[DistLinAlg]" )
+    {
+        if ( par_size() == 1 )
+        {
+            sol::Matrix_Vector_Factory tMatFactory( sol::MapType::Native );
+
+            // 1D Laplacian with 5 dofs, global IDs in reverse order
+            Matrix< DDSMat > tIds = { { 4 }, { 3 }, { 2 }, { 1 }, { 0 } };
+
+            sol::Dist_Map*    tMap = tMatFactory.create_map( tIds );
+            sol::Dist_Matrix* tMat = tMatFactory.create_matrix( tMap, tMap );
+
+            Matrix< DDRMat > tElementMatrix = { { 1.0, -1.0 }, { -1.0, 1.0 } };
+
+            for ( sint iElement = 0; iElement < 4; iElement++ )
+            {
+                Matrix< DDSMat > tElementIds = { { iElement }, { iElement + 1 } };
+
+                tMat->sum_into_values( tElementIds, tElementIds, tElementMatrix );
+            }
+
+            tMat->matrix_global_assembly();
+
+            sol::Dist_Vector* tX = tMatFactory.create_vector( tMap, 1 );
+            sol::Dist_Vector* tY = tMatFactory.create_vector( tMap, 1 );
+
+            for ( sint iId = 0; iId < 5; iId++ )
+            {
+                ( *tX )( iId ) = iId * iId;
+            }
+
+            tMat->mat_vec_product( *tX, *tY, false );
+
+            // A x = -x'' for x = i^2, boundary rows are one-sided
+            CHECK( equal_to( ( *tY )( 0 ), -1.0 ) );
+            CHECK( equal_to( ( *tY )( 1 ), -2.0 ) );
+            CHECK( equal_to( ( *tY )( 2 ), -2.0 ) );
+            CHECK( equal_to( ( *tY )( 3 ), -2.0 ) );
+            CHECK( equal_to( ( *tY )( 4 ), 7.0 ) );
+
+            // diagonal
+            tMat->get_diagonal( *tY );
+
+            CHECK( equal_to( ( *tY )( 0 ), 1.0 ) );
+            CHECK( equal_to( ( *tY )( 2 ), 2.0 ) );
+            CHECK( equal_to( ( *tY )( 4 ), 1.0 ) );
+
+            // dense block of the interior dofs
+            Matrix< DDRMat > tBlock;
+            tMat->get_matrix_values( { { 1 }, { 2 }, { 3 } }, tBlock );
+
+            REQUIRE( tBlock.n_rows() == 3 );
+            REQUIRE( tBlock.n_cols() == 3 );
+            CHECK( equal_to( tBlock( 0, 0 ), 2.0 ) );
+            CHECK( equal_to( tBlock( 0, 1 ), -1.0 ) );
+            CHECK( equal_to( tBlock( 0, 2 ), 0.0 ) );
+            CHECK( equal_to( tBlock( 2, 1 ), -1.0 ) );
+
+            // write vector to hdf5 file and read it back
+            tX->save_vector_to_HDF5( "Native_Vector_Test.hdf5" );
+            tY->read_vector_from_HDF5( "Native_Vector_Test.hdf5", "LHS", 0 );
+
+            for ( sint iId = 0; iId < 5; iId++ )
+            {
+                CHECK( equal_to( ( *tY )( iId ), iId * iId ) );
+            }
+
+            delete tX;
+            delete tY;
+            delete tMat;
+            delete tMap;
+        }
+    }
+
+    TEST_CASE( "Native Linear Solver multiple RHS", "[Native Linear Solver],[Linear Solver],[DistLinAlg]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // Krylov method and preconditioner combinations
+            Vector< std::pair< std::string, std::string > > tCombinations = {
+                { "cg", "jacobi" },
+                { "cg", "ilu0" },
+                { "cg", "chebyshev" },
+                { "gmres", "" },
+                { "gmres", "ilu0" },
+                { "bicgstab", "jacobi" }
+            };
+
+            for ( const auto& [ tMethod, tPrecType ] : tCombinations )
+            {
+                Solver_Interface* tSolverInterface = new Solver_Interface_Proxy( 2 );
+
+                Solver_Factory tSolFactory;
+
+                Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Native );
+
+                Parameter_List tLinearSolverParameterList = prm::create_linear_algorithm_parameter_list_native();
+                tLinearSolverParameterList.set( "Krylov_Method", tMethod );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tLinSolver = tSolFactory.create_solver( tLinearSolverParameterList );
+
+                Parameter_List tPrecParameterList = prm::create_preconditioner_parameter_list( sol::PreconditionerType::NATIVE );
+                tPrecParameterList.set( "native_prec_type", tPrecType );
+
+                // create preconditioner
+                Preconditioner* tPreconditioner = tSolFactory.create_preconditioner( tPrecParameterList );
+                tLinSolver->set_preconditioner( tPreconditioner );
+
+                tLinProblem->assemble_jacobian();
+                tLinProblem->assemble_residual();
+
+                sint tError = tLinSolver->solve_linear_system( tLinProblem );
+
+                CHECK( tError == 0 );
+
+                // get solution vector (here: solution vector has only unconstrained dofs)
+                moris::Matrix< DDRMat > tSol;
+                tLinProblem->get_solution( tSol );
+
+                // same solution as with Belos
+                CHECK( equal_to( tSol( 5, 0 ), -0.0138889, 1.0e+08 ) );
+                CHECK( equal_to( tSol( 12, 0 ), -0.00694444, 1.0e+08 ) );
+
+                CHECK( equal_to( tSol( 5, 1 ), -0.0138889, 1.0e+08 ) );
+                CHECK( equal_to( tSol( 12, 1 ), -0.00694444, 1.0e+08 ) );
+
+                // delete local variables
+                delete tPreconditioner;
+                delete tSolverInterface;
+                delete tLinProblem;
+            }
+        }
+    }
+
+    TEST_CASE( "Native Mixed Precision Linear Solver", "[Native Linear Solver],[Linear Solver],[DistLinAlg]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // single precision preconditioners with iterative refinement and with GMRES
+            Vector< std::pair< std::string, std::string > > tCombinations = {
+                { "refinement", "ilu0" },
+                { "refinement", "jacobi" },
+                { "gmres", "ilu0" }
+            };
+
+            for ( const auto& [ tMethod, tPrecType ] : tCombinations )
+            {
+                Solver_Interface* tSolverInterface = new Solver_Interface_Proxy( 2 );
+
+                Solver_Factory tSolFactory;
+
+                Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Native );
+
+                Parameter_List tLinearSolverParameterList = prm::create_linear_algorithm_parameter_list_native();
+                tLinearSolverParameterList.set( "Krylov_Method", tMethod );
+
+                std::shared_ptr< Linear_Solver_Algorithm > tLinSolver = tSolFactory.create_solver( tLinearSolverParameterList );
+
+                Parameter_List tPrecParameterList = prm::create_preconditioner_parameter_list( sol::PreconditionerType::NATIVE );
+                tPrecParameterList.set( "native_prec_type", tPrecType );
+                tPrecParameterList.set( "native_prec_precision", std::string( "single" ) );
+
+                // create preconditioner
+                Preconditioner* tPreconditioner = tSolFactory.create_preconditioner( tPrecParameterList );
+                tLinSolver->set_preconditioner( tPreconditioner );
+
+                tLinProblem->assemble_jacobian();
+                tLinProblem->assemble_residual();
+
+                sint tError = tLinSolver->solve_linear_system( tLinProblem );
+
+                CHECK( tError == 0 );
+
+                // double precision accuracy is recovered
+                Matrix< DDRMat > tRelativeResidualNorm = tLinProblem->compute_residual_of_linear_system();
+
+                CHECK( tRelativeResidualNorm( 0 ) < 1.0e-9 );
+                CHECK( tRelativeResidualNorm( 1 ) < 1.0e-9 );
+
+                moris::Matrix< DDRMat > tSol;
+                tLinProblem->get_solution( tSol );
+
+                CHECK( equal_to( tSol( 5, 0 ), -0.0138889, 1.0e+08 ) );
+                CHECK( equal_to( tSol( 12, 0 ), -0.00694444, 1.0e+08 ) );
+
+                CHECK( equal_to( tSol( 5, 1 ), -0.0138889, 1.0e+08 ) );
+                CHECK( equal_to( tSol( 12, 1 ), -0.00694444, 1.0e+08 ) );
+
+                // delete local variables
+                delete tPreconditioner;
+                delete tSolverInterface;
+                delete tLinProblem;
+            }
+        }
+    }
+
+    TEST_CASE( "Native LOBPCG Eigen Solver", "[Native Linear Solver],[Eigen Solver],[DistLinAlg]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Solver_Interface* tSolverInterface = new Solver_Interface_Proxy( 1 );
+
+            Solver_Factory tSolFactory;
+
+            Linear_Problem* tLinProblem = tSolFactory.create_linear_system( tSolverInterface, sol::MapType::Native );
+
+            tLinProblem->assemble_jacobian();
+
+            // dense copy of the operator from products with unit vectors
+            sol::Dist_Vector* tLHS     = tLinProblem->get_free_solver_LHS();
+            sint              tNumDofs = tLHS->vec_local_length();
+
+            sol::Matrix_Vector_Factory tVecFactory( sol::MapType::Native );
+
+            sol::Dist_Vector* tUnitVectors = tVecFactory.create_vector( tLHS->get_map(), tNumDofs );
+            sol::Dist_Vector* tColumns     = tVecFactory.create_vector( tLHS->get_map(), tNumDofs );
+
+            tUnitVectors->vec_put_scalar( 0.0 );
+
+            for ( sint iDof = 0; iDof < tNumDofs; iDof++ )
+            {
+                tUnitVectors->get_values_pointer()[ iDof * tNumDofs + iDof ] = 1.0;
+            }
+
+            tLinProblem->get_matrix()->mat_vec_product( *tUnitVectors, *tColumns, false );
+
+            Matrix< DDRMat > tDense( tNumDofs, tNumDofs );
+
+            std::copy( tColumns->get_values_pointer(), tColumns->get_values_pointer() + tNumDofs * tNumDofs, tDense.data() );
+
+            Matrix< DDRMat > tReferenceValues;
+            Matrix< DDRMat > tReferenceVectors;
+            eig_sym( tReferenceValues, tReferenceVectors, tDense );
+
+            // three smallest eigenvalues with Jacobi preconditioner
+            Parameter_List tEigenSolverParameterList = prm::create_lobpcg_algorithm_parameter_list();
+            tEigenSolverParameterList.set( "Num_Eig_Vals", 3 );
+            tEigenSolverParameterList.set( "Convergence_Tolerance", 1e-10 );
+            tEigenSolverParameterList.set( "Update_Flag", false );
+
+            std::shared_ptr< Linear_Solver_Algorithm > tEigenSolver = tSolFactory.create_solver( tEigenSolverParameterList );
+
+            Parameter_List tPrecParameterList = prm::create_preconditioner_parameter_list( sol::PreconditionerType::NATIVE );
+            tPrecParameterList.set( "native_prec_type", std::string( "jacobi" ) );
+
+            Preconditioner* tPreconditioner = tSolFactory.create_preconditioner( tPrecParameterList );
+            tEigenSolver->set_preconditioner( tPreconditioner );
+
+            // second solve is warm started from the eigenvectors of the first one
+            for ( uint iSolve = 0; iSolve < 2; iSolve++ )
+            {
+                sint tError = tEigenSolver->solve_linear_system( tLinProblem );
+
+                CHECK( tError == 0 );
+
+                const Vector< real >& tEigenValues = dynamic_cast< Eigen_Solver_LOBPCG* >( tEigenSolver.get() )->get_eigenvalues();
+
+                REQUIRE( tEigenValues.size() == 3 );
+
+                for ( uint iEigen = 0; iEigen < 3; iEigen++ )
+                {
+                    CHECK( std::abs( tEigenValues( iEigen ) - tReferenceValues( iEigen ) ) < 1.0e-8 * tReferenceValues( tNumDofs - 1 ) );
+                }
+            }
+
+            // delete local variables
+            delete tUnitVectors;
+            delete tColumns;
+            delete tPreconditioner;
+            delete tSolverInterface;
+            delete tLinProblem;
+        }
+    }
+}    // namespace moris::dla
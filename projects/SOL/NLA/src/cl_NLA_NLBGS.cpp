@@ -14,6 +14,7 @@
 #include "cl_NLA_Convergence.hpp"
 #include "cl_NLA_Nonlinear_Solver.hpp"
 #include "cl_NLA_Solver_Load_Control.hpp"
+#include "cl_NLA_Solver_Acceleration.hpp"
 #include "cl_NLA_Solver_Pseudo_Time_Control.hpp"
 
 #include "cl_DLA_Linear_Solver_Algorithm.hpp"
@@ -66,6 +67,12 @@ void NonLinBlockGaussSeidel::solver_nonlinear_system( Nonlinear_Problem* aNonlin
             aNonlinearProblem->get_full_vector(),
             mMyNonLinSolverManager );
 
+    // set acceleration strategy for NLBGS iterations
+    Solver_Acceleration tAcceleration(
+            mParameterListNonlinearSolver,
+            aNonlinearProblem->get_full_vector(),
+            aNonlinearProblem->get_map_type() );
+
     // initialize load control parameter
     real tLoadFactor = tLoadControlStrategy.get_initial_load_factor();
 
@@ -121,6 +128,9 @@ void NonLinBlockGaussSeidel::solver_nonlinear_system( Nonlinear_Problem* aNonlin
                 "LoadFactor",
                 tLoadFactor );
 
+        // store solution before sweep over all non-linear systems
+        tAcceleration.store_input( aNonlinearProblem->get_full_vector() );
+
         // switch between forward and backward system
         if ( mMyNonLinSolverManager->get_solver_interface()->is_forward_analysis() )
         {
@@ -190,6 +200,13 @@ void NonLinBlockGaussSeidel::solver_nonlinear_system( Nonlinear_Problem* aNonlin
             break;
         }
 
+        // replace solution after sweep by accelerated iterate
+        tAcceleration.accelerate( aNonlinearProblem->get_full_vector() );
+
+        // store time step size and load factor used in this iteration
+        real tPreviousPseudoTimeStep = tPseudoTimeStep;
+        real tPreviousLoadFactor     = tLoadFactor;
+
         // compute new time step size and check for convergence of time stepping
         tTimeStepIsConverged = tPseudoTimeControl.compute_time_step_size(
                 mMyNonLinSolverManager,
@@ -204,6 +221,12 @@ void NonLinBlockGaussSeidel::solver_nonlinear_system( Nonlinear_Problem* aNonlin
                 It,
                 mMyNonLinSolverManager,
                 tLoadFactor );
+
+        // previous iterates are not consistent with new time step size or load factor
+        if ( tPseudoTimeStep != tPreviousPseudoTimeStep or tLoadFactor != tPreviousLoadFactor )
+        {
+            tAcceleration.reset();
+        }
     }    // end loop for NLBGS iterations
 }
 
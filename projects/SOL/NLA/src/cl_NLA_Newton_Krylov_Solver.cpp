@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_NLA_Newton_Krylov_Solver.cpp
+ *
+ */
+
+#include <cmath>
+
+#include "cl_NLA_Newton_Krylov_Solver.hpp"
+
+#include "cl_NLA_Convergence.hpp"
+#include "cl_NLA_Nonlinear_Solver.hpp"
+#include "cl_NLA_Nonlinear_Problem.hpp"
+#include "cl_NLA_Solver_Relaxation.hpp"
+
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+
+#include "cl_DLA_Solver_Interface.hpp"
+#include "cl_DLA_Linear_Solver.hpp"
+#include "cl_DLA_Linear_Problem.hpp"
+
+// Logging package
+#include "cl_Logger.hpp"
+#include "cl_Tracer.hpp"
+
+using namespace moris;
+using namespace NLA;
+using namespace dla;
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+Newton_Krylov_Solver::Newton_Krylov_Solver( const Parameter_List& aParameterlist )
+        : Newton_Solver( aParameterlist )
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+Newton_Krylov_Solver::~Newton_Krylov_Solver()
+{
+    this->delete_vectors();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Newton_Krylov_Solver::solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem )
+{
+    // adjoint problems require the transposed Jacobian, which cannot be applied matrix-free
+    if ( !mMyNonLinSolverManager->get_solver_interface()->is_forward_analysis() )
+    {
+        Newton_Solver::solver_nonlinear_system( aNonlinearProblem );
+        return;
+    }
+
+    Tracer tTracer( "NonLinearAlgorithm", "NewtonKrylov", "Solve" );
+
+    // set nonlinear system
+    mNonlinearProblem = aNonlinearProblem;
+
+    // create work vectors
+    this->create_vectors();
+
+    // get maximum number of iterations
+    sint tMaxIts = mParameterListNonlinearSolver.get< sint >( "NLA_max_iter" );
+
+    // increase maximum number of iterations by one if static residual is required
+    if ( mMyNonLinSolverManager->get_compute_static_residual_flag() )
+    {
+        tMaxIts++;
+    }
+
+    // get iteration id when references norm are computed
+    sint tRefIts = mParameterListNonlinearSolver.get< sint >( "NLA_ref_iter" );
+
+    // get option for computing residual and jacobian: separate or together
+    bool tCombinedResJacAssembly = mParameterListNonlinearSolver.get< bool >( "NLA_combined_res_jac_assembly" );
+
+    // get number of Newton iterations between assemblies of the Jacobian used for preconditioning
+    sint tJacobianUpdate = mParameterListNonlinearSolver.get< sint >( "NLA_JFNK_jacobian_update" );
+
+    // set relaxation strategy
+    Solver_Relaxation tRelaxationStrategy( mParameterListNonlinearSolver );
+
+    real tRelaxationParameter = 0.0;
+
+    // initialize convergence monitoring
+    Convergence tConvergence( tRefIts );
+
+    dla::Linear_Problem* tLinearProblem = mNonlinearProblem->get_linearized_problem();
+
+    // Newton loop
+    for ( sint It = 1; It <= tMaxIts; ++It )
+    {
+        // log solver iteration
+        MORIS_LOG_ITERATION();
+
+        // assemble Jacobian for preconditioning in first iteration and then every tJacobianUpdate iterations
+        bool tAssembleJacobian = tJacobianUpdate > 0 && ( It - 1 ) % tJacobianUpdate == 0;
+
+        mNonlinearProblem->build_linearized_problem( tAssembleJacobian, tAssembleJacobian && tCombinedResJacAssembly, It );
+
+        if ( tAssembleJacobian )
+        {
+            mNumPreconditionerApplications = 0;
+        }
+
+        // check for convergence
+        bool tHardBreak = false;
+
+        bool tIsConverged = tConvergence.check_for_convergence(
+                this,
+                It,
+                tMaxIts,
+                tHardBreak );
+
+        // exit if convergence criterion is met
+        if ( tIsConverged )
+        {
+            MORIS_LOG_INFO( "Number of Iterations (Convergence): %d", It );
+            break;
+        }
+
+        // check if hard break is triggered or maximum iterations are reached
+        if ( tHardBreak or ( It == tMaxIts && tMaxIts > 1 ) )
+        {
+            MORIS_LOG_INFO( "Number of Iterations (Hard Stop): %d", It );
+            break;
+        }
+
+        // Determine if new search direction needs to be computed and compute relaxation value
+        bool tComputeSearchDirection = tRelaxationStrategy.eval(
+                It,
+                mMyNonLinSolverManager,
+                tRelaxationParameter );
+
+        // compute Newton correction
+        if ( tComputeSearchDirection )
+        {
+            uint tKrylovIterations = this->solve_for_correction( It );
+
+            MORIS_LOG_SPEC( "LinearSolverIterations", tKrylovIterations );
+        }
+
+        // Update solution
+        tLinearProblem->get_free_solver_LHS()->vec_plus_vec( 1.0, *mCorrection, 0.0 );
+
+        ( mNonlinearProblem->get_full_vector() )->vec_plus_vec(    //
+                -tRelaxationParameter,
+                *tLinearProblem->get_full_solver_LHS(),
+                1.0 );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Newton_Krylov_Solver::create_vectors()
+{
+    this->delete_vectors();
+
+    // create vectors with the maps of the residual and the full solution
+    sol::Matrix_Vector_Factory tVecFactory( mNonlinearProblem->get_map_type() );
+
+    Solver_Interface* tSolverInterface = mMyNonLinSolverManager->get_solver_interface();
+
+    sol::Dist_Vector* tRHS = mNonlinearProblem->get_linearized_problem()->get_solver_RHS();
+
+    mResidual   = tVecFactory.create_vector( tSolverInterface, tRHS->get_map(), 1 );
+    mCorrection = tVecFactory.create_vector( tSolverInterface, tRHS->get_map(), 1 );
+    mSolution   = tVecFactory.create_vector( tSolverInterface, mNonlinearProblem->get_full_vector()->get_map(), 1 );
+
+    mCorrection->vec_put_scalar( 0.0 );
+
+    // Krylov basis has one vector more than the maximum number of iterations
+    uint tMaxKrylovIts = mParameterListNonlinearSolver.get< sint >( "NLA_JFNK_max_krylov_iter" );
+
+    mBasis.resize( tMaxKrylovIts + 1, nullptr );
+    mPreconditionedBasis.resize( tMaxKrylovIts, nullptr );
+
+    for ( auto& tVector : mBasis )
+    {
+        tVector = tVecFactory.create_vector( tSolverInterface, tRHS->get_map(), 1 );
+    }
+
+    for ( auto& tVector : mPreconditionedBasis )
+    {
+        tVector = tVecFactory.create_vector( tSolverInterface, tRHS->get_map(), 1 );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Newton_Krylov_Solver::delete_vectors()
+{
+    delete mResidual;
+    delete mCorrection;
+    delete mSolution;
+
+    mResidual   = nullptr;
+    mCorrection = nullptr;
+    mSolution   = nullptr;
+
+    for ( auto& tVector : mBasis )
+    {
+        delete tVector;
+    }
+
+    for ( auto& tVector : mPreconditionedBasis )
+    {
+        delete tVector;
+    }
+
+    mBasis.clear();
+    mPreconditionedBasis.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+uint Newton_Krylov_Solver::solve_for_correction( sint aIter )
+{
+    Tracer tTracer( "NonLinearAlgorithm", "NewtonKrylov", "SolveForCorrection" );
+
+    uint tMaxKrylovIts = mPreconditionedBasis.size();
+    real tForcingTerm  = mParameterListNonlinearSolver.get< real >( "NLA_JFNK_forcing_term" );
+    bool tPrecondition = mParameterListNonlinearSolver.get< sint >( "NLA_JFNK_jacobian_update" ) > 0;
+
+    // store residual and solution of current Newton iteration
+    mResidual->vec_plus_vec( 1.0, *mNonlinearProblem->get_linearized_problem()->get_solver_RHS(), 0.0 );
+    mSolution->vec_plus_vec( 1.0, *mNonlinearProblem->get_full_vector(), 0.0 );
+
+    // initial guess of zero: initial Krylov residual is the nonlinear residual
+    mCorrection->vec_put_scalar( 0.0 );
+
+    real tBeta = mResidual->vec_norm2()( 0 );
+
+    if ( tBeta == 0.0 )
+    {
+        return 0;
+    }
+
+    mBasis( 0 )->vec_plus_vec( 1.0 / tBeta, *mResidual, 0.0 );
+
+    // Hessenberg matrix, Givens rotations and right hand side of least squares problem
+    Matrix< DDRMat > tHessenberg( tMaxKrylovIts + 1, tMaxKrylovIts, 0.0 );
+    Matrix< DDRMat > tCosine( tMaxKrylovIts, 1, 0.0 );
+    Matrix< DDRMat > tSine( tMaxKrylovIts, 1, 0.0 );
+    Matrix< DDRMat > tRHS( tMaxKrylovIts + 1, 1, 0.0 );
+
+    tRHS( 0 ) = tBeta;
+
+    uint tNumIts = 0;
+
+    while ( tNumIts < tMaxKrylovIts )
+    {
+        uint j = tNumIts++;
+
+        // right preconditioning; the preconditioned vectors are stored as the preconditioner may change
+        if ( tPrecondition )
+        {
+            this->apply_preconditioner( mBasis( j ), mPreconditionedBasis( j ) );
+        }
+        else
+        {
+            mPreconditionedBasis( j )->vec_plus_vec( 1.0, *mBasis( j ), 0.0 );
+        }
+
+        this->apply_jacobian( mPreconditionedBasis( j ), mBasis( j + 1 ) );
+
+        // modified Gram-Schmidt orthogonalization
+        for ( uint i = 0; i <= j; i++ )
+        {
+            tHessenberg( i, j ) = mBasis( j + 1 )->dot( *mBasis( i ) );
+
+            mBasis( j + 1 )->vec_plus_vec( -tHessenberg( i, j ), *mBasis( i ), 1.0 );
+        }
+
+        tHessenberg( j + 1, j ) = mBasis( j + 1 )->vec_norm2()( 0 );
+
+        if ( tHessenberg( j + 1, j ) > 0.0 )
+        {
+            mBasis( j + 1 )->scale_vector( 1.0 / tHessenberg( j + 1, j ) );
+        }
+
+        // apply previous Givens rotations to new column
+        for ( uint i = 0; i < j; i++ )
+        {
+            real tTemp              = tCosine( i ) * tHessenberg( i, j ) + tSine( i ) * tHessenberg( i + 1, j );
+            tHessenberg( i + 1, j ) = -tSine( i ) * tHessenberg( i, j ) + tCosine( i ) * tHessenberg( i + 1, j );
+            tHessenberg( i, j )     = tTemp;
+        }
+
+        // compute and apply new Givens rotation
+        real tNorm = std::hypot( tHessenberg( j, j ), tHessenberg( j + 1, j ) );
+
+        // breakdown: the new column vanishes, i.e. the Krylov space does not grow anymore and the
+        // least squares solution of the previous iteration is kept
+        if ( tNorm == 0.0 )
+        {
+            MORIS_LOG_WARNING( "Newton_Krylov_Solver::solve_for_correction - breakdown in Krylov iteration %d.", j );
+
+            tNumIts--;
+
+            break;
+        }
+
+        tCosine( j ) = tHessenberg( j, j ) / tNorm;
+        tSine( j )   = tHessenberg( j + 1, j ) / tNorm;
+
+        tHessenberg( j, j )     = tNorm;
+        tHessenberg( j + 1, j ) = 0.0;
+
+        tRHS( j + 1 ) = -tSine( j ) * tRHS( j );
+        tRHS( j )     = tCosine( j ) * tRHS( j );
+
+        // inexact Newton: stop once the linear residual has dropped by the forcing term
+        if ( std::abs( tRHS( j + 1 ) ) <= tForcingTerm * tBeta )
+        {
+            break;
+        }
+    }
+
+    // solve upper triangular system for the coefficients of the preconditioned basis
+    Matrix< DDRMat > tCoefficients( tNumIts, 1, 0.0 );
+
+    for ( sint i = tNumIts - 1; i >= 0; i-- )
+    {
+        real tSum = tRHS( i );
+
+        for ( uint k = i + 1; k < tNumIts; k++ )
+        {
+            tSum -= tHessenberg( i, k ) * tCoefficients( k );
+        }
+
+        tCoefficients( i ) = tSum / tHessenberg( i, i );
+    }
+
+    for ( uint i = 0; i < tNumIts; i++ )
+    {
+        mCorrection->vec_plus_vec( tCoefficients( i ), *mPreconditionedBasis( i ), 1.0 );
+    }
+
+    MORIS_LOG_SPEC( "LinearResidualNorm", std::abs( tRHS( tNumIts ) ) / tBeta );
+
+    // restore residual of current Newton iteration
+    mNonlinearProblem->get_linearized_problem()->get_solver_RHS()->vec_plus_vec( 1.0, *mResidual, 0.0 );
+
+    return tNumIts;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Newton_Krylov_Solver::apply_jacobian(
+        sol::Dist_Vector* aVector,
+        sol::Dist_Vector* aProduct )
+{
+    dla::Linear_Problem* tLinearProblem = mNonlinearProblem->get_linearized_problem();
+    sol::Dist_Vector*    tFullVector    = mNonlinearProblem->get_full_vector();
+
+    real tVectorNorm = aVector->vec_norm2()( 0 );
+
+    if ( tVectorNorm == 0.0 )
+    {
+        aProduct->vec_put_scalar( 0.0 );
+        return;
+    }
+
+    // perturbation size relative to the magnitude of the solution
+    real tPerturbation = mParameterListNonlinearSolver.get< real >( "NLA_JFNK_perturbation" )
+                       * ( 1.0 + mSolution->vec_norm2()( 0 ) ) / tVectorNorm;
+
+    // perturb solution in direction of vector
+    tLinearProblem->get_free_solver_LHS()->vec_plus_vec( 1.0, *aVector, 0.0 );
+
+    tFullVector->vec_plus_vec( tPerturbation, *tLinearProblem->get_full_solver_LHS(), 1.0 );
+
+    // assemble perturbed residual
+    tLinearProblem->assemble_residual();
+
+    // forward difference
+    aProduct->vec_plus_vec( 1.0 / tPerturbation, *tLinearProblem->get_solver_RHS(), 0.0 );
+    aProduct->vec_plus_vec( -1.0 / tPerturbation, *mResidual, 1.0 );
+
+    // restore solution
+    tFullVector->vec_plus_vec( 1.0, *mSolution, 0.0 );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+void Newton_Krylov_Solver::apply_preconditioner(
+        sol::Dist_Vector* aVector,
+        sol::Dist_Vector* aResult )
+{
+    dla::Linear_Problem* tLinearProblem = mNonlinearProblem->get_linearized_problem();
+
+    tLinearProblem->get_solver_RHS()->vec_plus_vec( 1.0, *aVector, 0.0 );
+    tLinearProblem->get_free_solver_LHS()->vec_put_scalar( 0.0 );
+
+    // the first application after a Jacobian assembly is passed as first iteration, such that the
+    // preconditioner of the linear solver is rebuilt only once per assembled Jacobian if reuse is enabled
+    mLinSolverManager->solver_linear_system( tLinearProblem, ++mNumPreconditionerApplications );
+
+    aResult->vec_plus_vec( 1.0, *tLinearProblem->get_free_solver_LHS(), 0.0 );
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
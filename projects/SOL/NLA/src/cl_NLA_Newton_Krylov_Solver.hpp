@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_NLA_Newton_Krylov_Solver.hpp
+ *
+ */
+
+#ifndef SRC_FEM_CL_NEWTON_KRYLOV_SOLVER_HPP_
+#define SRC_FEM_CL_NEWTON_KRYLOV_SOLVER_HPP_
+
+#include "moris_typedefs.hpp"
+#include "cl_Vector.hpp"
+#include "cl_NLA_Newton_Solver.hpp"
+
+namespace moris
+{
+    namespace sol
+    {
+        class Dist_Vector;
+    }
+    namespace NLA
+    {
+        /**
+         * @brief Jacobian-free Newton-Krylov solver
+         *
+         * The Newton correction is computed with a flexible GMRES method in which the product of the Jacobian
+         * with a vector is approximated by a finite difference of the residual. The assembled Jacobian is only
+         * used for preconditioning through the linear solver and is refreshed every "NLA_JFNK_jacobian_update"
+         * Newton iterations; if this parameter is zero, no Jacobian is assembled and GMRES is not preconditioned.
+         * Adjoint sensitivity analyses require the transposed Jacobian and are solved by the Newton solver.
+         */
+        class Newton_Krylov_Solver : public Newton_Solver
+        {
+          private:
+            //! residual of the current Newton iteration
+            sol::Dist_Vector* mResidual = nullptr;
+
+            //! solution of the current Newton iteration, restored after each residual perturbation
+            sol::Dist_Vector* mSolution = nullptr;
+
+            //! Newton correction
+            sol::Dist_Vector* mCorrection = nullptr;
+
+            //! Krylov basis vectors and preconditioned basis vectors
+            Vector< sol::Dist_Vector* > mBasis;
+            Vector< sol::Dist_Vector* > mPreconditionedBasis;
+
+            //! number of preconditioner applications since the last Jacobian assembly
+            sint mNumPreconditionerApplications = 0;
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief creates the work vectors for the current nonlinear problem
+             */
+            void create_vectors();
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief deletes the work vectors
+             */
+            void delete_vectors();
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief computes the Newton correction with matrix-free flexible GMRES
+             *
+             * @param[in] aIter Newton iteration
+             * @return number of GMRES iterations
+             */
+            uint solve_for_correction( sint aIter );
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief approximates the product of the Jacobian with a vector by a forward difference of the residual
+             *
+             * @param[in] aVector vector to be multiplied
+             * @param[out] aProduct Jacobian times vector
+             */
+            void apply_jacobian(
+                    sol::Dist_Vector* aVector,
+                    sol::Dist_Vector* aProduct );
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief applies the preconditioner, i.e. solves a linear system with the last assembled Jacobian
+             *
+             * @param[in] aVector vector to be preconditioned
+             * @param[out] aResult preconditioned vector
+             */
+            void apply_preconditioner(
+                    sol::Dist_Vector* aVector,
+                    sol::Dist_Vector* aResult );
+
+          public:
+            //--------------------------------------------------------------------------------------------------
+
+            Newton_Krylov_Solver( const Parameter_List& aParameterlist );
+
+            //--------------------------------------------------------------------------------------------------
+
+            ~Newton_Krylov_Solver() override;
+
+            //--------------------------------------------------------------------------------------------------
+
+            /**
+             * @brief Call to solve the nonlinear system
+             *
+             * @param[in] aNonlinearProblem Nonlinear problem
+             */
+            void solver_nonlinear_system( Nonlinear_Problem* aNonlinearProblem ) override;
+        };
+    }    // namespace NLA
+}    // namespace moris
+
+#endif /* SRC_FEM_CL_NEWTON_KRYLOV_SOLVER_HPP_ */
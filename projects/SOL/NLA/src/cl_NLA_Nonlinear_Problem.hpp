@@ -161,6 +161,14 @@ namespace moris
 
             //--------------------------------------------------------------------------------------------------
 
+            enum sol::MapType
+            get_map_type() const
+            {
+                return mMapType;
+            }
+
+            //--------------------------------------------------------------------------------------------------
+
             void extract_my_values(
                     const moris::uint&                 aNumIndices,
                     const moris::Matrix< DDSMat >&     aGlobalBlockRows,
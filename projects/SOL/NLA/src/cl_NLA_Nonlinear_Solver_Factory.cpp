@@ -12,6 +12,7 @@
 #include "cl_DLA_Solver_Interface.hpp"
 
 #include "cl_NLA_Newton_Solver.hpp"
+#include "cl_NLA_Newton_Krylov_Solver.hpp"
 #include "cl_NLA_NLBGS.hpp"
 #include "cl_NLA_Nonlinear_Algorithm.hpp"
 //#include "cl_NLA_Arc_Length.hpp"
@@ -30,6 +31,9 @@ namespace moris::NLA
             case ( NonlinearSolverType::NLBGS_SOLVER ):
                 tNonLinSys = std::make_shared< NonLinBlockGaussSeidel >( aParameterList );
                 break;
+            case ( NonlinearSolverType::NEWTON_KRYLOV_SOLVER ):
+                tNonLinSys = std::make_shared< Newton_Krylov_Solver >( aParameterList );
+                break;
         //        case ( NonlinearSolverType::ARC_LENGTH_SOLVER ):
         //            tNonLinSys = std::make_shared< Arc_Length_Solver >();
         //            break;
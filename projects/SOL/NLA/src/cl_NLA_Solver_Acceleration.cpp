@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_NLA_Solver_Acceleration.cpp
+ *
+ */
+#include "cl_NLA_Solver_Acceleration.hpp"
+
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+
+#include "cl_Matrix.hpp"
+#include "fn_inv.hpp"
+
+#include "cl_Communication_Tools.hpp"
+
+#include "cl_Logger.hpp"
+#include "cl_Tracer.hpp"
+
+namespace moris::NLA
+{
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    Solver_Acceleration::Solver_Acceleration(
+            Parameter_List&   aParameterListNonlinearSolver,
+            sol::Dist_Vector* aSolution,
+            sol::MapType      aMapType )
+    {
+        // get acceleration strategy
+        mAccelerationStrategy = aParameterListNonlinearSolver.get< sol::SolverAccelerationType >( "NLA_acceleration_strategy" );
+
+        // get number of stored iterates
+        mDepth = aParameterListNonlinearSolver.get< sint >( "NLA_acceleration_depth" );
+
+        // get damping of fixed point residual
+        mDamping = aParameterListNonlinearSolver.get< real >( "NLA_acceleration_damping" );
+
+        if ( this->is_active() )
+        {
+            MORIS_ERROR( mDepth > 0,
+                    "Solver_Acceleration::Solver_Acceleration - acceleration depth has to be positive." );
+
+            this->create_vectors( aSolution, aMapType );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    Solver_Acceleration::~Solver_Acceleration()
+    {
+        delete mInput;
+        delete mResidual;
+        delete mPreviousResidual;
+        delete mPreviousOutput;
+
+        for ( auto& tVector : mResidualDifferences )
+        {
+            delete tVector;
+        }
+
+        for ( auto& tVector : mOutputDifferences )
+        {
+            delete tVector;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    void
+    Solver_Acceleration::create_vectors(
+            sol::Dist_Vector* aSolution,
+            sol::MapType      aMapType )
+    {
+        sol::Matrix_Vector_Factory tVecFactory( aMapType );
+
+        mInput            = tVecFactory.create_vector( aSolution->get_map(), 1 );
+        mResidual         = tVecFactory.create_vector( aSolution->get_map(), 1 );
+        mPreviousResidual = tVecFactory.create_vector( aSolution->get_map(), 1 );
+        mPreviousOutput   = tVecFactory.create_vector( aSolution->get_map(), 1 );
+
+        mResidualDifferences.resize( mDepth, nullptr );
+        mOutputDifferences.resize( mDepth, nullptr );
+
+        for ( uint iDifference = 0; iDifference < mDepth; iDifference++ )
+        {
+            mResidualDifferences( iDifference ) = tVecFactory.create_vector( aSolution->get_map(), 1 );
+            mOutputDifferences( iDifference )   = tVecFactory.create_vector( aSolution->get_map(), 1 );
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    void
+    Solver_Acceleration::store_input( sol::Dist_Vector* aSolution )
+    {
+        if ( !this->is_active() )
+        {
+            return;
+        }
+
+        mInput->vec_plus_vec( 1.0, *aSolution, 0.0 );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    void
+    Solver_Acceleration::accelerate( sol::Dist_Vector* aSolution )
+    {
+        if ( !this->is_active() )
+        {
+            return;
+        }
+
+        Tracer tTracer( "NonLinearAlgorithm", "Acceleration", "Anderson" );
+
+        // fixed point residual: output minus input
+        mResidual->vec_plus_vec( 1.0, *aSolution, 0.0 );
+        mResidual->vec_plus_vec( -1.0, *mInput, 1.0 );
+
+        // store differences to previous iteration, overwriting the oldest ones
+        if ( mHasPreviousIteration )
+        {
+            mResidualDifferences( mNextDifference )->vec_plus_vec( 1.0, *mResidual, 0.0 );
+            mResidualDifferences( mNextDifference )->vec_plus_vec( -1.0, *mPreviousResidual, 1.0 );
+
+            mOutputDifferences( mNextDifference )->vec_plus_vec( 1.0, *aSolution, 0.0 );
+            mOutputDifferences( mNextDifference )->vec_plus_vec( -1.0, *mPreviousOutput, 1.0 );
+
+            mNextDifference = ( mNextDifference + 1 ) % mDepth;
+            mNumDifferences = std::min( mNumDifferences + 1, mDepth );
+        }
+
+        mPreviousResidual->vec_plus_vec( 1.0, *mResidual, 0.0 );
+        mPreviousOutput->vec_plus_vec( 1.0, *aSolution, 0.0 );
+
+        mHasPreviousIteration = true;
+
+        // coefficients minimizing the linearized residual || f - dF * gamma ||, from the normal equations
+        Matrix< DDRMat > tCoefficients( mNumDifferences, 1, 0.0 );
+
+        if ( mNumDifferences > 0 )
+        {
+            Matrix< DDRMat > tNormalMatrix( mNumDifferences, mNumDifferences, 0.0 );
+            Matrix< DDRMat > tNormalRHS( mNumDifferences, 1, 0.0 );
+
+            real tTrace = 0.0;
+
+            for ( uint i = 0; i < mNumDifferences; i++ )
+            {
+                for ( uint j = i; j < mNumDifferences; j++ )
+                {
+                    tNormalMatrix( i, j ) = mResidualDifferences( i )->dot( *mResidualDifferences( j ) );
+                    tNormalMatrix( j, i ) = tNormalMatrix( i, j );
+                }
+
+                tNormalRHS( i ) = mResidualDifferences( i )->dot( *mResidual );
+
+                tTrace += tNormalMatrix( i, i );
+            }
+
+            // regularize nearly linearly dependent differences
+            for ( uint i = 0; i < mNumDifferences; i++ )
+            {
+                tNormalMatrix( i, i ) += 1.0e-12 * tTrace;
+            }
+
+            tCoefficients = inv( tNormalMatrix ) * tNormalRHS;
+        }
+
+        // accelerated iterate: g - dG * gamma - ( 1 - beta ) * ( f - dF * gamma )
+        aSolution->vec_plus_vec( -( 1.0 - mDamping ), *mResidual, 1.0 );
+
+        for ( uint i = 0; i < mNumDifferences; i++ )
+        {
+            aSolution->vec_plus_vec( -tCoefficients( i ), *mOutputDifferences( i ), 1.0 );
+            aSolution->vec_plus_vec( ( 1.0 - mDamping ) * tCoefficients( i ), *mResidualDifferences( i ), 1.0 );
+        }
+
+        MORIS_LOG_SPEC( "AccelerationDepth", mNumDifferences );
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+
+    void
+    Solver_Acceleration::reset()
+    {
+        mNumDifferences       = 0;
+        mNextDifference       = 0;
+        mHasPreviousIteration = false;
+    }
+
+    //--------------------------------------------------------------------------------------------------------------------------
+}    // namespace moris::NLA
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_NLA_Solver_Acceleration.hpp
+ *
+ */
+#ifndef SRC_FEM_CL_NLA_SOLVER_ACCELERATION_HPP_
+#define SRC_FEM_CL_NLA_SOLVER_ACCELERATION_HPP_
+
+#include "cl_Parameter_List.hpp"
+#include "cl_Vector.hpp"
+
+#include "cl_SOL_Enums.hpp"
+
+namespace moris::sol
+{
+    class Dist_Vector;
+}
+
+namespace moris::NLA
+{
+    /**
+     * Acceleration of fixed point iterations, e.g. the sweeps of a nonlinear block Gauss-Seidel solver.
+     *
+     * With the Anderson strategy, the next iterate is the combination of the last iterates which minimizes the
+     * linearized fixed point residual. With a damping of one, this is the interface quasi-Newton method with
+     * inverse Jacobian from a least-squares model (IQN-ILS) applied to the full solution vector.
+     */
+    class Solver_Acceleration
+    {
+      private:
+        /// acceleration strategy
+        sol::SolverAccelerationType mAccelerationStrategy;
+
+        /// maximum number of stored iterates
+        uint mDepth;
+
+        /// damping of the fixed point residual
+        real mDamping;
+
+        /// input and fixed point residual of the current iteration
+        sol::Dist_Vector* mInput    = nullptr;
+        sol::Dist_Vector* mResidual = nullptr;
+
+        /// fixed point residual and output of the previous iteration
+        sol::Dist_Vector* mPreviousResidual = nullptr;
+        sol::Dist_Vector* mPreviousOutput   = nullptr;
+
+        /// differences of fixed point residuals and outputs of consecutive iterations, stored cyclically
+        Vector< sol::Dist_Vector* > mResidualDifferences;
+        Vector< sol::Dist_Vector* > mOutputDifferences;
+
+        /// number of stored differences and position of the next difference
+        uint mNumDifferences = 0;
+        uint mNextDifference = 0;
+
+        /// whether a previous iteration is available
+        bool mHasPreviousIteration = false;
+
+        // creates the work vectors with the map of the solution vector
+        void create_vectors(
+                sol::Dist_Vector* aSolution,
+                sol::MapType      aMapType );
+
+      public:
+        Solver_Acceleration(
+                Parameter_List&   aParameterListNonlinearSolver,
+                sol::Dist_Vector* aSolution,
+                sol::MapType      aMapType );
+
+        ~Solver_Acceleration();
+
+        /*
+         *  returns true if an acceleration strategy is used
+         */
+        bool
+        is_active() const
+        {
+            return mAccelerationStrategy != sol::SolverAccelerationType::None;
+        }
+
+        /*
+         *  stores the input of a fixed point iteration
+         */
+        void store_input( sol::Dist_Vector* aSolution );
+
+        /*
+         *  replaces the output of a fixed point iteration by the accelerated iterate
+         */
+        void accelerate( sol::Dist_Vector* aSolution );
+
+        /*
+         *  removes all stored iterates, e.g. after the fixed point map has changed
+         */
+        void reset();
+    };
+}    // namespace moris::NLA
+
+#endif /* SRC_FEM_CL_NLA_SOLVER_ACCELERATION_HPP_ */
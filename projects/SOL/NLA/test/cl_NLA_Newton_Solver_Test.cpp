@@ -442,6 +442,59 @@ namespace moris
 
         //------------------------------------------------------------------------------
 
+        TEST_CASE( "Newton Krylov Solver Test", "[NLA],[NLA_Test_Newton_Krylov]" )
+        {
+            if ( par_size() == 1 )
+            {
+                Solver_Interface* tSolverInput = new NLA_Solver_Interface_Proxy( 2, 1, 1, 1, test_residual1, test_jacobian1, test_topo1 );
+
+                dla::Linear_Solver* tLinSolManager = new dla::Linear_Solver();
+                Nonlinear_Solver    tNonLinSolManager;
+                tNonLinSolManager.set_solver_interface( tSolverInput );
+
+                Nonlinear_Problem* tNonlinearProblem = new Nonlinear_Problem( tSolverInput );
+
+                Nonlinear_Solver_Factory tNonlinFactory;
+
+                // Jacobian is assembled every other iteration for preconditioning only
+                Parameter_List tNonlinearSolverParameterList = prm::create_nonlinear_algorithm_parameter_list();
+                tNonlinearSolverParameterList.set( "NLA_Solver_Implementation", NonlinearSolverType::NEWTON_KRYLOV_SOLVER );
+                tNonlinearSolverParameterList.set( "NLA_max_iter", 20 );
+                tNonlinearSolverParameterList.set( "NLA_hard_break", false );
+                tNonlinearSolverParameterList.set( "NLA_JFNK_jacobian_update", 2 );
+                tNonlinearSolverParameterList.set( "NLA_JFNK_forcing_term", 1e-6 );
+                std::shared_ptr< Nonlinear_Algorithm > tNonlLinSolverAlgorithm =
+                        tNonlinFactory.create_nonlinear_solver( tNonlinearSolverParameterList );
+
+                tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+                tNonLinSolManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+                dla::Solver_Factory tSolFactory;
+
+                Parameter_List tLinearSolverParameterList = prm::create_linear_algorithm_parameter_list_amesos();
+                std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolver1 = tSolFactory.create_solver( tLinearSolverParameterList );
+
+                tLinSolManager->set_linear_algorithm( 0, tLinSolver1 );
+
+                tNonLinSolManager.solve( tNonlinearProblem );
+
+                Matrix< DDSMat > tGlobalIndExtract( 2, 1, 0 );
+                tGlobalIndExtract( 1, 0 ) = 1;
+                Vector< Matrix< DDRMat > > tMyValues;
+
+                tNonlLinSolverAlgorithm->extract_my_values( 2, tGlobalIndExtract, 0, tMyValues );
+
+                CHECK( equal_to( tMyValues( 0 )( 0, 0 ), 0.04011965, 1.0e+08 ) );
+                CHECK( equal_to( tMyValues( 0 )( 1, 0 ), 0.0154803, 1.0e+08 ) );
+
+                delete ( tNonlinearProblem );
+                delete ( tLinSolManager );
+                delete ( tSolverInput );
+            }
+        }
+
+        //------------------------------------------------------------------------------
+
 #ifdef MORIS_HAVE_PETSC
         TEST_CASE( "Newton Solver Test Petsc", "[NLA],[NLA_Test_Petsc]" )
         {
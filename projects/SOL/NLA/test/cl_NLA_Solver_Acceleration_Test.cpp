@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_NLA_Solver_Acceleration_Test.cpp
+ *
+ */
+
+#include <cmath>
+
+#include "catch.hpp"
+#include "moris_typedefs.hpp"
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "fn_norm.hpp"
+#include "cl_Communication_Tools.hpp"
+
+#include "cl_SOL_Dist_Map.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Matrix_Vector_Factory.hpp"
+#include "cl_SOL_Enums.hpp"
+
+#include "fn_PRM_SOL_Parameters.hpp"
+
+#include "cl_NLA_Solver_Acceleration.hpp"
+
+namespace moris::NLA
+{
+    // solves the coupled system [ I K ; K I ] x = [ b1 ; b2 ] with diagonal coupling K by block Gauss-Seidel
+    // iterations as performed by the NLBGS solver and returns the number of iterations until convergence
+    uint
+    tSolve_NLASolverAcceleration(
+            sol::SolverAccelerationType aAccelerationStrategy,
+            Matrix< DDRMat >&           aSolution )
+    {
+        Matrix< DDRMat > tCoupling = { { 0.975 }, { 0.95 }, { 0.9 }, { 0.7 } };
+        uint             tNumDofs  = tCoupling.numel();
+
+        Matrix< DDSMat > tMyGlobalIds( 2 * tNumDofs, 1 );
+        for ( uint iDof = 0; iDof < 2 * tNumDofs; iDof++ )
+        {
+            tMyGlobalIds( iDof ) = iDof;
+        }
+
+        sol::Matrix_Vector_Factory tVecFactory( sol::MapType::Epetra );
+
+        sol::Dist_Map*    tMap      = tVecFactory.create_map( tMyGlobalIds );
+        sol::Dist_Vector* tSolution = tVecFactory.create_vector( tMap, 1 );
+        tSolution->vec_put_scalar( 0.0 );
+
+        Parameter_List tParameterList = prm::create_nonlinear_algorithm_parameter_list();
+        tParameterList.set( "NLA_acceleration_strategy", aAccelerationStrategy );
+
+        Solver_Acceleration tAcceleration( tParameterList, tSolution, sol::MapType::Epetra );
+
+        uint tMaxIter = 1000;
+        uint tIter    = 1;
+
+        for ( ; tIter <= tMaxIter; tIter++ )
+        {
+            tAcceleration.store_input( tSolution );
+
+            real* tValues = tSolution->get_values_pointer();
+            real  tChange = 0.0;
+
+            // sweep over first and second block
+            for ( uint iDof = 0; iDof < tNumDofs; iDof++ )
+            {
+                real tNewValue = 1.0 - tCoupling( iDof ) * tValues[ tNumDofs + iDof ];
+                tChange += std::pow( tNewValue - tValues[ iDof ], 2 );
+                tValues[ iDof ] = tNewValue;
+            }
+
+            for ( uint iDof = 0; iDof < tNumDofs; iDof++ )
+            {
+                real tNewValue = 2.0 - tCoupling( iDof ) * tValues[ iDof ];
+                tChange += std::pow( tNewValue - tValues[ tNumDofs + iDof ], 2 );
+                tValues[ tNumDofs + iDof ] = tNewValue;
+            }
+
+            if ( std::sqrt( tChange ) < 1.0e-10 )
+            {
+                break;
+            }
+
+            tAcceleration.accelerate( tSolution );
+        }
+
+        tSolution->extract_copy( aSolution );
+
+        // exact solution of the coupled system
+        Matrix< DDRMat > tExactSolution( 2 * tNumDofs, 1 );
+        for ( uint iDof = 0; iDof < tNumDofs; iDof++ )
+        {
+            tExactSolution( tNumDofs + iDof ) = ( 2.0 - tCoupling( iDof ) ) / ( 1.0 - std::pow( tCoupling( iDof ), 2 ) );
+            tExactSolution( iDof )            = 1.0 - tCoupling( iDof ) * tExactSolution( tNumDofs + iDof );
+        }
+
+        CHECK( norm( aSolution - tExactSolution ) < 1.0e-8 * norm( tExactSolution ) );
+
+        delete tSolution;
+        delete tMap;
+
+        return tIter;
+    }
+
+    TEST_CASE( "NLBGS Anderson Acceleration", "[NLA],[NLA_Acceleration]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Matrix< DDRMat > tSolution;
+            Matrix< DDRMat > tAcceleratedSolution;
+
+            uint tNumIterations            = tSolve_NLASolverAcceleration( sol::SolverAccelerationType::None, tSolution );
+            uint tNumAcceleratedIterations = tSolve_NLASolverAcceleration( sol::SolverAccelerationType::Anderson, tAcceleratedSolution );
+
+            // both converge; the plain iterations contract with the square of the largest coupling only
+            CHECK( tNumIterations < 1000 );
+            CHECK( tNumAcceleratedIterations < 20 );
+            CHECK( tNumAcceleratedIterations < tNumIterations );
+
+            CHECK( norm( tSolution - tAcceleratedSolution ) < 1.0e-8 * norm( tSolution ) );
+        }
+    }
+}    // namespace moris::NLA
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Map_Native.cpp
+ *
+ */
+
+#include "cl_Map_Native.hpp"
+#include "cl_Communication_Tools.hpp"    // COM/src
+#include "fn_print.hpp"
+
+namespace moris
+{
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    Map_Native::Map_Native(
+            const Matrix< DDSMat >& aMyGlobalIds,
+            const Matrix< DDUMat >& aMyConstraintDofs )
+            : Dist_Map()
+    {
+        MORIS_ERROR( par_size() == 1,
+                "Map_Native::Map_Native - native linear algebra backend runs on a single processor only." );
+
+        uint tNumMyDofs = aMyGlobalIds.numel();
+
+        // flag constrained dofs
+        sint tMaxId = tNumMyDofs > 0 ? aMyGlobalIds.max() : -1;
+
+        for ( uint Ik = 0; Ik < aMyConstraintDofs.numel(); Ik++ )
+        {
+            tMaxId = std::max( tMaxId, (sint)aMyConstraintDofs( Ik ) );
+        }
+
+        Vector< bool > tIsConstrained( tMaxId + 1, false );
+
+        for ( uint Ik = 0; Ik < aMyConstraintDofs.numel(); Ik++ )
+        {
+            tIsConstrained( aMyConstraintDofs( Ik ) ) = true;
+        }
+
+        // keep unconstrained dofs only
+        mMyGlobalIds.set_size( tNumMyDofs, 1 );
+
+        uint tCount = 0;
+
+        for ( uint Ik = 0; Ik < tNumMyDofs; Ik++ )
+        {
+            if ( !tIsConstrained( aMyGlobalIds( Ik ) ) )
+            {
+                mMyGlobalIds( tCount++ ) = aMyGlobalIds( Ik );
+            }
+        }
+
+        mMyGlobalIds.resize( tCount, 1 );
+
+        this->build_global_to_local_map();
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    Map_Native::Map_Native( const Matrix< DDSMat >& aMyGlobalIds )
+            : Dist_Map()
+            , mMyGlobalIds( aMyGlobalIds )
+    {
+        MORIS_ERROR( par_size() == 1,
+                "Map_Native::Map_Native - native linear algebra backend runs on a single processor only." );
+
+        this->build_global_to_local_map();
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    Map_Native::Map_Native( const Vector< sint >& aMyGlobalIds )
+            : Dist_Map()
+    {
+        MORIS_ERROR( par_size() == 1,
+                "Map_Native::Map_Native - native linear algebra backend runs on a single processor only." );
+
+        mMyGlobalIds.set_size( aMyGlobalIds.size(), 1 );
+
+        for ( uint Ik = 0; Ik < aMyGlobalIds.size(); Ik++ )
+        {
+            mMyGlobalIds( Ik ) = aMyGlobalIds( Ik );
+        }
+
+        this->build_global_to_local_map();
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    void
+    Map_Native::build_global_to_local_map()
+    {
+        uint tNumMyDofs = mMyGlobalIds.numel();
+
+        sint tMaxId = tNumMyDofs > 0 ? mMyGlobalIds.max() : -1;
+
+        mGlobalToLocal.set_size( tMaxId + 1, 1, -1 );
+
+        for ( uint Ik = 0; Ik < tNumMyDofs; Ik++ )
+        {
+            MORIS_ASSERT( mMyGlobalIds( Ik ) >= 0,
+                    "Map_Native::build_global_to_local_map - negative global ID %d.",
+                    mMyGlobalIds( Ik ) );
+
+            MORIS_ASSERT( mGlobalToLocal( mMyGlobalIds( Ik ) ) == -1,
+                    "Map_Native::build_global_to_local_map - global ID %d appears twice.",
+                    mMyGlobalIds( Ik ) );
+
+            mGlobalToLocal( mMyGlobalIds( Ik ) ) = Ik;
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    void
+    Map_Native::build_dof_translator(
+            const Matrix< IdMat >& aFullMap,
+            const bool             aFlag )
+    {
+        uint tNumFullDofs = aFullMap.numel();
+
+        sint tMaxId = tNumFullDofs > 0 ? aFullMap.max() : -1;
+
+        // initialize every point as constrained
+        mFullToFreePoint.set_size( tMaxId + 1, 1, -1 );
+
+        // on a single processor the point ID is the local index in the free map
+        for ( uint Ik = 0; Ik < tNumFullDofs; Ik++ )
+        {
+            mFullToFreePoint( aFullMap( Ik ) ) = this->return_local_ind_of_global_Id( aFullMap( Ik ) );
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    sint
+    Map_Native::translate_id_to_free_point_id(
+            sint aIdIn,
+            bool aIsBuildGraph ) const
+    {
+        sint tIdOut = -1;
+
+        if ( aIdIn >= 0 && aIdIn < (sint)mFullToFreePoint.numel() )
+        {
+            tIdOut = mFullToFreePoint( aIdIn );
+        }
+
+        // constrained dofs are skipped during assembly
+        if ( !aIsBuildGraph and tIdOut == -1 )
+        {
+            return MORIS_ID_MAX;
+        }
+
+        return tIdOut;
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    void
+    Map_Native::translate_ids_to_free_point_ids(
+            const moris::Matrix< IdMat >& aIdsIn,
+            moris::Matrix< IdMat >&       aIdsOut,
+            const bool&                   aIsBuildGraph )
+    {
+        MORIS_ASSERT( mFullToFreePoint.numel() > 0 || aIdsIn.numel() == 0,
+                "Map_Native::translate_ids_to_free_point_ids(), dof translator not built.\n" );
+
+        uint tNumIds = aIdsIn.numel();
+
+        aIdsOut.set_size( tNumIds, 1 );
+
+        for ( uint Ik = 0; Ik < tNumIds; Ik++ )
+        {
+            aIdsOut( Ik ) = this->translate_id_to_free_point_id( aIdsIn( Ik ), aIsBuildGraph );
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    void
+    Map_Native::translate_ids_to_free_point_ids(
+            const Vector< sint >& aIdsIn,
+            Vector< sint >&       aIdsOut,
+            bool                  aIsBuildGraph )
+    {
+        MORIS_ASSERT( mFullToFreePoint.numel() > 0 || aIdsIn.size() == 0,
+                "Map_Native::translate_ids_to_free_point_ids(), dof translator not built.\n" );
+
+        uint tNumIds = aIdsIn.size();
+
+        aIdsOut.resize( tNumIds );
+
+        for ( uint Ik = 0; Ik < tNumIds; Ik++ )
+        {
+            aIdsOut( Ik ) = this->translate_id_to_free_point_id( aIdsIn( Ik ), aIsBuildGraph );
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    moris::sint
+    Map_Native::return_local_ind_of_global_Id( moris::uint aGlobalId ) const
+    {
+        if ( aGlobalId < mGlobalToLocal.numel() )
+        {
+            return mGlobalToLocal( aGlobalId );
+        }
+
+        return -1;
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+
+    void
+    Map_Native::print()
+    {
+        print( mMyGlobalIds, "Map_Native - global IDs" );
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------------
+}    // namespace moris
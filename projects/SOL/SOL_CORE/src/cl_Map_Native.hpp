@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Map_Native.hpp
+ *
+ */
+
+#pragma once
+
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "cl_Vector.hpp"
+
+#include "cl_SOL_Dist_Map.hpp"
+
+namespace moris
+{
+    /**
+     * @brief map of the built-in linear algebra backend
+     *
+     * The native backend runs on a single processor. Owned global IDs are numbered consecutively
+     * in the order they are given, this local index is also the point ID used by point-map
+     * matrices and vectors.
+     */
+    class Map_Native : public sol::Dist_Map
+    {
+      private:
+        // owned global IDs, position is the local index
+        Matrix< DDSMat > mMyGlobalIds;
+
+        // local index for each global ID, -1 if the global ID is not in this map
+        Matrix< DDSMat > mGlobalToLocal;
+
+        // free point ID for each global ID of the full overlapping map, -1 if constrained
+        Matrix< DDSMat > mFullToFreePoint;
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        void build_global_to_local_map();
+
+      public:
+        //-------------------------------------------------------------------------------------------------------------
+
+        Map_Native(
+                const Matrix< DDSMat >& aMyGlobalIds,
+                const Matrix< DDUMat >& aMyConstraintDofs );
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        Map_Native( const Matrix< DDSMat >& aMyGlobalIds );
+
+        Map_Native( const Vector< sint >& aMyGlobalIds );
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        ~Map_Native() override = default;
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        moris::sint return_local_ind_of_global_Id( moris::uint aGlobalId ) const override;
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        void build_dof_translator(
+                const Matrix< IdMat >& aFullMap,
+                const bool             aFlag ) override;
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        void translate_ids_to_free_point_ids(
+                const moris::Matrix< IdMat >& aIdsIn,
+                moris::Matrix< IdMat >&       aIdsOut,
+                const bool&                   aIsBuildGraph = true ) override;
+
+        void translate_ids_to_free_point_ids(
+                const Vector< sint >& aIdsIn,
+                Vector< sint >&       aIdsOut,
+                bool                  aIsBuildGraph = true ) override;
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        /**
+         * @brief number of owned entries
+         */
+        uint
+        get_num_my_ids() const
+        {
+            return mMyGlobalIds.numel();
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        /**
+         * @brief global ID of a local index
+         */
+        sint
+        get_global_id( uint aLocalIndex ) const
+        {
+            return mMyGlobalIds( aLocalIndex );
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+
+        void print() override;
+
+      private:
+        //-------------------------------------------------------------------------------------------------------------
+
+        sint translate_id_to_free_point_id(
+                sint aIdIn,
+                bool aIsBuildGraph ) const;
+    };
+}    // namespace moris
@@ -195,6 +195,19 @@ namespace moris::sol
          */
         virtual Vector< moris::real > vec_norm2() = 0;
 
+        /**
+         * Returns the dot product of one vector of this multivector with the same vector of another
+         * multivector built on the same map, summed over all processors.
+         *
+         * @param[in] aVector       Dist_Vector with the same map.
+         * @param[in] aVectorIndex  Index of vector in multivector.
+         *
+         * @return  Dot product.
+         */
+        virtual moris::real dot(
+                Dist_Vector&      aVector,
+                const moris::uint aVectorIndex = 0 ) = 0;
+
         /**
          * Prints this vector.
          */
@@ -14,6 +14,9 @@
 #include "cl_Vector_Epetra.hpp"
 #include "cl_Map_Epetra.hpp"
 #include "cl_SOL_Dist_Map.hpp"
+#include "cl_Sparse_Matrix_Native.hpp"
+#include "cl_Vector_Native.hpp"
+#include "cl_Map_Native.hpp"
 
 #ifdef MORIS_HAVE_PETSC
 #include "cl_MatrixPETSc.hpp"
@@ -49,6 +52,11 @@ namespace moris::sol
                 tSparseMatrix = new Sparse_Matrix_EpetraFECrs( aInput, aMap, aPointMap, aBuildGraph );
                 break;
             }
+            case MapType::Native:
+            {
+                tSparseMatrix = new Sparse_Matrix_Native( aInput, aMap, aPointMap, aBuildGraph );
+                break;
+            }
             case MapType::Petsc:
             {
 #ifdef MORIS_HAVE_PETSC
@@ -83,6 +91,11 @@ namespace moris::sol
                     tSparseMatrix = new Sparse_Matrix_EpetraFECrs( aRowMap, aColMap );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tSparseMatrix = new Sparse_Matrix_Native( aRowMap, aColMap );
+                    break;
+                }
                 // case (MapType::Petsc):
                 //     tSparseMatrix = new Matrix_PETSc( aInput, aMap );
                 //     break;
@@ -111,6 +124,11 @@ namespace moris::sol
                     tSparseMatrix = new Sparse_Matrix_EpetraFECrs( aRows, aCols );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tSparseMatrix = new Sparse_Matrix_Native( aRows, aCols );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -148,6 +166,11 @@ namespace moris::sol
                     tDistVector = new Vector_Epetra( aMap, aNumVectors, aPointMap, aManageMap );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tDistVector = new Vector_Native( aMap, aNumVectors, aPointMap, aManageMap );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -184,6 +207,11 @@ namespace moris::sol
                     tDistVector = new Vector_Epetra( aMap, aNumVectors, aPointMap, aManageMap );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tDistVector = new Vector_Native( aMap, aNumVectors, aPointMap, aManageMap );
+                    break;
+                }
                 //    case (MapType::Petsc):
                 //        MORIS_ERROR( aNumVectors == 1, "Multivector not implemented for petsc");
                 //        tDistVector = new Vector_PETSc( aInput, aMap, aNumVectors );
@@ -212,6 +240,11 @@ namespace moris::sol
                     tMap = new Map_Epetra( aMyGlobalIds, aMyConstraintIds );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tMap = new Map_Native( aMyGlobalIds, aMyConstraintIds );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -245,6 +278,11 @@ namespace moris::sol
                     tMap = new Map_Epetra( aMyGlobalIds );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tMap = new Map_Native( aMyGlobalIds );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -278,6 +316,11 @@ namespace moris::sol
                     tMap = new Map_Epetra( aMyGlobalIds );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tMap = new Map_Native( aMyGlobalIds );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -310,6 +353,11 @@ namespace moris::sol
                     tMap = new Map_Epetra( aMyGlobalIds );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tMap = new Map_Native( aMyGlobalIds );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
@@ -344,6 +392,11 @@ namespace moris::sol
                     tMap = new Map_Epetra( aMyGlobalOwnedAndSharedIds );
                     break;
                 }
+                case MapType::Native:
+                {
+                    tMap = new Map_Native( aMyGlobalOwnedAndSharedIds );
+                    break;
+                }
                 case MapType::Petsc:
                 {
 #ifdef MORIS_HAVE_PETSC
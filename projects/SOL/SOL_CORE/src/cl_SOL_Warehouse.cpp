@@ -96,6 +96,11 @@ void SOL_Warehouse::initialize()
     // Load parameters from parameterlist
     mTPLType = static_cast< moris::sol::MapType >( mParameterlist( 6 )( 0 ).get< moris::uint >( "SOL_TPL_Type" ) );
 
+    MORIS_ERROR( mTPLType != sol::MapType::Native || par_size() == 1,
+            "SOL_Warehouse::initialize - the native linear algebra backend is single-rank; "
+            "use SOL_TPL_Type Epetra or Petsc when running on %d processors.",
+            par_size() );
+
     mOperatorToMatlab      = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_operator_to_matlab" );
     mSaveFinalSolVecToFile = mParameterlist( 6 )( 0 ).get< std::string >( "SOL_save_final_sol_vec_to_file" );
 
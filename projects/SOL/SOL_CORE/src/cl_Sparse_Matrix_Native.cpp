@@ -0,0 +1,752 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Sparse_Matrix_Native.cpp
+ *
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+
+#include "cl_Sparse_Matrix_Native.hpp"
+#include "cl_DLA_Solver_Interface.hpp"
+#include "moris_openmp.hpp"
+
+using namespace moris;
+
+// ----------------------------------------------------------------------------
+
+Sparse_Matrix_Native::Sparse_Matrix_Native(
+        Solver_Interface* aInput,
+        sol::Dist_Map*    aMap,
+        bool              aPointMap,
+        bool              aBuildGraph )
+        : sol::Dist_Matrix( aMap )
+        , mMatBuildWithPointMap( aPointMap )
+        , mBuildGraph( aBuildGraph )
+{
+    mRowMap = dynamic_cast< Map_Native* >( aMap );
+    mColMap = mRowMap;
+
+    MORIS_ERROR( mRowMap != nullptr,
+            "Sparse_Matrix_Native::Sparse_Matrix_Native - native matrices require a native map." );
+
+    mNumRows = mRowMap->get_num_my_ids();
+    mNumCols = mNumRows;
+
+    mStagedEntries.resize( mNumRows );
+}
+
+// ----------------------------------------------------------------------------
+
+Sparse_Matrix_Native::Sparse_Matrix_Native(
+        const sol::Dist_Map* aRowMap,
+        const sol::Dist_Map* aColMap )
+{
+    mRowMap = const_cast< Map_Native* >( dynamic_cast< const Map_Native* >( aRowMap ) );
+    mColMap = const_cast< Map_Native* >( dynamic_cast< const Map_Native* >( aColMap ) );
+
+    MORIS_ERROR( mRowMap != nullptr && mColMap != nullptr,
+            "Sparse_Matrix_Native::Sparse_Matrix_Native - native matrices require native maps." );
+
+    mMap = mRowMap;
+
+    mNumRows = mRowMap->get_num_my_ids();
+    mNumCols = mColMap->get_num_my_ids();
+
+    mStagedEntries.resize( mNumRows );
+}
+
+// ----------------------------------------------------------------------------
+
+Sparse_Matrix_Native::Sparse_Matrix_Native(
+        const moris::uint aRows,
+        const moris::uint aCols )
+        : mNumRows( aRows )
+        , mNumCols( aCols )
+{
+    mStagedEntries.resize( mNumRows );
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::dirichlet_BC_vector(
+        moris::Matrix< DDUMat >&       aDirichletBCVec,
+        const moris::Matrix< DDUMat >& aMyConstraintDofs )
+{
+    // build vector with constraint values. unconstraint=0 constraint =1.
+    for ( moris::uint Ik = 0; Ik < aMyConstraintDofs.n_rows(); Ik++ )
+    {
+        aDirichletBCVec( aMyConstraintDofs( Ik ) ) = 1;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+sint
+Sparse_Matrix_Native::get_row_index( sint aId ) const
+{
+    // point IDs and IDs of matrices without map are local indices
+    if ( mMatBuildWithPointMap || mRowMap == nullptr )
+    {
+        return ( aId >= 0 && aId < (sint)mNumRows ) ? aId : -1;
+    }
+
+    return aId >= 0 ? mRowMap->return_local_ind_of_global_Id( aId ) : -1;
+}
+
+// ----------------------------------------------------------------------------
+
+sint
+Sparse_Matrix_Native::get_col_index( sint aId ) const
+{
+    if ( mMatBuildWithPointMap || mColMap == nullptr )
+    {
+        return ( aId >= 0 && aId < (sint)mNumCols ) ? aId : -1;
+    }
+
+    return aId >= 0 ? mColMap->return_local_ind_of_global_Id( aId ) : -1;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::get_local_indices(
+        const moris::Matrix< DDSMat >& aIds,
+        Vector< sint >&                aIndices,
+        bool                           aIsBuildGraph ) const
+{
+    uint tNumIds = aIds.numel();
+
+    aIndices.resize( tNumIds );
+
+    if ( mMatBuildWithPointMap )
+    {
+        // constrained dofs are translated to -1 or MORIS_ID_MAX
+        Matrix< IdMat > tPointFreeIds;
+        mMap->translate_ids_to_free_point_ids( aIds, tPointFreeIds, aIsBuildGraph );
+
+        for ( uint Ik = 0; Ik < tNumIds; Ik++ )
+        {
+            aIndices( Ik ) = this->get_row_index( tPointFreeIds( Ik ) );
+        }
+    }
+    else
+    {
+        for ( uint Ik = 0; Ik < tNumIds; Ik++ )
+        {
+            aIndices( Ik ) = this->get_row_index( aIds( Ik ) );
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+sint
+Sparse_Matrix_Native::find_entry(
+        sint aRow,
+        sint aCol ) const
+{
+    if ( mRowOffsets.size() == 0 )
+    {
+        return -1;
+    }
+
+    const sint* tBegin = mColumns.memptr() + mRowOffsets( aRow );
+    const sint* tEnd   = mColumns.memptr() + mRowOffsets( aRow + 1 );
+
+    const sint* tPos = std::lower_bound( tBegin, tEnd, aCol );
+
+    if ( tPos != tEnd && *tPos == aCol )
+    {
+        return tPos - mColumns.memptr();
+    }
+
+    return -1;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::add_block(
+        const Vector< sint >&          aRowIndices,
+        const Vector< sint >&          aColIndices,
+        const moris::Matrix< DDRMat >& aValues,
+        bool                           aSumInto )
+{
+    uint tNumRows = aRowIndices.size();
+    uint tNumCols = aColIndices.size();
+
+    // column-major dense block
+    const real* tBlock = aValues.data();
+
+    for ( uint Ii = 0; Ii < tNumRows; Ii++ )
+    {
+        sint tRow = aRowIndices( Ii );
+
+        if ( tRow < 0 )
+        {
+            continue;
+        }
+
+        for ( uint Ij = 0; Ij < tNumCols; Ij++ )
+        {
+            sint tCol = aColIndices( Ij );
+
+            if ( tCol < 0 )
+            {
+                continue;
+            }
+
+            real tValue = tBlock[ Ii + Ij * tNumRows ];
+
+            sint tPos = this->find_entry( tRow, tCol );
+
+            if ( tPos >= 0 )
+            {
+                mValues( tPos ) = aSumInto ? mValues( tPos ) + tValue : tValue;
+            }
+            else
+            {
+                real& tStaged = mStagedEntries( tRow )[ tCol ];
+
+                tStaged = aSumInto ? tStaged + tValue : tValue;
+
+                mHasStagedEntries = true;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::fill_matrix(
+        const moris::uint&             aNumMyDofs,
+        const moris::Matrix< DDRMat >& aA_val,
+        const moris::Matrix< DDSMat >& aEleDofConnectivity )
+{
+    Vector< sint > tIndices;
+    this->get_local_indices( aEleDofConnectivity, tIndices, false );
+
+    // no compressed pattern yet, stage entries
+    if ( mRowOffsets.size() == 0 )
+    {
+        this->add_block( tIndices, tIndices, aA_val, true );
+        return;
+    }
+
+    // order of the element columns by local index, skipping constrained dofs
+    Vector< uint > tOrder;
+    tOrder.reserve( aNumMyDofs );
+
+    for ( uint Ik = 0; Ik < aNumMyDofs; Ik++ )
+    {
+        if ( tIndices( Ik ) >= 0 )
+        {
+            tOrder.push_back( Ik );
+        }
+    }
+
+    std::sort( tOrder.begin(), tOrder.end(),
+            [ &tIndices ]( uint aA, uint aB ) { return tIndices( aA ) < tIndices( aB ); } );
+
+    const real* tBlock   = aA_val.data();
+    const sint* tColumns = mColumns.memptr();
+    real*       tValues  = mValues.memptr();
+
+    // merge the sorted element columns with the sorted columns of each row
+    for ( uint Ii = 0; Ii < aNumMyDofs; Ii++ )
+    {
+        sint tRow = tIndices( Ii );
+
+        if ( tRow < 0 )
+        {
+            continue;
+        }
+
+        uint tPos = mRowOffsets( tRow );
+        uint tEnd = mRowOffsets( tRow + 1 );
+
+        for ( uint Ij = 0; Ij < tOrder.size(); Ij++ )
+        {
+            sint tCol = tIndices( tOrder( Ij ) );
+
+            while ( tPos < tEnd && tColumns[ tPos ] < tCol )
+            {
+                tPos++;
+            }
+
+            real tValue = tBlock[ Ii + tOrder( Ij ) * aNumMyDofs ];
+
+            if ( tPos < tEnd && tColumns[ tPos ] == tCol )
+            {
+                tValues[ tPos ] += tValue;
+            }
+            else
+            {
+                // entry outside the element graph
+                mStagedEntries( tRow )[ tCol ] += tValue;
+                mHasStagedEntries = true;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::insert_values(
+        const Matrix< DDSMat >& aRowIDs,
+        const Matrix< DDSMat >& aColumnIDs,
+        const Matrix< DDRMat >& aMatrixValues )
+{
+    Vector< sint > tRows( aRowIDs.numel() );
+    Vector< sint > tCols( aColumnIDs.numel() );
+
+    for ( uint Ik = 0; Ik < aRowIDs.numel(); Ik++ )
+    {
+        tRows( Ik ) = this->get_row_index( aRowIDs( Ik ) );
+    }
+
+    for ( uint Ik = 0; Ik < aColumnIDs.numel(); Ik++ )
+    {
+        tCols( Ik ) = this->get_col_index( aColumnIDs( Ik ) );
+    }
+
+    this->add_block( tRows, tCols, aMatrixValues, false );
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::sum_into_values(
+        const Matrix< DDSMat >& aRowIDs,
+        const Matrix< DDSMat >& aColumnIDs,
+        const Matrix< DDRMat >& aMatrixValues )
+{
+    Vector< sint > tRows( aRowIDs.numel() );
+    Vector< sint > tCols( aColumnIDs.numel() );
+
+    for ( uint Ik = 0; Ik < aRowIDs.numel(); Ik++ )
+    {
+        tRows( Ik ) = this->get_row_index( aRowIDs( Ik ) );
+    }
+
+    for ( uint Ik = 0; Ik < aColumnIDs.numel(); Ik++ )
+    {
+        tCols( Ik ) = this->get_col_index( aColumnIDs( Ik ) );
+    }
+
+    this->add_block( tRows, tCols, aMatrixValues, true );
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::get_matrix_values(
+        const moris::Matrix< DDSMat >& aRequestedIds,
+        moris::Matrix< DDRMat >&       aValues )
+{
+    // requested IDs are used as both row and column IDs
+    Vector< sint > tIndices;
+    this->get_local_indices( aRequestedIds, tIndices, false );
+
+    uint tNumIds = tIndices.size();
+
+    aValues.set_size( tNumIds, tNumIds, 0.0 );
+
+    for ( uint Ii = 0; Ii < tNumIds; Ii++ )
+    {
+        sint tRow = tIndices( Ii );
+
+        // skip constrained and non-local rows
+        if ( tRow < 0 )
+        {
+            continue;
+        }
+
+        for ( uint Ij = 0; Ij < tNumIds; Ij++ )
+        {
+            sint tCol = tIndices( Ij );
+
+            if ( tCol < 0 )
+            {
+                continue;
+            }
+
+            // value is the sum of the compressed and the not yet compressed entry
+            sint tPos = this->find_entry( tRow, tCol );
+
+            if ( tPos >= 0 )
+            {
+                aValues( Ii, Ij ) = mValues( tPos );
+            }
+
+            if ( mHasStagedEntries )
+            {
+                auto tStaged = mStagedEntries( tRow ).find( tCol );
+
+                if ( tStaged != mStagedEntries( tRow ).end() )
+                {
+                    aValues( Ii, Ij ) += tStaged->second;
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::compress()
+{
+    bool tIsCompressed = mRowOffsets.size() > 0;
+
+    if ( tIsCompressed && !mHasStagedEntries )
+    {
+        return;
+    }
+
+    // move existing entries into the staged rows
+    if ( tIsCompressed )
+    {
+        for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+        {
+            for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+            {
+                mStagedEntries( iRow )[ mColumns( tPos ) ] += mValues( tPos );
+            }
+        }
+    }
+
+    // count entries per row, std::map keeps the columns sorted
+    mRowOffsets.resize( mNumRows + 1, 0 );
+    mRowOffsets( 0 ) = 0;
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        mRowOffsets( iRow + 1 ) = mRowOffsets( iRow ) + mStagedEntries( iRow ).size();
+    }
+
+    uint tNumNonZeros = mRowOffsets( mNumRows );
+
+    mColumns.resize( tNumNonZeros );
+    mValues.resize( tNumNonZeros );
+    mDiagonal.resize( mNumRows, -1 );
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        uint tPos = mRowOffsets( iRow );
+
+        mDiagonal( iRow ) = -1;
+
+        for ( const auto& [ tCol, tValue ] : mStagedEntries( iRow ) )
+        {
+            if ( tCol == (sint)iRow )
+            {
+                mDiagonal( iRow ) = tPos;
+            }
+
+            mColumns( tPos ) = tCol;
+            mValues( tPos )  = tValue;
+            tPos++;
+        }
+
+        mStagedEntries( iRow ).clear();
+    }
+
+    mHasStagedEntries = false;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::matrix_global_assembly()
+{
+    // single processor, only staged entries need to be merged
+    this->compress();
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::initial_matrix_global_assembly()
+{
+    // fixes the sparsity pattern built from the element graph
+    this->compress();
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::build_graph(
+        const moris::uint&             aNumMyDof,
+        const moris::Matrix< DDSMat >& aElementTopology )
+{
+    Vector< sint > tIndices;
+    this->get_local_indices( aElementTopology, tIndices, true );
+
+    // insert zeros for all couplings of free element dofs
+    for ( uint Ii = 0; Ii < tIndices.size(); Ii++ )
+    {
+        if ( tIndices( Ii ) < 0 )
+        {
+            continue;
+        }
+
+        std::map< sint, real >& tRow = mStagedEntries( tIndices( Ii ) );
+
+        for ( uint Ij = 0; Ij < tIndices.size(); Ij++ )
+        {
+            if ( tIndices( Ij ) >= 0 )
+            {
+                tRow.emplace( tIndices( Ij ), 0.0 );
+            }
+        }
+    }
+
+    mHasStagedEntries = true;
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::mat_put_scalar( const moris::real& aValue )
+{
+    std::fill( mValues.begin(), mValues.end(), aValue );
+
+    for ( uint iRow = 0; iRow < mStagedEntries.size(); iRow++ )
+    {
+        for ( auto& tEntry : mStagedEntries( iRow ) )
+        {
+            tEntry.second = aValue;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::get_diagonal( sol::Dist_Vector& aDiagVec ) const
+{
+    MORIS_ASSERT( mRowOffsets.size() > 0, "Matrix not filled, cannot extract diagonal \n" );
+
+    real* tDiagonal = aDiagVec.get_values_pointer();
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        tDiagonal[ iRow ] = mDiagonal( iRow ) >= 0 ? mValues( mDiagonal( iRow ) ) : 0.0;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::sparse_mat_left_scale( const sol::Dist_Vector& aScaleVector )
+{
+    const real* tScale = dynamic_cast< const Vector_Native& >( aScaleVector ).get_values_pointer();
+
+    // scale matrix with vector from the left
+    MORIS_OMP_PRAGMA( omp parallel for )
+    for ( sint iRow = 0; iRow < (sint)mNumRows; iRow++ )
+    {
+        for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+        {
+            mValues( tPos ) *= tScale[ iRow ];
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::sparse_mat_right_scale( const sol::Dist_Vector& aScaleVector )
+{
+    const real* tScale = dynamic_cast< const Vector_Native& >( aScaleVector ).get_values_pointer();
+
+    // scale matrix with vector from the right
+    MORIS_OMP_PRAGMA( omp parallel for )
+    for ( sint iRow = 0; iRow < (sint)mNumRows; iRow++ )
+    {
+        for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+        {
+            mValues( tPos ) *= tScale[ mColumns( tPos ) ];
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::replace_diagonal_values( const sol::Dist_Vector& aDiagVec )
+{
+    MORIS_ASSERT( mRowOffsets.size() > 0, "Matrix not filled, cannot replace diagonal values \n" );
+
+    const real* tDiagonal = dynamic_cast< const Vector_Native& >( aDiagVec ).get_values_pointer();
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        MORIS_ERROR( mDiagonal( iRow ) >= 0,
+                "Sparse_Matrix_Native::replace_diagonal_values - row %u has no diagonal entry.", iRow );
+
+        mValues( mDiagonal( iRow ) ) = tDiagonal[ iRow ];
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::multiply(
+        const real* aX,
+        real*       aY ) const
+{
+    const uint* tOffsets = mRowOffsets.memptr();
+    const sint* tColumns = mColumns.memptr();
+    const real* tValues  = mValues.memptr();
+
+    MORIS_OMP_PRAGMA( omp parallel for schedule( static ) )
+    for ( sint iRow = 0; iRow < (sint)mNumRows; iRow++ )
+    {
+        real tSum = 0.0;
+
+        MORIS_OMP_PRAGMA( omp simd reduction( + : tSum ) )
+        for ( uint tPos = tOffsets[ iRow ]; tPos < tOffsets[ iRow + 1 ]; tPos++ )
+        {
+            tSum += tValues[ tPos ] * aX[ tColumns[ tPos ] ];
+        }
+
+        aY[ iRow ] = tSum;
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::mat_vec_product(
+        const moris::sol::Dist_Vector& aInputVec,
+        moris::sol::Dist_Vector&       aResult,
+        const bool                     aUseTranspose )
+{
+    MORIS_ASSERT( mRowOffsets.size() > 0, "Sparse_Matrix_Native::mat_vec_product - matrix not filled." );
+
+    const Vector_Native& tInput  = dynamic_cast< const Vector_Native& >( aInputVec );
+    Vector_Native&       tResult = dynamic_cast< Vector_Native& >( aResult );
+
+    sint tNumVectors = tResult.get_num_vectors();
+    sint tInLength   = tInput.vec_local_length();
+    sint tOutLength  = tResult.vec_local_length();
+
+    for ( sint iVec = 0; iVec < tNumVectors; iVec++ )
+    {
+        const real* tX = tInput.get_values_pointer() + iVec * tInLength;
+        real*       tY = tResult.get_values_pointer() + iVec * tOutLength;
+
+        if ( !aUseTranspose )
+        {
+            this->multiply( tX, tY );
+        }
+        else
+        {
+            std::fill( tY, tY + tOutLength, 0.0 );
+
+            for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+            {
+                for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+                {
+                    tY[ mColumns( tPos ) ] += mValues( tPos ) * tX[ iRow ];
+                }
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::print() const
+{
+    std::cout << "Sparse_Matrix_Native: " << mNumRows << " x " << mNumCols
+              << ", " << mValues.size() << " nonzeros\n";
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+        {
+            std::cout << "  ( " << iRow << ", " << mColumns( tPos ) << " ) " << mValues( tPos ) << '\n';
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::save_matrix_to_matlab_file( const char* aFilename )
+{
+    std::ofstream tFile( aFilename );
+
+    MORIS_ERROR( tFile.good(),
+            "Sparse_Matrix_Native::save_matrix_to_matlab_file - cannot open file %s.", aFilename );
+
+    tFile << std::scientific << std::setprecision( 16 );
+
+    // one-based triplets, load with spconvert
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+        {
+            tFile << iRow + 1 << " " << mColumns( tPos ) + 1 << " " << mValues( tPos ) << "\n";
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::save_matrix_to_matrix_market_file( const char* aFilename )
+{
+    std::ofstream tFile( aFilename );
+
+    MORIS_ERROR( tFile.good(),
+            "Sparse_Matrix_Native::save_matrix_to_matrix_market_file - cannot open file %s.", aFilename );
+
+    tFile << "%%MatrixMarket matrix coordinate real general\n";
+    tFile << mNumRows << " " << mNumCols << " " << mValues.size() << "\n";
+    tFile << std::scientific << std::setprecision( 16 );
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        for ( uint tPos = mRowOffsets( iRow ); tPos < mRowOffsets( iRow + 1 ); tPos++ )
+        {
+            tFile << iRow + 1 << " " << mColumns( tPos ) + 1 << " " << mValues( tPos ) << "\n";
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void
+Sparse_Matrix_Native::save_matrix_map_to_matrix_market_file( const char* aFilename )
+{
+    MORIS_ERROR( mRowMap != nullptr,
+            "Sparse_Matrix_Native::save_matrix_map_to_matrix_market_file - matrix has no map." );
+
+    std::ofstream tFile( aFilename );
+
+    MORIS_ERROR( tFile.good(),
+            "Sparse_Matrix_Native::save_matrix_map_to_matrix_market_file - cannot open file %s.", aFilename );
+
+    tFile << "%%MatrixMarket matrix array integer general\n";
+    tFile << mNumRows << " 1\n";
+
+    for ( uint iRow = 0; iRow < mNumRows; iRow++ )
+    {
+        tFile << mRowMap->get_global_id( iRow ) << "\n";
+    }
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Sparse_Matrix_Native.hpp
+ *
+ */
+
+#pragma once
+
+#include <map>
+
+// MORIS header files.
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+#include "cl_Vector.hpp"
+
+#include "cl_Map_Native.hpp"
+#include "cl_SOL_Dist_Matrix.hpp"
+#include "cl_Vector_Native.hpp"
+
+namespace moris
+{
+    /**
+     * @brief compressed sparse row matrix of the built-in linear algebra backend
+     *
+     * Entries are staged row by row until the first global assembly, which compresses them into
+     * CSR arrays with sorted column indices. Afterwards the sparsity pattern is fixed: element
+     * contributions are scattered by merging the sorted element columns with the sorted row,
+     * and matrix-vector products run threaded over rows. All rows are owned by a single processor.
+     */
+    class Sparse_Matrix_Native : public sol::Dist_Matrix
+    {
+      private:
+        // maps used to translate row and column IDs into local indices, nullptr if IDs are indices
+        Map_Native* mRowMap = nullptr;
+        Map_Native* mColMap = nullptr;
+
+        uint mNumRows = 0;
+        uint mNumCols = 0;
+
+        // CSR arrays
+        Vector< uint > mRowOffsets;
+        Vector< sint > mColumns;
+        Vector< real > mValues;
+
+        // position of diagonal entry in mValues per row, -1 if not in sparsity pattern
+        Vector< sint > mDiagonal;
+
+        // entries inserted before the sparsity pattern was compressed
+        Vector< std::map< sint, real > > mStagedEntries;
+        bool                             mHasStagedEntries = false;
+
+        const bool mMatBuildWithPointMap = false;
+        const bool mBuildGraph           = false;
+
+        //----------------------------------------------------------------------------------------------
+
+        void dirichlet_BC_vector(
+                moris::Matrix< DDUMat >&       aDirichletBCVec,
+                const moris::Matrix< DDUMat >& aMyConstraintDofs ) override;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief local row and column indices of IDs, -1 for IDs not in the matrix
+         */
+        sint get_row_index( sint aId ) const;
+        sint get_col_index( sint aId ) const;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief translates element dof IDs into local indices
+         */
+        void get_local_indices(
+                const moris::Matrix< DDSMat >& aIds,
+                Vector< sint >&                aIndices,
+                bool                           aIsBuildGraph ) const;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief adds or inserts a dense block given by local indices
+         *
+         * Entries outside the current sparsity pattern are staged and merged into the pattern
+         * at the next global assembly.
+         */
+        void add_block(
+                const Vector< sint >&          aRowIndices,
+                const Vector< sint >&          aColIndices,
+                const moris::Matrix< DDRMat >& aValues,
+                bool                           aSumInto );
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief position of an entry in the CSR arrays, -1 if not in sparsity pattern
+         */
+        sint find_entry(
+                sint aRow,
+                sint aCol ) const;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief merges staged entries into the CSR arrays
+         */
+        void compress();
+
+      public:
+        //----------------------------------------------------------------------------------------------
+
+        Sparse_Matrix_Native(
+                moris::Solver_Interface* aInput,
+                sol::Dist_Map*           aMap,
+                bool                     aPointMap   = false,
+                bool                     aBuildGraph = false );
+
+        Sparse_Matrix_Native(
+                const sol::Dist_Map* aRowMap,
+                const sol::Dist_Map* aColMap );
+
+        Sparse_Matrix_Native(
+                const moris::uint aRows,
+                const moris::uint aCols );
+
+        /** Destructor */
+        ~Sparse_Matrix_Native() override = default;
+
+        //----------------------------------------------------------------------------------------------
+
+        void fill_matrix(
+                const moris::uint&             aNumMyDofs,
+                const moris::Matrix< DDRMat >& aA_val,
+                const moris::Matrix< DDSMat >& aEleDofConnectivity ) override;
+
+        void insert_values(
+                const Matrix< DDSMat >& aRowIDs,
+                const Matrix< DDSMat >& aColumnIDs,
+                const Matrix< DDRMat >& aMatrixValues ) override;
+
+        void sum_into_values(
+                const Matrix< DDSMat >& aRowIDs,
+                const Matrix< DDSMat >& aColumnIDs,
+                const Matrix< DDRMat >& aMatrixValues ) override;
+
+        void get_matrix_values(
+                const moris::Matrix< DDSMat >& aRequestedIds,
+                moris::Matrix< DDRMat >&       aValues ) override;
+
+        void matrix_global_assembly() override;
+
+        void initial_matrix_global_assembly() override;
+
+        void build_graph(
+                const moris::uint&             aNumMyDof,
+                const moris::Matrix< DDSMat >& aElementTopology ) override;
+
+        void get_diagonal( moris::sol::Dist_Vector& aDiagVec ) const override;
+
+        void mat_put_scalar( const moris::real& aValue ) override;
+
+        void sparse_mat_left_scale( const moris::sol::Dist_Vector& aScaleVector ) override;
+
+        void sparse_mat_right_scale( const moris::sol::Dist_Vector& aScaleVector ) override;
+
+        void replace_diagonal_values( const moris::sol::Dist_Vector& aDiagVec ) override;
+
+        void mat_vec_product(
+                const moris::sol::Dist_Vector& aInputVec,
+                moris::sol::Dist_Vector&       aResult,
+                const bool                     aUseTranspose ) override;
+
+        void print() const override;
+
+        void save_matrix_to_matlab_file( const char* aFilename ) override;
+
+        void save_matrix_to_matrix_market_file( const char* aFilename ) override;
+
+        void save_matrix_map_to_matrix_market_file( const char* aFilename ) override;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief computes aY = A * aX on raw arrays of local length
+         *
+         * @param[ in ]  aX input values ( <number of columns> )
+         * @param[ out ] aY result values ( <number of rows> )
+         */
+        void multiply(
+                const real* aX,
+                real*       aY ) const;
+
+        //----------------------------------------------------------------------------------------------
+
+        uint
+        get_num_rows() const
+        {
+            return mNumRows;
+        }
+
+        const Vector< uint >&
+        get_row_offsets() const
+        {
+            return mRowOffsets;
+        }
+
+        const Vector< sint >&
+        get_columns() const
+        {
+            return mColumns;
+        }
+
+        const Vector< real >&
+        get_values() const
+        {
+            return mValues;
+        }
+
+        const Vector< sint >&
+        get_diagonal_positions() const
+        {
+            return mDiagonal;
+        }
+    };
+}    // namespace moris
@@ -422,6 +422,24 @@ Vector_Epetra::vec_norm2()
 
 //----------------------------------------------------------------------------------------------
 
+moris::real
+Vector_Epetra::dot(
+        sol::Dist_Vector& aVector,
+        const moris::uint aVectorIndex )
+{
+    Vector< moris::real > tDot( mNumVectors, 0.0 );
+
+    // get the dot products of all vectors, reduced over all processors
+    int tError = mEpetraVector->Dot( *dynamic_cast< Vector_Epetra& >( aVector ).get_epetra_vector(), tDot.data().data() );
+
+    MORIS_ERROR( tError == 0,
+            "Vector_Epetra::dot - dot product of vectors failed" );
+
+    return tDot( aVectorIndex );
+}
+
+//----------------------------------------------------------------------------------------------
+
 void
 Vector_Epetra::extract_copy( moris::Matrix< DDRMat >& LHSValues )
 {
@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Vector_Native.cpp
+ *
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <random>
+
+#include "cl_Vector_Native.hpp"
+#include "moris_openmp.hpp"
+#include "fn_print.hpp"
+#include "HDF5_Tools.hpp"
+
+using namespace moris;
+
+//----------------------------------------------------------------------------------------------
+
+Vector_Native::Vector_Native(
+        sol::Dist_Map* aMapClass,
+        const sint     aNumVectors,
+        bool           aPointMap,
+        bool           aManageMap )
+        : sol::Dist_Vector( aManageMap )
+        , mVecBuildWithPointMap( aPointMap )
+{
+    mMap = dynamic_cast< Map_Native* >( aMapClass );
+
+    MORIS_ERROR( mMap != nullptr,
+            "Vector_Native::Vector_Native - native vectors require a native map." );
+
+    // store number of columns for multi-column vectors
+    mNumVectors = aNumVectors;
+
+    mValues.set_size( mMap->get_num_my_ids(), aNumVectors, 0.0 );
+}
+
+//----------------------------------------------------------------------------------------------
+
+Vector_Native::~Vector_Native()
+{
+    if ( mManageMap )
+    {
+        delete mMap;
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+sint
+Vector_Native::get_local_index( sint aId ) const
+{
+    // point IDs are local indices
+    if ( mVecBuildWithPointMap )
+    {
+        return aId < (sint)mValues.n_rows() ? aId : -1;
+    }
+
+    return mMap->return_local_ind_of_global_Id( aId );
+}
+
+//-----------------------------------------------------------------------------
+
+real&
+Vector_Native::operator()( sint aGlobalId, uint aVectorIndex )
+{
+    sint tLocIndex = mMap->return_local_ind_of_global_Id( aGlobalId );
+
+    MORIS_ASSERT( tLocIndex >= 0,
+            "Vector_Native::operator() - global ID %d is not in map.", aGlobalId );
+
+    return mValues( tLocIndex, aVectorIndex );
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::replace_global_values(
+        const moris::Matrix< DDSMat >& aGlobalIds,
+        const moris::Matrix< DDRMat >& aValues,
+        const uint&                    aVectorIndex )
+{
+    // check for empty vector
+    if ( aGlobalIds.numel() == 0 )
+    {
+        return;
+    }
+
+    // check for valid IDs
+    MORIS_ASSERT( aGlobalIds.min() >= 0 and aGlobalIds.max() < MORIS_SINT_MAX,
+            "Vector_Native::replace_global_values - invalid ID range (%d, %d) provided", aGlobalIds.min(), aGlobalIds.max() );
+
+    for ( uint Ik = 0; Ik < aGlobalIds.numel(); Ik++ )
+    {
+        sint tLocIndex = this->get_local_index( aGlobalIds( Ik ) );
+
+        MORIS_ERROR( tLocIndex >= 0,
+                "Vector_Native::replace_global_values - ID %d is not in map.", aGlobalIds( Ik ) );
+
+        mValues( tLocIndex, aVectorIndex ) = aValues( Ik );
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::replace_global_values(
+        const Vector< sint >& aGlobalIds,
+        const Vector< real >& aValues )
+{
+    for ( uint Ik = 0; Ik < aGlobalIds.size(); Ik++ )
+    {
+        sint tLocIndex = this->get_local_index( aGlobalIds( Ik ) );
+
+        MORIS_ERROR( tLocIndex >= 0,
+                "Vector_Native::replace_global_values - ID %d is not in map.", aGlobalIds( Ik ) );
+
+        mValues( tLocIndex, 0 ) = aValues( Ik );
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::sum_into_global_values(
+        const moris::Matrix< DDSMat >& aGlobalIds,
+        const moris::Matrix< DDRMat >& aValues,
+        const uint&                    aVectorIndex )
+{
+    // check for empty vector
+    if ( aGlobalIds.numel() == 0 )
+    {
+        return;
+    }
+
+    // check for valid IDs
+    MORIS_ASSERT( aGlobalIds.min() >= 0 and aGlobalIds.max() < MORIS_SINT_MAX,
+            "Vector_Native::sum_into_global_values - invalid ID range (%d, %d) provided", aGlobalIds.min(), aGlobalIds.max() );
+
+    if ( mVecBuildWithPointMap )
+    {
+        Matrix< IdMat > tPointFreeIds;
+        mMap->translate_ids_to_free_point_ids( aGlobalIds, tPointFreeIds, false );
+
+        // constrained dofs are translated to MORIS_ID_MAX and skipped
+        for ( uint Ik = 0; Ik < tPointFreeIds.numel(); Ik++ )
+        {
+            if ( tPointFreeIds( Ik ) >= 0 && tPointFreeIds( Ik ) < (sint)mValues.n_rows() )
+            {
+                mValues( tPointFreeIds( Ik ), aVectorIndex ) += aValues( Ik );
+            }
+        }
+    }
+    else
+    {
+        for ( uint Ik = 0; Ik < aGlobalIds.numel(); Ik++ )
+        {
+            sint tLocIndex = mMap->return_local_ind_of_global_Id( aGlobalIds( Ik ) );
+
+            MORIS_ERROR( tLocIndex >= 0,
+                    "Vector_Native::sum_into_global_values - global ID %d is not in map.", aGlobalIds( Ik ) );
+
+            mValues( tLocIndex, aVectorIndex ) += aValues( Ik );
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::sum_into_global_values(
+        const Vector< sint >&   aGlobalIds,
+        const Matrix< DDRMat >& aValues,
+        const uint&             aVectorIndex )
+{
+    // check for empty vector
+    if ( aGlobalIds.size() == 0 )
+    {
+        return;
+    }
+
+    if ( mVecBuildWithPointMap )
+    {
+        Vector< sint > tPointFreeIds;
+        mMap->translate_ids_to_free_point_ids( aGlobalIds, tPointFreeIds, false );
+
+        // constrained dofs are translated to MORIS_ID_MAX and skipped
+        for ( uint Ik = 0; Ik < tPointFreeIds.size(); Ik++ )
+        {
+            if ( tPointFreeIds( Ik ) >= 0 && tPointFreeIds( Ik ) < (sint)mValues.n_rows() )
+            {
+                mValues( tPointFreeIds( Ik ), aVectorIndex ) += aValues( Ik );
+            }
+        }
+    }
+    else
+    {
+        for ( uint Ik = 0; Ik < aGlobalIds.size(); Ik++ )
+        {
+            sint tLocIndex = mMap->return_local_ind_of_global_Id( aGlobalIds( Ik ) );
+
+            MORIS_ERROR( tLocIndex >= 0,
+                    "Vector_Native::sum_into_global_values - global ID %d is not in map.", aGlobalIds( Ik ) );
+
+            mValues( tLocIndex, aVectorIndex ) += aValues( Ik );
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::vector_global_assembly()
+{
+    // single processor, all entries are owned
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::vec_plus_vec(
+        const moris::real& aScaleA,
+        sol::Dist_Vector&  aVecA,
+        const moris::real& aScaleThis )
+{
+    Vector_Native& tVecA = dynamic_cast< Vector_Native& >( aVecA );
+
+    // free and point maps of the native backend share the local ordering
+    MORIS_ERROR( tVecA.mValues.n_rows() == mValues.n_rows(),
+            "Vector_Native::vec_plus_vec - vectors have different lengths (%zu, %zu).",
+            tVecA.mValues.n_rows(),
+            mValues.n_rows() );
+
+    // FIXME adjust for multivector with different number of vectors
+    sint tNumVectors = std::min( mNumVectors, tVecA.mNumVectors );
+    sint tLength     = mValues.n_rows();
+
+    real*       tThis  = mValues.data();
+    const real* tOther = tVecA.mValues.data();
+
+    MORIS_OMP_PRAGMA( omp parallel for simd )
+    for ( sint Ik = 0; Ik < tLength * tNumVectors; Ik++ )
+    {
+        tThis[ Ik ] = aScaleThis * tThis[ Ik ] + aScaleA * tOther[ Ik ];
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::scale_vector(
+        const moris::real& aValue,
+        const moris::uint& aVecIndex )
+{
+    // check if index of vector is 0. might not be zero for a multivector
+    if ( aVecIndex == 0 )
+    {
+        // scale this vector with the aValue
+        mValues = aValue * mValues;
+        return;
+    }
+
+    // get local length of these vectors
+    moris::uint tLength = this->vec_local_length();
+
+    // scale all values of vector number aVecIndex
+    for ( moris::uint Ik = 0; Ik < tLength; ++Ik )
+    {
+        mValues( Ik, aVecIndex ) *= aValue;
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::import_local_to_global( sol::Dist_Vector& aSourceVec )
+{
+    Vector_Native& tSource = dynamic_cast< Vector_Native& >( aSourceVec );
+
+    // same map, copy values
+    if ( tSource.mMap == mMap )
+    {
+        mValues = tSource.mValues;
+        return;
+    }
+
+    // insert source values at matching global IDs, all other entries remain unchanged
+    sint tLength = mValues.n_rows();
+
+    for ( sint iVec = 0; iVec < std::min( mNumVectors, tSource.mNumVectors ); iVec++ )
+    {
+        MORIS_OMP_PRAGMA( omp parallel for )
+        for ( sint Ik = 0; Ik < tLength; Ik++ )
+        {
+            sint tSourceIndex = tSource.mMap->return_local_ind_of_global_Id( mMap->get_global_id( Ik ) );
+
+            if ( tSourceIndex >= 0 )
+            {
+                mValues( Ik, iVec ) = tSource.mValues( tSourceIndex, iVec );
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::vec_put_scalar( const moris::real& aValue )
+{
+    // set all entries of this vector to aValue
+    mValues.fill( aValue );
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::random()
+{
+    // uniform values in [-1,1], same range as Epetra
+    std::mt19937                             tGenerator( 5489u );
+    std::uniform_real_distribution< real > tDistribution( -1.0, 1.0 );
+
+    for ( uint Ik = 0; Ik < mValues.numel(); Ik++ )
+    {
+        mValues( Ik ) = tDistribution( tGenerator );
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+moris::sint
+Vector_Native::vec_local_length() const
+{
+    return (moris::sint)mValues.n_rows();
+}
+
+//----------------------------------------------------------------------------------------------
+
+moris::sint
+Vector_Native::vec_global_length() const
+{
+    // single processor, local and global length coincide
+    return (moris::sint)mValues.n_rows();
+}
+
+//----------------------------------------------------------------------------------------------
+
+Vector< moris::real >
+Vector_Native::vec_norm2()
+{
+    Vector< moris::real > tNorm( mNumVectors, 0.0 );
+
+    sint tLength = mValues.n_rows();
+
+    for ( sint iVec = 0; iVec < mNumVectors; iVec++ )
+    {
+        const real* tValues = mValues.data() + tLength * iVec;
+
+        tNorm( iVec ) = std::sqrt( local_dot( tLength, tValues, tValues ) );
+    }
+
+    return tNorm;
+}
+
+//----------------------------------------------------------------------------------------------
+
+moris::real
+Vector_Native::dot(
+        sol::Dist_Vector& aVector,
+        const moris::uint aVectorIndex )
+{
+    sint tLength = mValues.n_rows();
+
+    MORIS_ASSERT( aVector.vec_local_length() == tLength,
+            "Vector_Native::dot - vectors differ in length" );
+
+    return local_dot(
+            tLength,
+            mValues.data() + tLength * aVectorIndex,
+            aVector.get_values_pointer() + tLength * aVectorIndex );
+}
+
+//----------------------------------------------------------------------------------------------
+
+moris::real
+Vector_Native::local_dot(
+        moris::sint        aLength,
+        const moris::real* aX,
+        const moris::real* aY )
+{
+    real tSum = 0.0;
+
+    MORIS_OMP_PRAGMA( omp parallel for simd reduction( + : tSum ) )
+    for ( sint Ik = 0; Ik < aLength; Ik++ )
+    {
+        tSum += aX[ Ik ] * aY[ Ik ];
+    }
+
+    return tSum;
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::extract_copy( moris::Matrix< DDRMat >& LHSValues )
+{
+    LHSValues = mValues;
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::extract_copy( Vector< real >& aVector )
+{
+    aVector.resize( mValues.n_rows() );
+
+    std::copy( mValues.data(), mValues.data() + mValues.n_rows(), aVector.memptr() );
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::extract_my_values(
+        const moris::uint&                 aNumIndices,
+        const moris::Matrix< DDSMat >&     aGlobalRows,
+        const moris::uint&                 aRowOffsets,
+        Vector< moris::Matrix< DDRMat > >& ExtractedValues )
+{
+    ExtractedValues.resize( mNumVectors );
+
+    for ( moris::sint Ik = 0; Ik < mNumVectors; ++Ik )
+    {
+        ExtractedValues( Ik ).set_size( aNumIndices, 1 );
+
+        for ( moris::uint Ii = 0; Ii < aNumIndices; ++Ii )
+        {
+            const sint tLocIndex = mMap->return_local_ind_of_global_Id( aGlobalRows( Ii ) );
+
+            MORIS_ASSERT( !( tLocIndex < 0 ), "Vector_Native::extract_my_values: local index < 0. this is not allowed" );
+
+            ExtractedValues( Ik )( Ii ) = mValues( tLocIndex, Ik );
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::print() const
+{
+    moris::print( mValues, "Vector_Native" );
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::save_vector_to_matrix_market_file( const char* aFilename )
+{
+    std::ofstream tFile( aFilename );
+
+    MORIS_ERROR( tFile.good(),
+            "Vector_Native::save_vector_to_matrix_market_file - cannot open file %s.", aFilename );
+
+    tFile << "%%MatrixMarket matrix array real general\n";
+    tFile << mValues.n_rows() << " " << mValues.n_cols() << "\n";
+    tFile << std::scientific << std::setprecision( 16 );
+
+    // column-major, as required by the array format
+    for ( uint Ik = 0; Ik < mValues.numel(); Ik++ )
+    {
+        tFile << mValues( Ik ) << "\n";
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::save_vector_to_matlab_file( const char* aFilename )
+{
+    std::ofstream tFile( aFilename );
+
+    MORIS_ERROR( tFile.good(),
+            "Vector_Native::save_vector_to_matlab_file - cannot open file %s.", aFilename );
+
+    tFile << std::scientific << std::setprecision( 16 );
+
+    // one row per entry, one column per vector
+    for ( uint Ik = 0; Ik < mValues.n_rows(); Ik++ )
+    {
+        for ( uint Ij = 0; Ij < mValues.n_cols(); Ij++ )
+        {
+            tFile << mValues( Ik, Ij ) << " ";
+        }
+        tFile << "\n";
+    }
+}
+
+//----------------------------------------------------------------------------------------------
+
+void
+Vector_Native::save_vector_to_HDF5( const char* aFilename )
+{
+    // native vectors are single-rank, the file name is used as given
+    hid_t  tFileID = create_hdf5_file( aFilename, false );
+    herr_t tStatus = 0;
+
+    // one column per vector, stored under the same label as the Trilinos vectors
+    save_matrix_to_hdf5_file( tFileID, "LHS", mValues, tStatus );
+
+    close_hdf5_file( tFileID );
+}
+
+//-----------------------------------------------------------------------------
+
+void
+Vector_Native::read_vector_from_HDF5(
+        const char* aFilename,
+        std::string aGroupName,
+        sint        aVectorindex )
+{
+    // Note: the values read from file are assigned to the existing map of the vector;
+    //       thus the vector stored in the hdf5 file needs to be consistent with this map
+
+    hid_t  tFileID = open_hdf5_file( aFilename, false, true );
+    herr_t tStatus = 0;
+
+    Matrix< DDRMat > tValues;
+    load_matrix_from_hdf5_file( tFileID, aGroupName, tValues, tStatus );
+
+    close_hdf5_file( tFileID );
+
+    MORIS_ERROR( tValues.n_rows() == mMap->get_num_my_ids(),
+            "Vector_Native::read_vector_from_HDF5 - vector length in file does not match map of vector." );
+
+    // extract single vector from multi-vector
+    if ( aVectorindex > 0 )
+    {
+        MORIS_ERROR( aVectorindex < (sint)tValues.n_cols(),
+                "Vector_Native::read_vector_from_HDF5 - requested vector does not exist" );
+
+        mValues = tValues.get_column( aVectorindex );
+    }
+    else
+    {
+        mValues = tValues;
+    }
+
+    mNumVectors = mValues.n_cols();
+}
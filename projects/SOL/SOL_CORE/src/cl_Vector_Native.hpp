@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022 University of Colorado
+ * Licensed under the MIT license. See LICENSE.txt file in the MORIS root for details.
+ *
+ *------------------------------------------------------------------------------------
+ *
+ * cl_Vector_Native.hpp
+ *
+ */
+
+#pragma once
+
+// MORIS header files.
+#include "cl_Matrix.hpp"
+#include "linalg_typedefs.hpp"
+
+// Project header files
+#include "cl_Map_Native.hpp"
+#include "cl_SOL_Dist_Vector.hpp"
+
+namespace moris
+{
+    /**
+     * @brief vector of the built-in linear algebra backend
+     *
+     * Values are stored column-wise, one column per vector, in the order of the local indices of
+     * the map. Point-map vectors are addressed by point IDs, which are the local indices.
+     */
+    class Vector_Native : public sol::Dist_Vector
+    {
+      private:
+        Map_Native* mMap = nullptr;
+
+        // vector values ( <local length> x <number of vectors> )
+        Matrix< DDRMat > mValues;
+
+        const bool mVecBuildWithPointMap;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * @brief local index of a global ID or, for point-map vectors, of a point ID
+         */
+        sint get_local_index( sint aId ) const;
+
+      public:
+        //----------------------------------------------------------------------------------------------
+
+        Vector_Native(
+                sol::Dist_Map* aMapClass,
+                const sint     aNumVectors,
+                bool           aPointMap  = false,
+                bool           aManageMap = false );
+
+        /** Destructor */
+        ~Vector_Native() override;
+
+        //----------------------------------------------------------------------------------------------
+
+        real& operator()( sint aGlobalId, uint aVectorIndex = 0 ) override;
+
+        sol::Dist_Map*
+        get_map() override
+        {
+            return mMap;
+        }
+
+        //----------------------------------------------------------------------------------------------
+
+        void replace_global_values(
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                const moris::Matrix< DDRMat >& aValues,
+                const uint&                    aVectorIndex = 0 ) override;
+
+        void replace_global_values(
+                const Vector< sint >& aGlobalIds,
+                const Vector< real >& aValues ) override;
+
+        void sum_into_global_values(
+                const moris::Matrix< DDSMat >& aGlobalIds,
+                const moris::Matrix< DDRMat >& aValues,
+                const uint&                    aVectorIndex = 0 ) override;
+
+        void sum_into_global_values(
+                const Vector< sint >&          aGlobalIds,
+                const moris::Matrix< DDRMat >& aValues,
+                const uint&                    aVectorIndex = 0 ) override;
+
+        void vector_global_assembly() override;
+
+        void vec_plus_vec(
+                const moris::real& aScaleA,
+                sol::Dist_Vector&  aVecA,
+                const moris::real& aScaleThis ) override;
+
+        void scale_vector(
+                const moris::real& aValue,
+                const moris::uint& aVecIndex = 0 ) override;
+
+        void import_local_to_global( sol::Dist_Vector& aSourceVec ) override;
+
+        void vec_put_scalar( const moris::real& aValue ) override;
+
+        void random() override;
+
+        moris::sint vec_local_length() const override;
+
+        moris::sint vec_global_length() const override;
+
+        Vector< moris::real > vec_norm2() override;
+
+        moris::real dot(
+                sol::Dist_Vector& aVector,
+                const moris::uint aVectorIndex = 0 ) override;
+
+        //----------------------------------------------------------------------------------------------
+
+        /**
+         * Returns the dot product of two contiguous arrays, also used by the native linear solver
+         * on its work vectors.
+         *
+         * @param[in] aLength  Number of entries.
+         * @param[in] aX       First array.
+         * @param[in] aY       Second array.
+         */
+        static moris::real local_dot(
+                moris::sint        aLength,
+                const moris::real* aX,
+                const moris::real* aY );
+
+        void extract_copy( moris::Matrix< DDRMat >& LHSValues ) override;
+
+        void extract_copy( Vector< real >& aVector ) override;
+
+        void extract_my_values(
+                const moris::uint&                 aNumIndices,
+                const moris::Matrix< DDSMat >&     aGlobalRows,
+                const moris::uint&                 aRowOffsets,
+                Vector< moris::Matrix< DDRMat > >& LHSValues ) override;
+
+        void print() const override;
+
+        void save_vector_to_matrix_market_file( const char* aFilename ) override;
+
+        void save_vector_to_matlab_file( const char* aFilename ) override;
+
+        void save_vector_to_HDF5( const char* aFilename ) override;
+
+        void read_vector_from_HDF5(
+                const char* aFilename,
+                std::string aGroupName   = "LHS",
+                sint        aVectorindex = 0 ) override;
+
+        //----------------------------------------------------------------------------------------------
+
+        moris::real*
+        get_values_pointer() override
+        {
+            return mValues.data();
+        };
+
+        //----------------------------------------------------------------------------------------------
+
+        const moris::real*
+        get_values_pointer() const
+        {
+            return mValues.data();
+        };
+    };
+}    // namespace moris
@@ -314,6 +314,23 @@ Vector_PETSc::vec_norm2()
 
 //-----------------------------------------------------------------------------
 
+moris::real
+Vector_PETSc::dot(
+        sol::Dist_Vector& aVector,
+        const moris::uint aVectorIndex )
+{
+    MORIS_ASSERT( aVectorIndex == 0,
+            "Vector_PETSc::dot - PETSc vectors hold a single vector" );
+
+    real tDot = 0.0;
+
+    VecDot( mPetscVector, dynamic_cast< Vector_PETSc& >( aVector ).get_petsc_vector(), &tDot );
+
+    return tDot;
+}
+
+//-----------------------------------------------------------------------------
+
 void
 Vector_PETSc::check_vector()
 {
@@ -121,6 +121,10 @@ namespace moris
 
         Vector< moris::real > vec_norm2() override;
 
+        moris::real dot(
+                sol::Dist_Vector& aVector,
+                const moris::uint aVectorIndex = 0 ) override;
+
         void extract_copy( moris::Matrix< DDRMat >& LHSValues ) override;
 
         void extract_copy( Vector< real >& aVector ) override;
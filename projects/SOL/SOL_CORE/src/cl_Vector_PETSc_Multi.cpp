@@ -318,6 +318,36 @@ MultiVector_PETSc::vec_norm2()
 
 //-----------------------------------------------------------------------------
 
+moris::real
+MultiVector_PETSc::dot(
+        sol::Dist_Vector& aVector,
+        const moris::uint aVectorIndex )
+{
+    Mat tOtherVector = dynamic_cast< MultiVector_PETSc& >( aVector ).get_petsc_vector();
+
+    moris::sint tVectorLength = this->vec_local_length();
+
+    // get the owned part of the column of both multi-vectors
+    PetscScalar* tValues;
+    PetscScalar* tOtherValues;
+    MatDenseGetColumn( mPetscVector, aVectorIndex, &tValues );
+    MatDenseGetColumn( tOtherVector, aVectorIndex, &tOtherValues );
+
+    real tDot = 0.0;
+    for ( moris::sint Ik = 0; Ik < tVectorLength; Ik++ )
+    {
+        tDot += tValues[ Ik ] * tOtherValues[ Ik ];
+    }
+
+    // restore the columns
+    MatDenseRestoreColumn( tOtherVector, &tOtherValues );
+    MatDenseRestoreColumn( mPetscVector, &tValues );
+
+    return sum_all( tDot );
+}
+
+//-----------------------------------------------------------------------------
+
 void
 MultiVector_PETSc::check_vector()
 {
@@ -8,9 +8,15 @@
  *
  */
 
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
 #include "cl_TSA_Monolithic_Time_Solver.hpp"
 #include "cl_TSA_Time_Solver.hpp"
 #include "cl_SOL_Dist_Vector.hpp"
+#include "cl_SOL_Warehouse.hpp"
 #include "cl_DLA_Solver_Interface.hpp"
 #include "cl_SOL_Matrix_Vector_Factory.hpp"
 #include "cl_NLA_Nonlinear_Solver.hpp"
@@ -22,10 +28,77 @@
 
 #include "HDF5_Tools.hpp"
 
+#include "cl_Communication_Tools.hpp"
+
 using namespace moris;
 using namespace tsa;
 //-------------------------------------------------------------------------------
 
+namespace
+{
+    // number of time steps which can be reversed with a given number of checkpoints and forward repetitions
+    real
+    get_binomial_range(
+            uint aNumCheckpoints,
+            uint aNumRepetitions )
+    {
+        real tRange = 1.0;
+
+        for ( uint i = 1; i <= aNumCheckpoints; i++ )
+        {
+            tRange = tRange * ( aNumRepetitions + i ) / i;
+        }
+
+        return tRange;
+    }
+
+    // offset of the next checkpoint in an interval of time steps following binomial checkpointing:
+    // the states after the checkpoint are reversed with one checkpoint less, the states before it
+    // with one forward repetition less
+    uint
+    get_checkpoint_split(
+            uint aNumSteps,
+            uint aNumCheckpoints )
+    {
+        uint tNumRepetitions = 0;
+
+        while ( get_binomial_range( aNumCheckpoints, tNumRepetitions ) < aNumSteps )
+        {
+            tNumRepetitions++;
+        }
+
+        real tRightRange = get_binomial_range( aNumCheckpoints - 1, tNumRepetitions );
+
+        return aNumSteps - (uint)std::min( (real)( aNumSteps - 1 ), tRightRange );
+    }
+}    // namespace
+
+//-------------------------------------------------------------------------------
+
+Monolithic_Time_Solver::Monolithic_Time_Solver( const Parameter_List& aParameterlist )
+        : Time_Solver_Algorithm( aParameterlist )
+{
+    mTimeFrame = aParameterlist.get< real >( "TSA_Time_Frame" );
+
+    // parameters for adaptive time stepping
+    mAdaptiveTimeStepping = aParameterlist.get< bool >( "TSA_Adaptive_Time_Stepping" );
+    mAdaptiveTolerance    = aParameterlist.get< real >( "TSA_Adaptive_Tolerance" );
+    mMinTimeIncrement     = aParameterlist.get< real >( "TSA_Adaptive_Min_Time_Increment" );
+    mMaxTimeIncrement     = aParameterlist.get< real >( "TSA_Adaptive_Max_Time_Increment" );
+    mSafetyFactor         = aParameterlist.get< real >( "TSA_Adaptive_Safety_Factor" );
+    mMaxGrowthFactor      = aParameterlist.get< real >( "TSA_Adaptive_Max_Growth_Factor" );
+    mMaxRejections        = aParameterlist.get< sint >( "TSA_Adaptive_Max_Rejections" );
+
+    MORIS_ERROR( !mAdaptiveTimeStepping || ( mMinTimeIncrement > 0.0 && mMinTimeIncrement <= mMaxTimeIncrement ),
+            "Monolithic_Time_Solver::Monolithic_Time_Solver - minimum time increment needs to be positive and not larger than maximum time increment." );
+
+    // parameters for checkpointing of states for sensitivity analysis
+    mNumCheckpoints      = aParameterlist.get< sint >( "TSA_Adjoint_Checkpoints" );
+    mCheckpointDirectory = aParameterlist.get< std::string >( "TSA_Adjoint_Checkpoint_Directory" );
+}
+
+//-------------------------------------------------------------------------------
+
 void Monolithic_Time_Solver::solve_monolithic_time_system( Vector< sol::Dist_Vector* >& aFullVector )
 {
     // trace this solve
@@ -35,20 +108,29 @@ void Monolithic_Time_Solver::solve_monolithic_time_system( Vector< sol::Dist_Vec
 
     moris::real tTime_Scalar = 0.0;
 
-    bool tMaxTimeIterationReached = false;
-
     // get list of time frames
     Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
 
     Matrix< DDRMat > tTimeInitial( 2, 1, 0.0 );
     tTimeFrames.push_back( tTimeInitial );
 
-    for ( uint iTimeStep = 0; iTimeStep < mTimeSteps; iTimeStep++ )
+    // keep the checkpoints of the first branch of the binomial schedule during the forward analysis
+    mIsForwardCheckpoint.clear();
+    mIsForwardCheckpoint.resize( mTimeSteps + 1, false );
+
+    mIsStoredOnDisk.clear();
+
+    uint tCheckpoint = 0;
+
+    for ( uint iCheckpoint = mNumCheckpoints; iCheckpoint > 0 && mTimeSteps - tCheckpoint > 1; iCheckpoint-- )
     {
-        // get solvec and prev solvec index
-        uint tSolVecIndex     = iTimeStep + 1;
-        uint tPrevSolVecIndex = iTimeStep;
+        tCheckpoint += get_checkpoint_split( mTimeSteps - tCheckpoint, iCheckpoint );
+
+        mIsForwardCheckpoint( tCheckpoint ) = true;
+    }
 
+    for ( uint iTimeStep = 0; iTimeStep < mTimeSteps; iTimeStep++ )
+    {
         // initialize time for time slab
         Matrix< DDRMat > tTime( 2, 1, tTime_Scalar );
         tTime_Scalar += mTimeIncrements;
@@ -56,65 +138,282 @@ void Monolithic_Time_Solver::solve_monolithic_time_system( Vector< sol::Dist_Vec
 
         tTimeFrames.push_back( tTime );
 
-        // log number of time steps
-        MORIS_LOG_ITERATION();
+        this->solve_time_slab( aFullVector, iTimeStep );
+
+        this->finalize_time_slab( aFullVector, iTimeStep, tTime( 1 ), iTimeStep == mTimeSteps - 1 );
+
+        this->release_forward_states( aFullVector, iTimeStep );
+    }
+
+    mNumAcceptedTimeSteps = mTimeSteps;
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::solve_adaptive_time_system( Vector< sol::Dist_Vector* >& aFullVector )
+{
+    // trace this solve
+    Tracer tTracer( "Time Solver Algorithm", "Monolithic", "Solve" );
+
+    this->finalize();
+
+    // get list of time frames
+    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    Matrix< DDRMat > tTimeInitial( 2, 1, 0.0 );
+    tTimeFrames.push_back( tTimeInitial );
+
+    // number of time slabs is not known in advance, thus all checkpoints are placed during sensitivity analysis
+    mIsForwardCheckpoint.clear();
+    mIsStoredOnDisk.clear();
 
-        mSolverInterface->set_solution_vector( aFullVector( tSolVecIndex ) );
-        mSolverInterface->set_solution_vector_prev_time_step( aFullVector( tPrevSolVecIndex ) );
+    // create work vectors for the two half steps used to estimate the error of a time slab
+    sol::Matrix_Vector_Factory tMatFactory( mMyTimeSolver->get_solver_warehouse()->get_tpl_type() );
 
-        // set time for previous time slab
-        mSolverInterface->set_previous_time( tTimeFrames( tPrevSolVecIndex ) );
+    Vector< sol::Dist_Vector* > tHalfSteps( 2, nullptr );
 
-        // set time for current time slab
-        mSolverInterface->set_time( tTimeFrames( tSolVecIndex ) );
+    for ( auto& tHalfStep : tHalfSteps )
+    {
+        tHalfStep = tMatFactory.create_vector( mSolverInterface, mFullMap, mSolverInterface->get_num_rhs() );
+    }
+
+    // initial time increment is given by number of time steps
+    real tTimeIncrement = std::max( std::min( mTimeIncrements, mMaxTimeIncrement ), mMinTimeIncrement );
+
+    real tStartTime     = 0.0;
+    uint tTimeStep      = 0;
+    uint tNumRejections = 0;
+    bool tIsLastStep    = false;
+
+    while ( !tIsLastStep )
+    {
+        uint tSolVecIndex = tTimeStep + 1;
+
+        // extend time slab to end of time frame instead of leaving a small remainder, unless this
+        // exceeds the maximum time increment
+        real tEndTime = tStartTime + tTimeIncrement;
+        tIsLastStep   = mTimeFrame - tStartTime <= std::min( 1.1 * tTimeIncrement, mMaxTimeIncrement );
+
+        if ( tIsLastStep )
+        {
+            tEndTime = mTimeFrame;
+        }
 
-        // log time slap
-        MORIS_LOG_SPEC( "Forward Solve Time Slab", iTimeStep + 1 );
-        MORIS_LOG_SPEC( "Time Slab Start Time", tTimeFrames( tSolVecIndex )( 0, 0 ) );
-        MORIS_LOG_SPEC( "Time Slab End Time", tTimeFrames( tSolVecIndex )( 1, 0 ) );
+        // initialize time for time slab; a rejected time slab is overwritten
+        Matrix< DDRMat > tTime = { { tStartTime }, { tEndTime } };
 
-        mNonlinearSolver->set_time_step_iter( iTimeStep );
+        if ( tTimeFrames.size() > tSolVecIndex )
+        {
+            tTimeFrames( tSolVecIndex ) = tTime;
+        }
+        else
+        {
+            tTimeFrames.push_back( tTime );
+        }
 
-        mNonlinearSolver->solve( aFullVector( tSolVecIndex ) );
+        // estimate local error by step doubling; the half steps are solved first such that the
+        // solver interface is set to the full time slab afterwards
+        real tError = this->estimate_local_error( aFullVector, tHalfSteps, tTimeStep );
 
-        if ( iTimeStep == mTimeSteps - 1 )
+        // compute optimal scaling of time increment for a local error of second order in the time increment
+        real tFactor = 1.0;
+
+        if ( tError > 0.0 )
         {
-            tMaxTimeIterationReached = true;
+            tFactor = std::max( 0.2, std::min( mMaxGrowthFactor, mSafetyFactor * std::sqrt( mAdaptiveTolerance / tError ) ) );
         }
 
-        mSolverInterface->compute_IQI();
+        MORIS_LOG_SPEC( "Time Slab Error Estimate", tError );
+
+        // reject time slab if error is too large
+        real tActualIncrement = tEndTime - tStartTime;
 
-        // if separate output of solution to file is requested
-        if ( mOutputSolVecFileName.size() > 0 )
+        if ( tError > mAdaptiveTolerance && tActualIncrement > mMinTimeIncrement && tNumRejections < mMaxRejections )
         {
-            // get iteration of time solver
-            uint tTSAIter = gLogger.get_iteration( "TimeSolverAlgorithm", LOGGER_ARBITRARY_DESCRIPTOR, LOGGER_ARBITRARY_DESCRIPTOR );
+            tNumRejections++;
 
-            // construct string from output file name
-            std::string tStrOutputFile = mOutputSolVecFileName + "." + ios::stringify( tTSAIter ) + ".hdf5";
+            tTimeIncrement = std::max( std::min( tFactor, 1.0 ) * tActualIncrement, mMinTimeIncrement );
 
-            // log/print that the initial guess is read from file
-            MORIS_LOG_INFO( "Saving solution vector to file: %s", tStrOutputFile.c_str() );
+            MORIS_LOG_INFO( "Time slab rejected, error estimate %e, retrying with time increment %e", tError, tTimeIncrement );
 
-            // FIXME: this option doesn't work in parallel, only for serial debugging purposes
-            // MORIS_ERROR( par_size() == 1, "Monolithic_Time_Solver::solve_monolithic_time_system() - "
-            //         "Writing solutions to hdf5 file only possible in serial." );
+            // reset initial guess to solution of previous time slab
+            aFullVector( tSolVecIndex )->vec_plus_vec( 1.0, *aFullVector( tTimeStep ), 0.0 );
 
-            // convert distributed vector to moris mat
-            Matrix< DDRMat > tSolVec;
-            aFullVector( tSolVecIndex )->extract_copy( tSolVec );
+            tIsLastStep = false;
 
-            // read HDF5 file to moris matrix
-            hid_t  tFileID = create_hdf5_file( tStrOutputFile );
-            herr_t tStatus = 0;
-            save_matrix_to_hdf5_file( tFileID, "SolVec", tSolVec, tStatus );
+            continue;
         }
 
-        // input second time slap value for output
-        mMyTimeSolver->check_for_outputs( tTime( 1 ), tMaxTimeIterationReached );
+        tNumRejections = 0;
+
+        this->finalize_time_slab( aFullVector, tTimeStep, tEndTime, tIsLastStep );
+
+        this->release_forward_states( aFullVector, tTimeStep );
 
-        mMyTimeSolver->prepare_sol_vec_for_next_time_step();
+        // advance in time and compute next time increment
+        tStartTime = tEndTime;
+        tTimeStep++;
+
+        tTimeIncrement = std::max( std::min( tFactor * tActualIncrement, mMaxTimeIncrement ), mMinTimeIncrement );
     }
+
+    for ( auto& tHalfStep : tHalfSteps )
+    {
+        delete tHalfStep;
+    }
+
+    // number of accepted time slabs is used by sensitivity analysis
+    mNumAcceptedTimeSteps = tTimeStep;
+
+    MORIS_LOG_INFO( "Number of accepted time slabs: %d", tTimeStep );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::solve_time_slab(
+        Vector< sol::Dist_Vector* >& aFullVector,
+        uint                         aTimeStep )
+{
+    // get solvec and prev solvec index
+    uint tSolVecIndex     = aTimeStep + 1;
+    uint tPrevSolVecIndex = aTimeStep;
+
+    // get list of time frames
+    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    // log number of time steps
+    MORIS_LOG_ITERATION();
+
+    // log time slap
+    MORIS_LOG_SPEC( "Forward Solve Time Slab", aTimeStep + 1 );
+    MORIS_LOG_SPEC( "Time Slab Start Time", tTimeFrames( tSolVecIndex )( 0, 0 ) );
+    MORIS_LOG_SPEC( "Time Slab End Time", tTimeFrames( tSolVecIndex )( 1, 0 ) );
+
+    this->solve_time_interval(
+            aFullVector( tSolVecIndex ),
+            aFullVector( tPrevSolVecIndex ),
+            tTimeFrames( tSolVecIndex ),
+            tTimeFrames( tPrevSolVecIndex ),
+            aTimeStep );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::solve_time_interval(
+        sol::Dist_Vector*       aSolution,
+        sol::Dist_Vector*       aPrevSolution,
+        const Matrix< DDRMat >& aTime,
+        const Matrix< DDRMat >& aPrevTime,
+        uint                    aTimeStep )
+{
+    mSolverInterface->set_solution_vector( aSolution );
+    mSolverInterface->set_solution_vector_prev_time_step( aPrevSolution );
+
+    // set time for previous time slab
+    mSolverInterface->set_previous_time( aPrevTime );
+
+    // set time for current time slab
+    mSolverInterface->set_time( aTime );
+
+    mNonlinearSolver->set_time_step_iter( aTimeStep );
+
+    mNonlinearSolver->solve( aSolution );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::finalize_time_slab(
+        Vector< sol::Dist_Vector* >& aFullVector,
+        uint                         aTimeStep,
+        real                         aEndTime,
+        bool                         aIsLastStep )
+{
+    // get solvec index
+    uint tSolVecIndex = aTimeStep + 1;
+
+    mSolverInterface->compute_IQI();
+
+    // if separate output of solution to file is requested
+    if ( mOutputSolVecFileName.size() > 0 )
+    {
+        // get iteration of time solver
+        uint tTSAIter = gLogger.get_iteration( "TimeSolverAlgorithm", LOGGER_ARBITRARY_DESCRIPTOR, LOGGER_ARBITRARY_DESCRIPTOR );
+
+        // construct string from output file name
+        std::string tStrOutputFile = mOutputSolVecFileName + "." + ios::stringify( tTSAIter ) + ".hdf5";
+
+        // log/print that the initial guess is read from file
+        MORIS_LOG_INFO( "Saving solution vector to file: %s", tStrOutputFile.c_str() );
+
+        // FIXME: this option doesn't work in parallel, only for serial debugging purposes
+        // MORIS_ERROR( par_size() == 1, "Monolithic_Time_Solver::solve_monolithic_time_system() - "
+        //         "Writing solutions to hdf5 file only possible in serial." );
+
+        // convert distributed vector to moris mat
+        Matrix< DDRMat > tSolVec;
+        aFullVector( tSolVecIndex )->extract_copy( tSolVec );
+
+        // read HDF5 file to moris matrix
+        hid_t  tFileID = create_hdf5_file( tStrOutputFile );
+        herr_t tStatus = 0;
+        save_matrix_to_hdf5_file( tFileID, "SolVec", tSolVec, tStatus );
+    }
+
+    // input second time slap value for output
+    mMyTimeSolver->check_for_outputs( aEndTime, aIsLastStep );
+
+    mMyTimeSolver->prepare_sol_vec_for_next_time_step();
+}
+
+//-------------------------------------------------------------------------------
+
+real
+Monolithic_Time_Solver::estimate_local_error(
+        Vector< sol::Dist_Vector* >& aFullVector,
+        Vector< sol::Dist_Vector* >& aHalfSteps,
+        uint                         aTimeStep )
+{
+    // get solvec and prev solvec index
+    uint tSolVecIndex     = aTimeStep + 1;
+    uint tPrevSolVecIndex = aTimeStep;
+
+    // get list of time frames
+    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    const Matrix< DDRMat >& tTime     = tTimeFrames( tSolVecIndex );
+    const Matrix< DDRMat >& tPrevTime = tTimeFrames( tPrevSolVecIndex );
+
+    real tMidTime = 0.5 * ( tTime( 0 ) + tTime( 1 ) );
+
+    Matrix< DDRMat > tFirstHalf  = { { tTime( 0 ) }, { tMidTime } };
+    Matrix< DDRMat > tSecondHalf = { { tMidTime }, { tTime( 1 ) } };
+
+    // solve both halves of the time slab starting from the previous time slab
+    aHalfSteps( 0 )->vec_plus_vec( 1.0, *aFullVector( tPrevSolVecIndex ), 0.0 );
+    this->solve_time_interval( aHalfSteps( 0 ), aFullVector( tPrevSolVecIndex ), tFirstHalf, tPrevTime, aTimeStep );
+
+    aHalfSteps( 1 )->vec_plus_vec( 1.0, *aHalfSteps( 0 ), 0.0 );
+    this->solve_time_interval( aHalfSteps( 1 ), aHalfSteps( 0 ), tSecondHalf, tFirstHalf, aTimeStep );
+
+    // solve the full time slab
+    this->solve_time_slab( aFullVector, aTimeStep );
+
+    // for a local error of second order in the time increment, the error of the full time slab is twice
+    // the difference to the half steps
+    aHalfSteps( 1 )->vec_plus_vec( 2.0, *aFullVector( tSolVecIndex ), -2.0 );
+
+    Vector< real > tDifferenceNorm = aHalfSteps( 1 )->vec_norm2();
+    Vector< real > tSolutionNorm   = aFullVector( tSolVecIndex )->vec_norm2();
+
+    // take maximum over all right hand sides
+    real tError = 0.0;
+
+    for ( uint iRHS = 0; iRHS < tDifferenceNorm.size(); iRHS++ )
+    {
+        tError = std::max( tError, tDifferenceNorm( iRHS ) / std::max( tSolutionNorm( iRHS ), MORIS_REAL_EPS ) );
+    }
+
+    return tError;
 }
 
 //-------------------------------------------------------------------------------
@@ -124,50 +423,343 @@ void Monolithic_Time_Solver::solve_implicit_DqDs( Vector< sol::Dist_Vector* >& a
     // trace this solve
     Tracer tTracer( "TimeSolver", "Monolithic", "Solve" );
 
-    // initialize time for time slab
-    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
-
     uint tStopTimeStepIndex = 0;    // Only consider last time step
 
     Vector< sol::Dist_Vector* >& tSolVec = mMyTimeSolver->get_solution_vectors();
 
+    // recompute states from checkpoints
+    if ( mNumCheckpoints > 0 )
+    {
+        this->reverse_sweep( tSolVec, aFullAdjointVector, tStopTimeStepIndex, mNumAcceptedTimeSteps, mNumCheckpoints );
+
+        return;
+    }
+
     // Loop over all time iterations backwards
-    for ( uint Ik = mTimeSteps; Ik > tStopTimeStepIndex; --Ik )
+    for ( uint Ik = mNumAcceptedTimeSteps; Ik > tStopTimeStepIndex; --Ik )
     {
-        // get solvec and prev solvec index
-        uint tSolVecIndex     = Ik;
-        uint tPrevSolVecIndex = Ik - 1;
+        this->solve_adjoint_time_slab( tSolVec, aFullAdjointVector, Ik );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::solve_adjoint_time_slab(
+        Vector< sol::Dist_Vector* >& aStates,
+        Vector< sol::Dist_Vector* >& aFullAdjointVector,
+        uint                         aTimeStep )
+{
+    // initialize time for time slab
+    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    // get solvec and prev solvec index
+    uint tSolVecIndex     = aTimeStep;
+    uint tPrevSolVecIndex = aTimeStep - 1;
+
+    // log number of time steps
+    MORIS_LOG_ITERATION();
+
+    mSolverInterface->set_solution_vector( aStates( tSolVecIndex ) );
+    mSolverInterface->set_solution_vector_prev_time_step( aStates( tPrevSolVecIndex ) );
+
+    mSolverInterface->set_adjoint_solution_vector( aFullAdjointVector( 0 ) );
+    mSolverInterface->set_previous_adjoint_solution_vector( aFullAdjointVector( 1 ) );
+
+    // set time for current time slab ( since off-diagonal is computed on same time level for implicit DqDs)
+    mSolverInterface->set_previous_time( tTimeFrames( tPrevSolVecIndex ) );
+    mSolverInterface->set_time( tTimeFrames( tSolVecIndex ) );
+
+    // log time slap
+    MORIS_LOG_SPEC( "Adjoint Solve Time Slab", aTimeStep );
+    MORIS_LOG_SPEC( "Time Slab Start Time", tTimeFrames( tSolVecIndex )( 0, 0 ) );
+    MORIS_LOG_SPEC( "Time Slab End Time", tTimeFrames( tSolVecIndex )( 1, 0 ) );
+
+    mNonlinearSolverForSensitivityAnalysis->set_time_step_iter( aTimeStep );
+
+    mNonlinearSolverForSensitivityAnalysis->solve( aFullAdjointVector( 0 ) );
+
+    Vector< enum MSI::Dof_Type > tDofTypeUnion = mMyTimeSolver->get_dof_type_union();
+
+    mSolverInterface->set_requested_dof_types( tDofTypeUnion );
+
+    mSolverInterface->postmultiply_implicit_dQds();
 
-        // log number of time steps
-        MORIS_LOG_ITERATION();
+    aFullAdjointVector( 1 )->vec_plus_vec( 1.0, *( aFullAdjointVector( 0 ) ), 0.0 );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::reverse_sweep(
+        Vector< sol::Dist_Vector* >& aStates,
+        Vector< sol::Dist_Vector* >& aFullAdjointVector,
+        uint                         aStart,
+        uint                         aEnd,
+        uint                         aNumCheckpoints )
+{
+    // single time slab: recompute its state if needed and solve adjoint problem
+    if ( aEnd == aStart + 1 )
+    {
+        this->advance_states( aStates, aStart, aEnd );
+
+        this->solve_adjoint_time_slab( aStates, aFullAdjointVector, aEnd );
+
+        // the final state is kept for post processing
+        if ( aEnd < mNumAcceptedTimeSteps )
+        {
+            this->release_state( aStates, aEnd );
+        }
+
+        return;
+    }
 
-        mSolverInterface->set_solution_vector( tSolVec( tSolVecIndex ) );
-        mSolverInterface->set_solution_vector_prev_time_step( tSolVec( tPrevSolVecIndex ) );
+    // no checkpoint left: recompute each state from the beginning of the interval
+    if ( aNumCheckpoints == 0 )
+    {
+        for ( uint iTimeStep = aEnd; iTimeStep > aStart; iTimeStep-- )
+        {
+            this->advance_states( aStates, aStart, iTimeStep - 1 );
 
-        mSolverInterface->set_adjoint_solution_vector( aFullAdjointVector( 0 ) );
-        mSolverInterface->set_previous_adjoint_solution_vector( aFullAdjointVector( 1 ) );
+            this->reverse_sweep( aStates, aFullAdjointVector, iTimeStep - 1, iTimeStep, 0 );
+
+            if ( iTimeStep - 1 > aStart )
+            {
+                this->release_state( aStates, iTimeStep - 1 );
+            }
+        }
+
+        return;
+    }
 
-        // set time for current time slab ( since off-diagonal is computed on same time level for implicit DqDs)
-        mSolverInterface->set_previous_time( tTimeFrames( tPrevSolVecIndex ) );
-        mSolverInterface->set_time( tTimeFrames( tSolVecIndex ) );
+    // place checkpoint and reverse the intervals after and before it
+    uint tCheckpoint = aStart + get_checkpoint_split( aEnd - aStart, aNumCheckpoints );
 
-        // log time slap
-        MORIS_LOG_SPEC( "Adjoint Solve Time Slab", Ik );
-        MORIS_LOG_SPEC( "Time Slab Start Time", tTimeFrames( tSolVecIndex )( 0, 0 ) );
-        MORIS_LOG_SPEC( "Time Slab End Time", tTimeFrames( tSolVecIndex )( 1, 0 ) );
+    this->advance_states( aStates, aStart, tCheckpoint );
 
-        mNonlinearSolverForSensitivityAnalysis->set_time_step_iter( Ik );
+    this->store_checkpoint( aStates, tCheckpoint );
 
-        mNonlinearSolverForSensitivityAnalysis->solve( aFullAdjointVector( 0 ) );
+    this->reverse_sweep( aStates, aFullAdjointVector, tCheckpoint, aEnd, aNumCheckpoints - 1 );
 
-        Vector< enum MSI::Dof_Type > tDofTypeUnion = mMyTimeSolver->get_dof_type_union();
+    this->release_state( aStates, tCheckpoint );
+
+    this->reverse_sweep( aStates, aFullAdjointVector, aStart, tCheckpoint, aNumCheckpoints );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::advance_states(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aStart,
+        uint                         aEnd )
+{
+    // start from latest available state
+    uint tFirstState = aEnd;
+
+    while ( tFirstState > aStart && !this->is_state_available( aStates, tFirstState ) )
+    {
+        tFirstState--;
+    }
+
+    this->load_state( aStates, tFirstState );
+
+    // get list of time frames
+    Vector< Matrix< DDRMat > >& tTimeFrames = mMyTimeSolver->get_time_frames();
+
+    sol::Matrix_Vector_Factory tMatFactory( mMyTimeSolver->get_solver_warehouse()->get_tpl_type() );
+
+    for ( uint iState = tFirstState + 1; iState <= aEnd; iState++ )
+    {
+        MORIS_LOG_SPEC( "Recompute Time Slab", iState );
+
+        // use previous state as initial guess; get_num_rhs() refers to the sensitivity analysis here
+        aStates( iState ) = tMatFactory.create_vector( mSolverInterface, mFullMap, aStates( iState - 1 )->get_num_vectors() );
+        aStates( iState )->vec_plus_vec( 1.0, *aStates( iState - 1 ), 0.0 );
+
+        mSolverInterface->set_solution_vector( aStates( iState ) );
+        mSolverInterface->set_solution_vector_prev_time_step( aStates( iState - 1 ) );
+
+        mSolverInterface->set_previous_time( tTimeFrames( iState - 1 ) );
+        mSolverInterface->set_time( tTimeFrames( iState ) );
+
+        // solve forward problem of time slab; the sets are re-initialized for the forward dof types
+        Vector< enum MSI::Dof_Type > tDofTypeUnion = mNonlinearSolver->get_dof_type_union();
 
         mSolverInterface->set_requested_dof_types( tDofTypeUnion );
+        mSolverInterface->set_secondary_dof_types( tDofTypeUnion );
+
+        mSolverInterface->set_forward_recomputation( true );
+
+        mNonlinearSolver->set_time_step_iter( iState - 1 );
+
+        mNonlinearSolver->solve( aStates( iState ) );
+
+        // switch back and re-initialize the sets for the sensitivity analysis
+        tDofTypeUnion = mNonlinearSolverForSensitivityAnalysis->get_dof_type_union();
+
+        mSolverInterface->set_requested_dof_types( tDofTypeUnion );
+        mSolverInterface->set_secondary_dof_types( tDofTypeUnion );
+
+        mSolverInterface->set_forward_recomputation( false );
+
+        // release intermediate states
+        if ( iState - 1 > aStart )
+        {
+            this->release_state( aStates, iState - 1 );
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::release_forward_states(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aTimeStep )
+{
+    // the two latest states are needed for the next time slab and its error estimate;
+    // the initial state is always kept
+    if ( mNumCheckpoints == 0 || aTimeStep < 2 )
+    {
+        return;
+    }
+
+    uint tIndex = aTimeStep - 1;
+
+    if ( tIndex < mIsForwardCheckpoint.size() && mIsForwardCheckpoint( tIndex ) )
+    {
+        this->store_checkpoint( aStates, tIndex );
+    }
+    else
+    {
+        this->release_state( aStates, tIndex );
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::store_checkpoint(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aIndex )
+{
+    // checkpoints are kept in memory if no directory is given
+    if ( mCheckpointDirectory.empty() || aStates( aIndex ) == nullptr )
+    {
+        return;
+    }
+
+    std::string tFileName = this->get_checkpoint_file_name( aIndex );
 
-        mSolverInterface->postmultiply_implicit_dQds();
+    std::ofstream tFile( tFileName, std::ios::binary );
 
-        aFullAdjointVector( 1 )->vec_plus_vec( 1.0, *( aFullAdjointVector( 0 ) ), 0.0 );
+    MORIS_ERROR( tFile.good(),
+            "Monolithic_Time_Solver::store_checkpoint - could not open file %s.",
+            tFileName.c_str() );
+
+    // copy local entries of all vectors of the state, independent of the storage of the vector
+    Matrix< DDRMat > tValues;
+    aStates( aIndex )->extract_copy( tValues );
+
+    uint64_t tSize[ 2 ] = { tValues.n_rows(), tValues.n_cols() };
+
+    tFile.write( reinterpret_cast< const char* >( tSize ), sizeof( tSize ) );
+    tFile.write( reinterpret_cast< const char* >( tValues.data() ), tValues.numel() * sizeof( real ) );
+
+    tFile.close();
+
+    if ( aIndex >= mIsStoredOnDisk.size() )
+    {
+        mIsStoredOnDisk.resize( aIndex + 1, false );
     }
+
+    mIsStoredOnDisk( aIndex ) = true;
+
+    delete aStates( aIndex );
+    aStates( aIndex ) = nullptr;
+}
+
+//-------------------------------------------------------------------------------
+
+bool Monolithic_Time_Solver::is_state_available(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aIndex )
+{
+    return aStates( aIndex ) != nullptr || ( aIndex < mIsStoredOnDisk.size() && mIsStoredOnDisk( aIndex ) );
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::load_state(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aIndex )
+{
+    if ( aStates( aIndex ) != nullptr )
+    {
+        return;
+    }
+
+    MORIS_ERROR( this->is_state_available( aStates, aIndex ),
+            "Monolithic_Time_Solver::load_state - state %d neither in memory nor on disk.",
+            aIndex );
+
+    sol::Matrix_Vector_Factory tMatFactory( mMyTimeSolver->get_solver_warehouse()->get_tpl_type() );
+
+    std::string tFileName = this->get_checkpoint_file_name( aIndex );
+
+    std::ifstream tFile( tFileName, std::ios::binary );
+
+    MORIS_ERROR( tFile.good(),
+            "Monolithic_Time_Solver::load_state - could not open file %s.",
+            tFileName.c_str() );
+
+    uint64_t tSize[ 2 ];
+    tFile.read( reinterpret_cast< char* >( tSize ), sizeof( tSize ) );
+
+    Matrix< DDRMat > tValues( tSize[ 0 ], tSize[ 1 ] );
+    tFile.read( reinterpret_cast< char* >( tValues.data() ), tValues.numel() * sizeof( real ) );
+
+    MORIS_ERROR( tFile.good(),
+            "Monolithic_Time_Solver::load_state - could not read file %s.",
+            tFileName.c_str() );
+
+    // local entries are ordered as the IDs of the full map
+    Matrix< DDSMat > tGlobalIds = mSolverInterface->get_my_local_global_overlapping_map();
+
+    MORIS_ERROR( tGlobalIds.numel() == tValues.n_rows(),
+            "Monolithic_Time_Solver::load_state - checkpoint %d does not match the full map.",
+            aIndex );
+
+    // the number of vectors of a state is independent of the number of sensitivity RHS
+    aStates( aIndex ) = tMatFactory.create_vector( mSolverInterface, mFullMap, tValues.n_cols() );
+
+    for ( uint iVec = 0; iVec < tValues.n_cols(); iVec++ )
+    {
+        aStates( aIndex )->replace_global_values( tGlobalIds, tValues.get_column( iVec ), iVec );
+    }
+
+    aStates( aIndex )->vector_global_assembly();
+}
+
+//-------------------------------------------------------------------------------
+
+void Monolithic_Time_Solver::release_state(
+        Vector< sol::Dist_Vector* >& aStates,
+        uint                         aIndex )
+{
+    delete aStates( aIndex );
+    aStates( aIndex ) = nullptr;
+
+    if ( aIndex < mIsStoredOnDisk.size() && mIsStoredOnDisk( aIndex ) )
+    {
+        std::remove( this->get_checkpoint_file_name( aIndex ).c_str() );
+
+        mIsStoredOnDisk( aIndex ) = false;
+    }
+}
+
+//-------------------------------------------------------------------------------
+
+std::string
+Monolithic_Time_Solver::get_checkpoint_file_name( uint aIndex )
+{
+    return mCheckpointDirectory + "/checkpoint." + std::to_string( aIndex ) + "." + std::to_string( par_rank() ) + ".bin";
 }
 
 //-------------------------------------------------------------------------------
@@ -177,7 +769,14 @@ void Monolithic_Time_Solver::solve( Vector< sol::Dist_Vector* >& aFullVector )
     // switch between forward and sensitivity analysis
     if ( mMyTimeSolver->is_forward_analysis() )
     {
-        this->solve_monolithic_time_system( aFullVector );
+        if ( mAdaptiveTimeStepping )
+        {
+            this->solve_adaptive_time_system( aFullVector );
+        }
+        else
+        {
+            this->solve_monolithic_time_system( aFullVector );
+        }
     }
     else
     {
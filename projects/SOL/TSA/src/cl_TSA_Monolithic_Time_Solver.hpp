@@ -28,10 +28,199 @@ namespace moris
           private:
             void solve_monolithic_time_system( Vector< sol::Dist_Vector* >& aFullVector );
 
+            void solve_adaptive_time_system( Vector< sol::Dist_Vector* >& aFullVector );
+
             void solve_implicit_DqDs( Vector< sol::Dist_Vector* >& aFullAdjointVector );
 
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief solves the nonlinear problem of a time slab
+             *
+             * @param[in] aFullVector  Solution vectors of all time slabs
+             * @param[in] aTimeStep    Index of time slab
+             */
+            void solve_time_slab(
+                    Vector< sol::Dist_Vector* >& aFullVector,
+                    uint                         aTimeStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief solves the nonlinear problem on a time interval for given solution vectors
+             *
+             * @param[in] aSolution      Solution vector of the time interval, holds the initial guess
+             * @param[in] aPrevSolution  Solution vector of the previous time interval
+             * @param[in] aTime          Start and end time of the time interval
+             * @param[in] aPrevTime      Start and end time of the previous time interval
+             * @param[in] aTimeStep      Index of time slab
+             */
+            void solve_time_interval(
+                    sol::Dist_Vector*       aSolution,
+                    sol::Dist_Vector*       aPrevSolution,
+                    const Matrix< DDRMat >& aTime,
+                    const Matrix< DDRMat >& aPrevTime,
+                    uint                    aTimeStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief computes IQIs and outputs of an accepted time slab and prepares the next time slab
+             *
+             * @param[in] aFullVector  Solution vectors of all time slabs
+             * @param[in] aTimeStep    Index of time slab
+             * @param[in] aEndTime     End time of time slab
+             * @param[in] aIsLastStep  Flag if time slab is the last one
+             */
+            void finalize_time_slab(
+                    Vector< sol::Dist_Vector* >& aFullVector,
+                    uint                         aTimeStep,
+                    real                         aEndTime,
+                    bool                         aIsLastStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief solves the time slab by step doubling: both halves of the time slab and the full
+             * time slab are solved starting from the previous time slab, and the relative local error of the
+             * full time slab is estimated from the difference of the two solutions at the end of the time slab
+             *
+             * @param[in] aFullVector  Solution vectors of all time slabs
+             * @param[in] aHalfSteps   Work vectors for the solutions of the two half steps
+             * @param[in] aTimeStep    Index of time slab
+             * @return relative error estimate
+             */
+            real estimate_local_error(
+                    Vector< sol::Dist_Vector* >& aFullVector,
+                    Vector< sol::Dist_Vector* >& aHalfSteps,
+                    uint                         aTimeStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief solves the adjoint problem of a time slab; the states of the time slab and the previous one
+             * need to be available
+             *
+             * @param[in] aStates              Solution vectors of all time slabs
+             * @param[in] aFullAdjointVector   Adjoint vectors of current and previous time slab
+             * @param[in] aTimeStep            Index of time slab, starting at 1
+             */
+            void solve_adjoint_time_slab(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    Vector< sol::Dist_Vector* >& aFullAdjointVector,
+                    uint                         aTimeStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief solves the adjoint problems of the time slabs between two states in reverse order, recomputing
+             * states from checkpoints which are placed by binomial (revolve) checkpointing
+             *
+             * @param[in] aStates              Solution vectors of all time slabs
+             * @param[in] aFullAdjointVector   Adjoint vectors of current and previous time slab
+             * @param[in] aStart               Index of available state at the beginning of the interval
+             * @param[in] aEnd                 Index of state at the end of the interval
+             * @param[in] aNumCheckpoints      Number of checkpoints available for this interval
+             */
+            void reverse_sweep(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    Vector< sol::Dist_Vector* >& aFullAdjointVector,
+                    uint                         aStart,
+                    uint                         aEnd,
+                    uint                         aNumCheckpoints );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief recomputes states by forward solves of time slabs, releasing intermediate states
+             *
+             * @param[in] aStates   Solution vectors of all time slabs
+             * @param[in] aStart    Index of available state
+             * @param[in] aEnd      Index of state to be computed
+             */
+            void advance_states(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aStart,
+                    uint                         aEnd );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief releases states which are not needed for the sensitivity analysis after a time slab is accepted
+             *
+             * @param[in] aStates      Solution vectors of all time slabs
+             * @param[in] aTimeStep    Index of accepted time slab
+             */
+            void release_forward_states(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aTimeStep );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief stores a state as checkpoint, i.e. moves it to disk if a checkpoint directory is given
+             */
+            void store_checkpoint(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief returns if a state is kept in memory or on disk
+             */
+            bool is_state_available(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief loads a state from disk if it is not kept in memory
+             */
+            void load_state(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief deletes a state from memory and disk
+             */
+            void release_state(
+                    Vector< sol::Dist_Vector* >& aStates,
+                    uint                         aIndex );
+
+            //-------------------------------------------------------------------------------
+            /**
+             * @brief returns file name of a checkpoint of this processor
+             */
+            std::string get_checkpoint_file_name( uint aIndex );
+
             moris::real mLambdaInc = 0;
 
+            //! number of state checkpoints for the sensitivity analysis; all states are kept if zero
+            uint mNumCheckpoints = 0;
+
+            //! directory for checkpoints on disk; checkpoints are kept in memory if empty
+            std::string mCheckpointDirectory;
+
+            //! flags for states which are stored as checkpoint during the forward analysis or on disk
+            Vector< bool > mIsForwardCheckpoint;
+            Vector< bool > mIsStoredOnDisk;
+
+            //! total time frame
+            real mTimeFrame = 1.0;
+
+            //! number of time slabs accepted in the last forward analysis, differs from the requested
+            //! number of time steps for adaptive time stepping
+            uint mNumAcceptedTimeSteps = 0;
+
+            //! flag for adaptive time stepping
+            bool mAdaptiveTimeStepping = false;
+
+            //! tolerance for relative local error estimate
+            real mAdaptiveTolerance = 1.0e-3;
+
+            //! bounds of time increment
+            real mMinTimeIncrement = 0.0;
+            real mMaxTimeIncrement = MORIS_REAL_MAX;
+
+            //! safety factor and maximum growth factor of time increment
+            real mSafetyFactor    = 0.9;
+            real mMaxGrowthFactor = 2.0;
+
+            //! maximum number of consecutive rejections of a time slab
+            uint mMaxRejections = 10;
+
           public:
             //-------------------------------------------------------------------------------
             /**
@@ -47,8 +236,7 @@ namespace moris
              *
              * @param[in] aParameterlist     User defined parameter list
              */
-            Monolithic_Time_Solver( const Parameter_List& aParameterlist )
-                    : Time_Solver_Algorithm( aParameterlist ) {};
+            Monolithic_Time_Solver( const Parameter_List& aParameterlist );
 
             //-------------------------------------------------------------------------------
 
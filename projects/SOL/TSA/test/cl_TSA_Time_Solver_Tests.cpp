@@ -12,6 +12,7 @@
 #include "fn_equal_to.hpp"
 #include "moris_typedefs.hpp"
 #include "cl_Matrix.hpp"
+#include "fn_norm.hpp"
 
 #include "linalg_typedefs.hpp"
 #include "cl_Communication_Tools.hpp"
@@ -96,4 +97,300 @@ namespace moris::tsa
             delete ( tSolverInput );
         }
     }
+
+    TEST_CASE( "TimeSolverAdaptive", "[TSA],[TimeSolverAdaptive]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Parameter_List tTimeSolverParameterList = prm::create_time_solver_algorithm_parameter_list();
+            tTimeSolverParameterList.set( "TSA_Num_Time_Steps", 1000 );
+            tTimeSolverParameterList.set( "TSA_Time_Frame", 10.0 );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Time_Stepping", true );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Tolerance", 1.0e-2 );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Max_Time_Increment", 0.75 );
+            std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >(
+                    tTimeSolverParameterList );
+
+            // Create solver interface
+            Solver_Interface *tSolverInput = new TSA_Solver_Interface_Proxy();
+
+            dla::Solver_Factory tSolFactory;
+            Parameter_List      tLinSolverParameterList = prm::create_linear_algorithm_parameter_list_aztec();
+            tLinSolverParameterList.set( "AZ_diagnostics", AZ_none );
+            tLinSolverParameterList.set( "AZ_output", AZ_none );
+            tLinSolverParameterList.set( "AZ_solver", AZ_gmres );
+            tLinSolverParameterList.set( "AZ_precond", AZ_dom_decomp );
+            std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( tLinSolverParameterList );
+
+            auto tLinSolManager = new dla::Linear_Solver();
+            tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+            NLA::Nonlinear_Solver_Factory               tNonlinFactory;
+            std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver();
+            tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+            NLA::Nonlinear_Solver tNonlinearSolverManager;
+            tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+            Vector< enum MSI::Dof_Type > tDofTypes( 1 );
+            tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+            tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+            tTimesolverAlgorithm->set_nonlinear_solver( &tNonlinearSolverManager );
+
+            Time_Solver tTimeSolver;
+
+            tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+            sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+            tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+            tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+            tTimeSolver.set_dof_type_list( tDofTypes );
+
+            tTimeSolver.solve();
+
+            Matrix< DDRMat > tSol;
+            tTimeSolver.get_full_solution( tSol );
+
+            // time slabs cover the time frame with fewer slabs than the initial time increment
+            Vector< Matrix< DDRMat > >& tTimeFrames = tTimeSolver.get_time_frames();
+
+            CHECK( equal_to( tTimeFrames( tTimeFrames.size() - 1 )( 1 ), 10.0 ) );
+            uint tNumAcceptedTimeSteps = std::dynamic_pointer_cast< Monolithic_Time_Solver >( tTimesolverAlgorithm )->mNumAcceptedTimeSteps;
+
+            CHECK( tNumAcceptedTimeSteps < 1000 );
+            CHECK( tTimeFrames.size() == tNumAcceptedTimeSteps + 1 );
+
+            // requested number of time steps is not overwritten
+            CHECK( tTimesolverAlgorithm->mTimeSteps == 1000 );
+
+            // no time slab, including the last one, exceeds the maximum time increment
+            for ( uint iTimeStep = 1; iTimeStep < tTimeFrames.size(); iTimeStep++ )
+            {
+                CHECK( tTimeFrames( iTimeStep )( 1 ) - tTimeFrames( iTimeStep )( 0 ) <= 0.75 + 1.0e-12 );
+            }
+
+            delete ( tLinSolManager );
+            delete ( tSolverInput );
+        }
+    }
+
+    TEST_CASE( "TimeSolverAdaptiveFirstSlab", "[TSA],[TimeSolverAdaptive]" )
+    {
+        if ( par_size() == 1 )
+        {
+            Parameter_List tTimeSolverParameterList = prm::create_time_solver_algorithm_parameter_list();
+            // initial time increment is limited by the maximum time increment
+            tTimeSolverParameterList.set( "TSA_Num_Time_Steps", 1 );
+            tTimeSolverParameterList.set( "TSA_Time_Frame", 10.0 );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Time_Stepping", true );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Tolerance", 1.0e-2 );
+            tTimeSolverParameterList.set( "TSA_Adaptive_Max_Time_Increment", 0.75 );
+            std::shared_ptr< Time_Solver_Algorithm > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >(
+                    tTimeSolverParameterList );
+
+            // Create solver interface
+            Solver_Interface *tSolverInput = new TSA_Solver_Interface_Proxy();
+
+            dla::Solver_Factory tSolFactory;
+            Parameter_List      tLinSolverParameterList = prm::create_linear_algorithm_parameter_list_aztec();
+            tLinSolverParameterList.set( "AZ_diagnostics", AZ_none );
+            tLinSolverParameterList.set( "AZ_output", AZ_none );
+            tLinSolverParameterList.set( "AZ_solver", AZ_gmres );
+            tLinSolverParameterList.set( "AZ_precond", AZ_dom_decomp );
+            std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( tLinSolverParameterList );
+
+            auto tLinSolManager = new dla::Linear_Solver();
+            tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+            NLA::Nonlinear_Solver_Factory               tNonlinFactory;
+            std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver();
+            tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+            NLA::Nonlinear_Solver tNonlinearSolverManager;
+            tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+            Vector< enum MSI::Dof_Type > tDofTypes( 1 );
+            tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+            tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+            tTimesolverAlgorithm->set_nonlinear_solver( &tNonlinearSolverManager );
+
+            Time_Solver tTimeSolver;
+
+            tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+            sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+            tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+            tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+            tTimeSolver.set_dof_type_list( tDofTypes );
+
+            tTimeSolver.solve();
+
+            Vector< Matrix< DDRMat > >& tTimeFrames = tTimeSolver.get_time_frames();
+
+            // the error of the first time slab is estimated as well, thus it is rejected and reduced
+            CHECK( tTimeFrames( 1 )( 0 ) == 0.0 );
+            CHECK( tTimeFrames( 1 )( 1 ) < 0.75 );
+
+            CHECK( equal_to( tTimeFrames( tTimeFrames.size() - 1 )( 1 ), 10.0 ) );
+
+            delete ( tLinSolManager );
+            delete ( tSolverInput );
+        }
+    }
+
+    // solves the proxy problem forward in time with the given number of checkpoints on disk and returns all states;
+    // states which are released after the forward analysis are recomputed from the latest available state
+    void
+    tSolve_TSACheckpointing(
+            uint                        aNumCheckpoints,
+            Vector< Matrix< DDRMat > >& aStates )
+    {
+        Parameter_List tTimeSolverParameterList = prm::create_time_solver_algorithm_parameter_list();
+        tTimeSolverParameterList.set( "TSA_Num_Time_Steps", 10 );
+        tTimeSolverParameterList.set( "TSA_Time_Frame", 1.0 );
+        tTimeSolverParameterList.set( "TSA_Adjoint_Checkpoints", (sint)aNumCheckpoints );
+        tTimeSolverParameterList.set( "TSA_Adjoint_Checkpoint_Directory", "." );
+        std::shared_ptr< Monolithic_Time_Solver > tTimesolverAlgorithm = std::make_shared< Monolithic_Time_Solver >(
+                tTimeSolverParameterList );
+
+        // Create solver interface
+        Solver_Interface *tSolverInput = new TSA_Solver_Interface_Proxy();
+
+        dla::Solver_Factory tSolFactory;
+        Parameter_List      tLinSolverParameterList = prm::create_linear_algorithm_parameter_list_aztec();
+        tLinSolverParameterList.set( "AZ_diagnostics", AZ_none );
+        tLinSolverParameterList.set( "AZ_output", AZ_none );
+        tLinSolverParameterList.set( "AZ_solver", AZ_gmres );
+        tLinSolverParameterList.set( "AZ_precond", AZ_dom_decomp );
+        std::shared_ptr< dla::Linear_Solver_Algorithm > tLinSolverAlgorithm = tSolFactory.create_solver( tLinSolverParameterList );
+
+        auto tLinSolManager = new dla::Linear_Solver();
+        tLinSolManager->set_linear_algorithm( 0, tLinSolverAlgorithm );
+
+        NLA::Nonlinear_Solver_Factory               tNonlinFactory;
+        std::shared_ptr< NLA::Nonlinear_Algorithm > tNonlLinSolverAlgorithm = tNonlinFactory.create_nonlinear_solver();
+        tNonlLinSolverAlgorithm->set_linear_solver( tLinSolManager );
+
+        NLA::Nonlinear_Solver tNonlinearSolverManager;
+        tNonlinearSolverManager.set_nonlinear_algorithm( tNonlLinSolverAlgorithm, 0 );
+
+        Vector< enum MSI::Dof_Type > tDofTypes( 1 );
+        tDofTypes( 0 ) = MSI::Dof_Type::TEMP;
+        tNonlinearSolverManager.set_dof_type_list( tDofTypes );
+
+        // the forward solver is used for the sensitivity dof types during recomputation as well
+        tTimesolverAlgorithm->set_nonlinear_solver( &tNonlinearSolverManager );
+        tTimesolverAlgorithm->set_nonlinear_solver_for_sensitivity_analysis( &tNonlinearSolverManager );
+
+        Time_Solver tTimeSolver;
+
+        tTimeSolver.set_time_solver_algorithm( tTimesolverAlgorithm );
+
+        sol::SOL_Warehouse tSolverWarehouse( tSolverInput );
+
+        tNonlinearSolverManager.set_solver_warehouse( &tSolverWarehouse );
+        tTimeSolver.set_solver_warehouse( &tSolverWarehouse );
+
+        tTimeSolver.set_dof_type_list( tDofTypes );
+
+        tTimeSolver.solve();
+
+        Vector< sol::Dist_Vector * > &tStates = tTimeSolver.get_solution_vectors();
+
+        uint tNumTimeSteps = tTimesolverAlgorithm->mNumAcceptedTimeSteps;
+
+        if ( aNumCheckpoints == 0 )
+        {
+            // all states are kept in memory
+            for ( uint iState = 0; iState <= tNumTimeSteps; iState++ )
+            {
+                CHECK( tStates( iState ) != nullptr );
+            }
+        }
+        else
+        {
+            // initial state and the two latest states are kept in memory
+            CHECK( tStates( 0 ) != nullptr );
+            CHECK( tStates( tNumTimeSteps - 1 ) != nullptr );
+            CHECK( tStates( tNumTimeSteps ) != nullptr );
+
+            // all other states are released; checkpoints of the forward analysis are moved to disk
+            uint tNumStoredOnDisk = 0;
+
+            for ( uint iState = 1; iState < tNumTimeSteps - 1; iState++ )
+            {
+                bool tIsOnDisk = tTimesolverAlgorithm->is_state_available( tStates, iState );
+
+                CHECK( tStates( iState ) == nullptr );
+                CHECK( tIsOnDisk == tTimesolverAlgorithm->mIsForwardCheckpoint( iState ) );
+
+                tNumStoredOnDisk += tIsOnDisk;
+            }
+
+            CHECK( tNumStoredOnDisk > 0 );
+            CHECK( tNumStoredOnDisk <= aNumCheckpoints );
+        }
+
+        // recompute each state from the latest available state before it
+        aStates.resize( tNumTimeSteps + 1 );
+
+        for ( uint iState = 0; iState <= tNumTimeSteps; iState++ )
+        {
+            uint tStart = iState;
+
+            while ( !tTimesolverAlgorithm->is_state_available( tStates, tStart ) )
+            {
+                tStart--;
+            }
+
+            tTimesolverAlgorithm->advance_states( tStates, tStart, iState );
+
+            tStates( iState )->extract_copy( aStates( iState ) );
+
+            if ( iState > tStart )
+            {
+                tTimesolverAlgorithm->release_state( tStates, iState );
+            }
+        }
+
+        // remove checkpoints from disk
+        for ( uint iState = 0; iState <= tNumTimeSteps; iState++ )
+        {
+            if ( iState < tTimesolverAlgorithm->mIsStoredOnDisk.size() && tTimesolverAlgorithm->mIsStoredOnDisk( iState ) )
+            {
+                tTimesolverAlgorithm->release_state( tStates, iState );
+            }
+        }
+
+        delete ( tLinSolManager );
+        delete ( tSolverInput );
+    }
+
+    TEST_CASE( "TimeSolverCheckpointing", "[TSA],[TimeSolverCheckpointing]" )
+    {
+        if ( par_size() == 1 )
+        {
+            // without checkpoints, all states are kept
+            Vector< Matrix< DDRMat > > tReferenceStates;
+            tSolve_TSACheckpointing( 0, tReferenceStates );
+
+            Vector< Matrix< DDRMat > > tCheckpointedStates;
+            tSolve_TSACheckpointing( 2, tCheckpointedStates );
+
+            REQUIRE( tReferenceStates.size() == tCheckpointedStates.size() );
+
+            // states recomputed from checkpoints on disk match the states of the forward analysis
+            for ( uint iState = 0; iState < tReferenceStates.size(); iState++ )
+            {
+                CHECK( norm( tCheckpointedStates( iState ) - tReferenceStates( iState ) ) <=
+                        1.0e-10 * std::max( norm( tReferenceStates( iState ) ), 1.0 ) );
+            }
+        }
+    }
     }
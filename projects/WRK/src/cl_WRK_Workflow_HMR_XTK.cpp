@@ -329,6 +329,14 @@ namespace moris::wrk
             return tVector;
         }
 
+        // rewrite refinement pattern file with processor slabs balancing the integration cells of the cut mesh
+        hmr::Parameters* tHMRParameters = mPerformerManager->mHMRPerformer( 0 )->get_parameters();
+
+        if ( tHMRParameters->write_binary_refinement_pattern() and tHMRParameters->use_processor_load_balancing() )
+        {
+            mPerformerManager->mHMRPerformer( 0 )->save_binary_refinement_pattern( tXTKPerformer->get_integration_cell_counts() );
+        }
+
         // store whether the new ghost has been used
         bool tUseNewGhostSets = tXTKPerformer->uses_SPG_based_enrichment();
 
@@ -12,6 +12,8 @@
 #include "cl_HMR_Mesh.hpp"
 #include "cl_HMR_Database.hpp"
 #include "cl_HMR_File.hpp"
+#include "cl_HMR_Restart_File.hpp"
+#include "cl_HMR_Lagrange_Mesh_Base.hpp"
 #include "cl_HMR_Mesh_Interpolation.hpp"
 #include "cl_HMR_Mesh_Integration.hpp"
 #include "HMR_Globals.hpp"
@@ -26,6 +28,8 @@
 #include "cl_WRK_perform_refinement.hpp"
 #include "cl_Parameter_List.hpp"
 
+#include "cl_Communication_Tools.hpp"
+
 // Logging package
 #include "cl_Logger.hpp"
 #include "cl_Tracer.hpp"
@@ -33,6 +37,7 @@
 #include "fn_PRM_MORIS_GENERAL_Parameters.hpp"
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 
 namespace moris::wrk
@@ -348,6 +353,18 @@ namespace moris::wrk
 
         this->unite_all_pattern_for_lagrange( aHMRPerformers( 0 ) );
 
+        // the refinement has changed, thus move the new mesh and fields onto balanced processor slabs
+        if ( tParameters->use_processor_load_balancing() and par_size() > 1 )
+        {
+            this->balance_processor_decomposition(
+                    aHMRPerformers,
+                    aMTKPerformer,
+                    aNewFields,
+                    tSourceLagrangeOrder,
+                    tDiscretizationOrder,
+                    tSourceBSplinePattern );
+        }
+
         if ( mParameters.mOutputMeshes )
         {
             this->output_meshes( aHMRPerformers( 0 ) );
@@ -958,4 +975,190 @@ namespace moris::wrk
 
     //--------------------------------------------------------------------------------------------------------------
 
+    void
+    Remeshing_Mini_Performer::balance_processor_decomposition(
+            Vector< std::shared_ptr< hmr::HMR > >&          aHMRPerformers,
+            Vector< std::shared_ptr< mtk::Mesh_Manager > >& aMTKPerformer,
+            Vector< std::shared_ptr< mtk::Field > >&        aFields,
+            uint                                            aLagrangeOrder,
+            uint                                            aDiscretizationOrder,
+            uint                                            aPattern )
+    {
+        Tracer tTracer( "WRK", "Remeshing Mini Performer", "Balance processor decomposition" );
+
+        uint tOptIter = gLogger.get_iteration( "OPT", "Manager", "Perform" );
+
+        std::shared_ptr< hmr::HMR > tHMRPerformer = aHMRPerformers( 0 );
+
+        // write refinement together with processor slabs that balance the output mesh
+        std::string tPath = "HMR_Remeshing_Refinement_Iter_" + std::to_string( tOptIter ) + ".hmr";
+
+        tHMRPerformer->save_binary_refinement_pattern( tPath );
+
+        barrier( "Remeshing_Mini_Performer::balance_processor_decomposition" );
+
+        // collect owned coefficients of all discrete fields with their HMR IDs
+        uint tNumFields = aFields.size();
+
+        Vector< Vector< luint > > tOwnedIds( tNumFields );
+        Vector< Vector< real > >  tOwnedCoefficients( tNumFields );
+
+        for ( uint iField = 0; iField < tNumFields; iField++ )
+        {
+            if ( !aFields( iField )->get_field_is_discrete() )
+            {
+                continue;
+            }
+
+            const Matrix< DDRMat >& tCoefficients = aFields( iField )->get_coefficients();
+
+            MORIS_ERROR( tCoefficients.n_cols() == 1,
+                    "Remeshing_Mini_Performer::balance_processor_decomposition - only single fields can be moved to balanced processor slabs." );
+
+            const Matrix< IdMat >& tIdsAndOwners = aFields( iField )->get_coefficient_ids_and_owners();
+            Vector< luint >        tHMRIds       = this->get_coefficient_hmr_ids( aFields( iField ) );
+
+            for ( uint iCoeff = 0; iCoeff < tHMRIds.size(); iCoeff++ )
+            {
+                if ( tIdsAndOwners( iCoeff, 1 ) == par_rank() )
+                {
+                    tOwnedIds( iField ).push_back( tHMRIds( iCoeff ) );
+                    tOwnedCoefficients( iField ).push_back( tCoefficients( iCoeff ) );
+                }
+            }
+        }
+
+        // rebuild HMR on the balanced processor slabs with the same parameters and refinement
+        hmr::Parameters* tParameters = tHMRPerformer->get_parameters();
+
+        tParameters->set_processor_splits( hmr::Restart_File::read_processor_splits( tPath ) );
+
+        tHMRPerformer->get_database()->unset_parameter_owning_flag();
+
+        std::shared_ptr< hmr::HMR > tBalancedHMRPerformer = std::make_shared< hmr::HMR >( tParameters );
+        tBalancedHMRPerformer->get_database()->set_parameter_owning_flag();
+
+        tBalancedHMRPerformer->get_database()->load_pattern_from_restart_file( tPath );
+        tBalancedHMRPerformer->get_database()->update_bspline_meshes();
+        tBalancedHMRPerformer->get_database()->update_lagrange_meshes();
+
+        aHMRPerformers( 0 ) = tBalancedHMRPerformer;
+
+        aMTKPerformer( 0 ) = std::make_shared< mtk::Mesh_Manager >();
+        aHMRPerformers( 0 )->set_performer( aMTKPerformer( 0 ) );
+
+        // create mesh of the fields on the rebuilt HMR
+        hmr::Interpolation_Mesh_HMR* tInterpolationMesh = new hmr::Interpolation_Mesh_HMR(
+                tBalancedHMRPerformer->get_database(),
+                aLagrangeOrder,
+                aPattern,
+                aDiscretizationOrder,
+                aPattern );
+
+        mtk::Mesh_Pair tMeshPair( tInterpolationMesh, nullptr, true );
+
+        // send owned coefficients to all procs, the procs that use them are not known before
+        Vector< moris_index > tCommunicationList;
+
+        for ( moris_index iProc = 0; iProc < par_size(); iProc++ )
+        {
+            if ( iProc != par_rank() )
+            {
+                tCommunicationList.push_back( iProc );
+            }
+        }
+
+        for ( uint iField = 0; iField < tNumFields; iField++ )
+        {
+            if ( !aFields( iField )->get_field_is_discrete() )
+            {
+                // analytic fields only need the new mesh
+                if ( aFields( iField )->get_field_implementation() != mtk::Field_Implementation::FEM )
+                {
+                    aFields( iField )->unlock_field();
+                    aFields( iField )->set_mesh_pair( tMeshPair );
+                }
+
+                continue;
+            }
+
+            Vector< Vector< luint > > tSendIds( tCommunicationList.size(), tOwnedIds( iField ) );
+            Vector< Vector< real > >  tSendCoefficients( tCommunicationList.size(), tOwnedCoefficients( iField ) );
+            Vector< Vector< luint > > tReceivedIds;
+            Vector< Vector< real > >  tReceivedCoefficients;
+
+            communicate_vectors( tCommunicationList, tSendIds, tReceivedIds );
+            communicate_vectors( tCommunicationList, tSendCoefficients, tReceivedCoefficients );
+
+            // coefficients of all procs by HMR ID
+            std::unordered_map< luint, real > tCoefficientMap;
+
+            for ( uint iCoeff = 0; iCoeff < tOwnedIds( iField ).size(); iCoeff++ )
+            {
+                tCoefficientMap[ tOwnedIds( iField )( iCoeff ) ] = tOwnedCoefficients( iField )( iCoeff );
+            }
+
+            for ( uint iProc = 0; iProc < tReceivedIds.size(); iProc++ )
+            {
+                for ( uint iCoeff = 0; iCoeff < tReceivedIds( iProc ).size(); iCoeff++ )
+                {
+                    tCoefficientMap[ tReceivedIds( iProc )( iCoeff ) ] = tReceivedCoefficients( iProc )( iCoeff );
+                }
+            }
+
+            std::shared_ptr< mtk::Field > tField = std::make_shared< mtk::Field_Discrete >( tMeshPair, 0 );
+            tField->set_label( aFields( iField )->get_label() );
+
+            Vector< luint > tHMRIds = this->get_coefficient_hmr_ids( tField );
+
+            Matrix< DDRMat > tCoefficients( tHMRIds.size(), 1 );
+
+            for ( uint iCoeff = 0; iCoeff < tHMRIds.size(); iCoeff++ )
+            {
+                auto tIter = tCoefficientMap.find( tHMRIds( iCoeff ) );
+
+                MORIS_ERROR( tIter != tCoefficientMap.end(),
+                        "Remeshing_Mini_Performer::balance_processor_decomposition - coefficient of field %s not found.",
+                        aFields( iField )->get_label().c_str() );
+
+                tCoefficients( iCoeff ) = tIter->second;
+            }
+
+            tField->unlock_field();
+            tField->set_coefficients( tCoefficients );
+            tField->compute_nodal_values();
+
+            aFields( iField ) = tField;
+        }
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
+    Vector< luint >
+    Remeshing_Mini_Performer::get_coefficient_hmr_ids( const std::shared_ptr< mtk::Field >& aField )
+    {
+        hmr::Mesh* tMesh = dynamic_cast< hmr::Mesh* >( aField->get_mesh_pair().get_interpolation_mesh() );
+
+        MORIS_ERROR( tMesh != nullptr and !tMesh->get_lagrange_mesh()->get_bspline_mesh_is_trivial_interpolation( 0 ),
+                "Remeshing_Mini_Performer::get_coefficient_hmr_ids - field needs to be discretized by HMR B-splines." );
+
+        const Matrix< IdMat >& tIdsAndOwners = aField->get_coefficient_ids_and_owners();
+
+        Vector< luint > tHMRIds( tIdsAndOwners.n_rows() );
+
+        for ( uint iCoeff = 0; iCoeff < tIdsAndOwners.n_rows(); iCoeff++ )
+        {
+            moris_index tIndex = tMesh->get_loc_entity_ind_from_entity_glb_id(
+                    tIdsAndOwners( iCoeff, 0 ),
+                    mtk::EntityRank::BSPLINE,
+                    0 );
+
+            tHMRIds( iCoeff ) = tMesh->get_lagrange_mesh()->get_bspline( 0, tIndex )->get_hmr_id();
+        }
+
+        return tHMRIds;
+    }
+
+    //--------------------------------------------------------------------------------------------------------------
+
 }    // namespace moris::wrk
@@ -153,6 +153,36 @@ namespace moris
             void unite_all_pattern_for_lagrange( const std::shared_ptr< hmr::HMR >& aHMRPerformer );
 
             //------------------------------------------------------------------------------
+
+            /**
+             * Rebuilds the remeshed HMR on processor slabs that balance its output mesh and moves the fields onto
+             * the same mesh of the rebuilt HMR. The refinement is passed through a binary refinement pattern file,
+             * and the owned field coefficients are sent to all procs and identified by their HMR IDs, which do not
+             * depend on the processor decomposition.
+             *
+             * @param[ inout ] aHMRPerformers        remeshed HMR, replaced by the rebuilt one
+             * @param[ inout ] aMTKPerformer         mesh manager, replaced by the one of the rebuilt HMR
+             * @param[ inout ] aFields               fields of the remeshed HMR, replaced by fields of the rebuilt HMR
+             * @param[ in ]    aLagrangeOrder        Lagrange order of the field mesh
+             * @param[ in ]    aDiscretizationOrder  B-spline order of the field mesh
+             * @param[ in ]    aPattern              Lagrange and B-spline pattern of the field mesh
+             */
+            void balance_processor_decomposition(
+                    Vector< std::shared_ptr< hmr::HMR > >&          aHMRPerformers,
+                    Vector< std::shared_ptr< mtk::Mesh_Manager > >& aMTKPerformer,
+                    Vector< std::shared_ptr< mtk::Field > >&        aFields,
+                    uint                                            aLagrangeOrder,
+                    uint                                            aDiscretizationOrder,
+                    uint                                            aPattern );
+
+            //------------------------------------------------------------------------------
+
+            /**
+             * returns the HMR IDs of the B-splines of the coefficients of a discrete field
+             */
+            Vector< luint > get_coefficient_hmr_ids( const std::shared_ptr< mtk::Field >& aField );
+
+            //------------------------------------------------------------------------------
         };
     }    // namespace wrk
 }    // namespace moris
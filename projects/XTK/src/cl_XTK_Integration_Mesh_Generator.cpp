@@ -463,6 +463,9 @@ namespace moris::xtk
             aMeshGenerationData.mIntersectedBackgroundCellIndex( iGeom ).reserve( tNumCells / tNumGeometries );
         }
 
+        // evaluate all background nodes at once, instead of once per cell they are attached to
+        this->get_geom_engine()->classify_background_nodes();
+
         // iterate through all cells
         for ( uint iCell = 0; iCell < tNumCells; iCell++ )
         {
@@ -490,6 +493,9 @@ namespace moris::xtk
             }
         }
 
+        // node classification is only valid for this query
+        this->get_geom_engine()->clear_background_node_regions();
+
         // remove the excess space
         shrink_to_fit_all( aMeshGenerationData.mIntersectedBackgroundCellIndex );
 
@@ -523,6 +529,9 @@ namespace moris::xtk
 
         tGeometricQuery.set_query_entity_rank( mtk::EntityRank::ELEMENT );
 
+        // evaluate all background nodes at once, instead of once per cell they are attached to
+        this->get_geom_engine()->classify_background_nodes();
+
         // iterate through all cells
         for ( uint iCell = 0; iCell < tNumCells; iCell++ )
         {
@@ -547,6 +556,9 @@ namespace moris::xtk
             }
         }
 
+        // node classification is only valid for this query
+        this->get_geom_engine()->clear_background_node_regions();
+
         // remove the excess space
         shrink_to_fit_all( aMeshGenerationData.mAllIntersectedBgCellInds );
 
@@ -936,6 +936,27 @@ namespace moris::xtk
         return mCutIntegrationMesh.get();
     }
 
+    // ----------------------------------------------------------------------------------
+
+    Vector< real >
+    Model::get_integration_cell_counts()
+    {
+        MORIS_ASSERT( mDecomposed,
+                "Cannot get number of integration cells prior to the decomposition strategy " );
+
+        // uncut background cells are used as integration cells
+        Vector< real > tCellCounts( mBackgroundMesh->get_num_entities( mtk::EntityRank::ELEMENT ), 1.0 );
+
+        for ( uint iChildMesh = 0; iChildMesh < mCutIntegrationMesh->get_num_child_meshes(); iChildMesh++ )
+        {
+            std::shared_ptr< Child_Mesh_Experimental > tChildMesh = mCutIntegrationMesh->get_child_mesh( iChildMesh );
+
+            tCellCounts( tChildMesh->get_parent_element_index() ) = tChildMesh->mIgCells->mIgCellGroup.size();
+        }
+
+        return tCellCounts;
+    }
+
     Enrichment const &
     Model::get_basis_enrichment()
     {
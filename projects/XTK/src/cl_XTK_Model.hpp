@@ -310,6 +310,15 @@ namespace moris::xtk
 
         Cut_Integration_Mesh*
         get_cut_integration_mesh();
+
+        // ----------------------------------------------------------------------------------
+
+        /**
+         * @brief Gets the number of integration cells per background cell, e.g. as cost for load balancing
+         * @return Number of integration cells per background cell index, 1 for uncut cells
+         */
+        Vector< real >
+        get_integration_cell_counts();
         /**
          * @return Basis enrichment
          */